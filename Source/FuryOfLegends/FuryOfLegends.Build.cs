@@ -23,7 +23,9 @@ public class FuryOfLegends : ModuleRules
             "OnlineSubsystemEOS",
             "OnlineSubsystemUtils",
             "Slate",
-            "SlateCore"
+            "SlateCore",
+            "NetCore",
+            "ReplicationGraph"
         });
     }
 }
@@ -0,0 +1,36 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "AI/BTService_SignificanceBase.h"
+#include "Controllers/BaseAIController.h"
+#include "BehaviorTree/BehaviorTreeComponent.h"
+
+UBTService_SignificanceBase::UBTService_SignificanceBase()
+{
+	bScaleIntervalBySignificance = true;
+}
+
+void UBTService_SignificanceBase::ScheduleNextTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory)
+{
+	Super::ScheduleNextTick(OwnerComp, NodeMemory);
+
+	if (!bScaleIntervalBySignificance)
+	{
+		return;
+	}
+
+	const ABaseAIController* AIController = Cast<ABaseAIController>(OwnerComp.GetAIOwner());
+	if (!AIController)
+	{
+		return;
+	}
+
+	const float Scale = AIController->GetServiceIntervalScale();
+	if (FMath::IsNearlyEqual(Scale, 1.f))
+	{
+		return;
+	}
+
+	const float NextTickTime = FMath::FRandRange(FMath::Max(0.0f, Interval - RandomDeviation), Interval + RandomDeviation) * Scale;
+	SetNextTickTime(NodeMemory, NextTickTime);
+}
@@ -2,54 +2,137 @@
 
 
 #include "Animations/AnimNotifies/ANS_CheckHit.h"
-#include "Characters/AOSCharacterBase.h"
-#include "Components/StatComponent.h"
-#include "Engine/DamageEvents.h"
+#include "Characters/CharacterBase.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "CollisionQueryParams.h"
+#include "Engine/World.h"
+
+UANS_CheckHit::UANS_CheckHit()
+{
+	SocketNames = { TEXT("Sword_Base"), TEXT("Sword_Mid"), TEXT("Sword_Tip") };
+}
+
+ACharacterBase* UANS_CheckHit::GetAuthorityOwner(USkeletalMeshComponent* MeshComponent) const
+{
+	if (::IsValid(MeshComponent) == false)
+	{
+		return nullptr;
+	}
+
+	// 판정은 서버에서만 합니다. 클라이언트는 소켓 위치를 읽을 필요도 없습니다.
+	ACharacterBase* OwnerCharacter = Cast<ACharacterBase>(MeshComponent->GetOwner());
+	return (::IsValid(OwnerCharacter) && OwnerCharacter->HasAuthority()) ? OwnerCharacter : nullptr;
+}
+
+void UANS_CheckHit::SampleSockets(const USkeletalMeshComponent* MeshComponent, TArray<FVector, TInlineAllocator<4>>& OutSamples) const
+{
+	OutSamples.Reset();
+	for (const FName& SocketName : SocketNames)
+	{
+		OutSamples.Add(MeshComponent->GetSocketLocation(SocketName));
+	}
+}
 
 void UANS_CheckHit::NotifyBegin(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyBegin(MeshComponent, Animation, TotalDuration, EventReference);
 
-	if (::IsValid(MeshComponent))
+	if (!GetAuthorityOwner(MeshComponent))
 	{
-		MeshComp = MeshComponent;
-		OwnerCharacter = Cast<AAOSCharacterBase>(MeshComponent->GetOwner());
-		if (::IsValid(OwnerCharacter) == false)
+		return;
+	}
+
+	// 끝나지 못한 다른 메시의 상태가 남아 있으면 정리합니다.
+	for (auto It = ActiveSwings.CreateIterator(); It; ++It)
+	{
+		if (It.Key().IsValid() == false)
 		{
-			UE_LOG(LogTemp, Log, TEXT("OwnerCharacter is not vaild"));
+			It.RemoveCurrent();
 		}
 	}
+
+	FMeleeSwingState& SwingState = ActiveSwings.FindOrAdd(MeshComponent);
+	SwingState.HitActors.Reset();
+	SampleSockets(MeshComponent, SwingState.PreviousSamples);
 }
 
 void UANS_CheckHit::NotifyTick(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float DeltaSeconds, const FAnimNotifyEventReference& EventReference)
 {
 	Super::NotifyTick(MeshComponent, Animation, DeltaSeconds, EventReference);
 
-	FVector SwordBase	= MeshComp->GetSocketLocation("Sword_Base");
-	FVector SwordMid	= MeshComp->GetSocketLocation("Sword_Mid");
-	FVector SwordTip	= MeshComp->GetSocketLocation("Sword_Tip");
+	ACharacterBase* OwnerCharacter = GetAuthorityOwner(MeshComponent);
+	FMeleeSwingState* SwingState = OwnerCharacter ? ActiveSwings.Find(MeshComponent) : nullptr;
+	UWorld* World = MeshComponent ? MeshComponent->GetWorld() : nullptr;
+	if (!SwingState || !World)
+	{
+		return;
+	}
+
+	TArray<FVector, TInlineAllocator<4>> CurrentSamples;
+	SampleSockets(MeshComponent, CurrentSamples);
+
+	if (SwingState->PreviousSamples.Num() != CurrentSamples.Num() || SwingState->HitActors.Num() >= MaxHitsPerSwing)
+	{
+		SwingState->PreviousSamples = CurrentSamples;
+		return;
+	}
+
+	// 가장 많이 움직인 소켓을 기준으로 나눌 횟수를 정합니다.
+	float MaxDisplacement = 0.f;
+	for (int32 Index = 0; Index < CurrentSamples.Num(); ++Index)
+	{
+		MaxDisplacement = FMath::Max(MaxDisplacement, FVector::Dist(SwingState->PreviousSamples[Index], CurrentSamples[Index]));
+	}
+
+	const int32 SubSteps = FMath::Clamp(FMath::CeilToInt(MaxDisplacement / MaxStepDistance), 1, MaxSubSteps);
 
-	FQuat SwordQuat;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(MeleeTrace), false, OwnerCharacter);
+	const FCollisionShape Shape = FCollisionShape::MakeSphere(Radius);
 
-	FVector Vec = SwordBase - SwordTip;
-	
+	TArray<FHitResult>& NewHits = SwingState->NewHits;
+	TArray<FHitResult>& OutHits = SwingState->SweepHits;
+	NewHits.Reset();
 
-	if (::IsValid(OwnerCharacter))
+	for (int32 Step = 0; Step < SubSteps; ++Step)
 	{
-		FVector CharacterForwadVector = OwnerCharacter->GetActorForwardVector();
+		const float StartAlpha = static_cast<float>(Step) / SubSteps;
+		const float EndAlpha = static_cast<float>(Step + 1) / SubSteps;
 
-		FCollisionQueryParams params(NAME_None, false, OwnerCharacter);
+		for (int32 Index = 0; Index < CurrentSamples.Num(); ++Index)
+		{
+			const FVector Start = FMath::Lerp(SwingState->PreviousSamples[Index], CurrentSamples[Index], StartAlpha);
+			const FVector End = FMath::Lerp(SwingState->PreviousSamples[Index], CurrentSamples[Index], EndAlpha);
+
+			OutHits.Reset();
+			if (World->SweepMultiByChannel(OutHits, Start, End, FQuat::Identity, TraceChannel, Shape, Params) == false)
+			{
+				continue;
+			}
+
+			for (const FHitResult& Hit : OutHits)
+			{
+				AActor* HitActor = Hit.GetActor();
+				if (::IsValid(HitActor) == false || HitActor == OwnerCharacter || SwingState->HitActors.Contains(HitActor))
+				{
+					continue;
+				}
 
-		bool bResult = MeshComp->GetWorld()->SweepMultiByChannel(
-			OutHits,
-			SwordBase,
-			SwordBase * CharacterForwadVector + 200,
-			FRotationMatrix::MakeFromX(CharacterForwadVector).ToQuat(),
-			ECC_GameTraceChannel5,
-			FCollisionShape::MakeSphere(50.f),
-			params
-		);
+				if (SwingState->HitActors.Num() >= MaxHitsPerSwing)
+				{
+					break;
+				}
+
+				SwingState->HitActors.Add(HitActor);
+				NewHits.Add(Hit);
+			}
+		}
+	}
+
+	SwingState->PreviousSamples = CurrentSamples;
+
+	if (NewHits.Num() > 0)
+	{
+		OwnerCharacter->OnMeleeTraceHit(ActionSlot, NewHits);
 	}
 }
 
@@ -57,4 +140,5 @@ void UANS_CheckHit::NotifyEnd(USkeletalMeshComponent* MeshComponent, UAnimSequen
 {
 	Super::NotifyEnd(MeshComponent, Animation, EventReference);
 
+	ActiveSwings.Remove(MeshComponent);
 }
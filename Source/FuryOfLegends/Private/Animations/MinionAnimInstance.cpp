@@ -16,19 +16,30 @@ void UMinionAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	if (::IsValid(OwnerCharacter) == true)
 	{
-		UCharacterMovementComponent* CharacterMovementComponent = OwnerCharacter->GetCharacterMovement();
-		if (::IsValid(CharacterMovementComponent) == true)
-		{
-			Velocity = CharacterMovementComponent->GetLastUpdateVelocity();
-			Acceleration = CharacterMovementComponent->GetCurrentAcceleration();
-			CurrentSpeed = Velocity.Size();
-			bIsFalling = CharacterMovementComponent->IsFalling();
-			bShouldMove = (!Acceleration.Equals(FVector(0.f, 0.f, 0.f)) && CurrentSpeed > 3.f) ? true : false;
-			bIsAccelerating = Acceleration.Length() > 0 ? true : false;
-
-			bIsDead = EnumHasAnyFlags(OwnerCharacter->CharacterState, ECharacterState::Death);
-		}
+		Snapshot.Capture(*OwnerCharacter);
 	}
+	else
+	{
+		Snapshot.bIsValid = false;
+	}
+}
+
+void UMinionAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (Snapshot.bIsValid == false)
+	{
+		return;
+	}
+
+	Velocity = Snapshot.LastUpdateVelocity;
+	Acceleration = Snapshot.Acceleration;
+	CurrentSpeed = Velocity.Size();
+	bIsFalling = Snapshot.bIsFalling;
+	bShouldMove = (!Acceleration.Equals(FVector(0.f, 0.f, 0.f)) && CurrentSpeed > 3.f) ? true : false;
+	bIsAccelerating = Acceleration.Length() > 0 ? true : false;
+	bIsDead = EnumHasAnyFlags(Snapshot.CharacterState, ECharacterState::Death);
 }
 
 void UMinionAnimInstance::PlayMontage(UAnimMontage* Montage, float PlayRate)
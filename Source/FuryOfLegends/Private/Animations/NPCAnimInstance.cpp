@@ -18,17 +18,29 @@ void UNPCAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
 	if (::IsValid(OwnerCharacter) == true)
 	{
-		UCharacterMovementComponent* CharacterMovementComponent = OwnerCharacter->GetCharacterMovement();
-		if (::IsValid(CharacterMovementComponent) == true)
-		{
-			Velocity = CharacterMovementComponent->GetLastUpdateVelocity();
-			Acceleration = CharacterMovementComponent->GetCurrentAcceleration();
-			CurrentSpeed = Velocity.Size();
-			bIsFalling = CharacterMovementComponent->IsFalling();
-			bShouldMove = (!Acceleration.Equals(FVector(0.f, 0.f, 0.f)) && CurrentSpeed > 3.f) ? true : false;
-			bIsAccelerating = Acceleration.Length() > 0 ? true : false;
-		}
+		Snapshot.Capture(*OwnerCharacter);
 	}
+	else
+	{
+		Snapshot.bIsValid = false;
+	}
+}
+
+void UNPCAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds)
+{
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+
+	if (Snapshot.bIsValid == false)
+	{
+		return;
+	}
+
+	Velocity = Snapshot.LastUpdateVelocity;
+	Acceleration = Snapshot.Acceleration;
+	CurrentSpeed = Velocity.Size();
+	bIsFalling = Snapshot.bIsFalling;
+	bShouldMove = (!Acceleration.Equals(FVector(0.f, 0.f, 0.f)) && CurrentSpeed > 3.f) ? true : false;
+	bIsAccelerating = Acceleration.Length() > 0 ? true : false;
 }
 
 void UNPCAnimInstance::PlayMontage(UAnimMontage* Montage, float PlayRate)
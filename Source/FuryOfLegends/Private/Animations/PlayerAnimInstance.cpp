@@ -32,125 +32,88 @@ void UPlayerAnimInstance::NativeUpdateAnimation(float DeltaSeconds)
 {
     Super::NativeUpdateAnimation(DeltaSeconds);
 
-    if (::IsValid(OwnerCharacter))
+    // 게임 스레드에서는 값 복사만 합니다. 계산은 NativeThreadSafeUpdateAnimation 에서 수행합니다.
+    if (::IsValid(OwnerCharacter) == false)
     {
-        if (!::IsValid(MovementComponent))
-        {
-            MovementComponent = OwnerCharacter->GetCharacterMovement();
-        }
-
-        if (::IsValid(MovementComponent))
-        {
-            bIsFalling = MovementComponent->IsFalling();
-            GroundSpeed = MovementComponent->GetLastUpdateVelocity().Size();
-            SetRootYawOffset(DeltaSeconds);
-            TurnInPlace(DeltaSeconds);
-
-            // MoveInputWithMaxSpeed 계산
-            float ForwardInputValue = FMath::Abs(MovementComponent->Velocity.X) * OwnerCharacter->GetForwardInputValue();
-            float RightInputValue = FMath::Abs(MovementComponent->Velocity.Y) * OwnerCharacter->GetRightInputValue();
-            float UpInputValue = MovementComponent->Velocity.Z;
-            MoveInputWithMaxSpeed = FVector(ForwardInputValue, RightInputValue, UpInputValue);
-
-            // MoveInput 정규화
-            MoveInput.X = FMath::Abs(MoveInputWithMaxSpeed.X) < KINDA_SMALL_NUMBER ? 0.f : MoveInputWithMaxSpeed.X / FMath::Abs(MoveInputWithMaxSpeed.X);
-            MoveInput.Y = FMath::Abs(MoveInputWithMaxSpeed.Y) < KINDA_SMALL_NUMBER ? 0.f : MoveInputWithMaxSpeed.Y / FMath::Abs(MoveInputWithMaxSpeed.Y);
-            MoveInput.Z = FMath::Abs(MoveInputWithMaxSpeed.Z) < KINDA_SMALL_NUMBER ? 0.f : MoveInputWithMaxSpeed.Z / FMath::Abs(MoveInputWithMaxSpeed.Z);
+        Snapshot.bIsValid = false;
+        return;
+    }
 
-            // 조준 회전 업데이트
-            BaseAimRotation.Pitch = OwnerCharacter->GetAimPitchValue();
-            BaseAimRotation.Yaw = OwnerCharacter->GetAimYawValue();
+    if (!::IsValid(MovementComponent))
+    {
+        MovementComponent = OwnerCharacter->GetCharacterMovement();
+    }
 
-            // YawOffset 계산
-            YawOffset = UKismetMathLibrary::NormalizedDeltaRotator(
-                UKismetMathLibrary::MakeRotFromX(MovementComponent->Velocity),
-                BaseAimRotation
-            ).Yaw;
+    Snapshot.Capture(*OwnerCharacter);
 
+    SnapshotForwardInput = OwnerCharacter->GetForwardInputValue();
+    SnapshotRightInput = OwnerCharacter->GetRightInputValue();
+    SnapshotAimRotation = FRotator(OwnerCharacter->GetAimPitchValue(), OwnerCharacter->GetAimYawValue(), 0.f);
+}
 
-            EBaseCharacterState NewCharacterState = EBaseCharacterState::None;
+void UPlayerAnimInstance::NativeThreadSafeUpdateAnimation(float _DeltaSeconds)
+{
+    Super::NativeThreadSafeUpdateAnimation(_DeltaSeconds);
 
-            if (EnumHasAnyFlags(OwnerCharacter->CharacterState, ECharacterState::Q))
-            {
-                EnumAddFlags(NewCharacterState, EBaseCharacterState::Q);
-            }
+    if (Snapshot.bIsValid == false)
+    {
+        return;
+    }
 
-            if (EnumHasAnyFlags(OwnerCharacter->CharacterState, ECharacterState::E))
-            {
-                EnumAddFlags(NewCharacterState, EBaseCharacterState::E);
-            }
+    bIsFalling = Snapshot.bIsFalling;
+    GroundSpeed = Snapshot.LastUpdateVelocity.Size();
+    SetRootYawOffset(_DeltaSeconds);
+    TurnInPlace(_DeltaSeconds);
 
-            if (EnumHasAnyFlags(OwnerCharacter->CharacterState, ECharacterState::R))
-            {
-                EnumAddFlags(NewCharacterState, EBaseCharacterState::R);
-            }
+    // MoveInputWithMaxSpeed 계산
+    float ForwardInputValue = FMath::Abs(Snapshot.Velocity.X) * SnapshotForwardInput;
+    float RightInputValue = FMath::Abs(Snapshot.Velocity.Y) * SnapshotRightInput;
+    float UpInputValue = Snapshot.Velocity.Z;
+    MoveInputWithMaxSpeed = FVector(ForwardInputValue, RightInputValue, UpInputValue);
 
-            if (EnumHasAnyFlags(OwnerCharacter->CharacterState, ECharacterState::LMB))
-            {
-                EnumAddFlags(NewCharacterState, EBaseCharacterState::LMB);
-            }
+    // MoveInput 정규화
+    MoveInput.X = FMath::Abs(MoveInputWithMaxSpeed.X) < KINDA_SMALL_NUMBER ? 0.f : FMath::Sign(MoveInputWithMaxSpeed.X);
+    MoveInput.Y = FMath::Abs(MoveInputWithMaxSpeed.Y) < KINDA_SMALL_NUMBER ? 0.f : FMath::Sign(MoveInputWithMaxSpeed.Y);
+    MoveInput.Z = FMath::Abs(MoveInputWithMaxSpeed.Z) < KINDA_SMALL_NUMBER ? 0.f : FMath::Sign(MoveInputWithMaxSpeed.Z);
 
-            if (EnumHasAnyFlags(OwnerCharacter->CharacterState, ECharacterState::RMB))
-            {
-                EnumAddFlags(NewCharacterState, EBaseCharacterState::RMB);
-            }
+    // 조준 회전 업데이트
+    BaseAimRotation.Pitch = SnapshotAimRotation.Pitch;
+    BaseAimRotation.Yaw = SnapshotAimRotation.Yaw;
 
-            // 상태가 변경되었을 때만 업데이트
-            if (NewCharacterState != CharacterState)
-            {
-                CharacterState = NewCharacterState;
-
-                FString CharacterStateString;
-                UEnum* EnumPtr = StaticEnum<EBaseCharacterState>();
-                if (EnumPtr)
-                {
-                    for (int32 i = 0; i < EnumPtr->NumEnums() - 1; ++i)
-                    {
-                        int64 Value = EnumPtr->GetValueByIndex(i);
-                        if (EnumHasAnyFlags(CharacterState, static_cast<EBaseCharacterState>(Value)) && Value != static_cast<uint8>(EBaseCharacterState::None))
-                        {
-                            CharacterStateString += EnumPtr->GetNameStringByIndex(i) + TEXT(" ");
-                        }
-                    }
-                }
-            }
-        }
-    }
-}
+    // YawOffset 계산
+    YawOffset = UKismetMathLibrary::NormalizedDeltaRotator(
+        UKismetMathLibrary::MakeRotFromX(Snapshot.Velocity),
+        BaseAimRotation
+    ).Yaw;
 
-void UPlayerAnimInstance::NativeThreadSafeUpdateAnimation(float _DeltaSeconds)
-{
-    Super::NativeThreadSafeUpdateAnimation(_DeltaSeconds);
+    CharacterState = ToBaseCharacterState(Snapshot.CharacterState);
 
-    if (::IsValid(MovementComponent) && ::IsValid(OwnerCharacter))
-    {
-        FVector CurrentLocation = OwnerCharacter->GetActorLocation();
-        FVector DisplacementVector = CurrentLocation - CurrentWorldLocation;
-        DisplacementVector.Z = 0.0f;
+    // 이동 / 가속 관련 값
+    FVector DisplacementVector = Snapshot.WorldLocation - CurrentWorldLocation;
+    DisplacementVector.Z = 0.0f;
 
-        DisplacementSinceLastUpdate = DisplacementVector.Length();
-        DisplacementSpeed = DisplacementSinceLastUpdate / _DeltaSeconds;
+    DisplacementSinceLastUpdate = DisplacementVector.Length();
+    DisplacementSpeed = _DeltaSeconds > 0.f ? DisplacementSinceLastUpdate / _DeltaSeconds : 0.f;
 
-        CurrentWorldLocation = CurrentLocation;
-        CurrentWorldRotation = OwnerCharacter->GetActorRotation();
+    CurrentWorldLocation = Snapshot.WorldLocation;
+    CurrentWorldRotation = Snapshot.WorldRotation;
 
-        Acceleration = MovementComponent->GetCurrentAcceleration();
-        Acceleration2D = FVector(Acceleration.X, Acceleration.Y, 0.0f);
-        bHasAcceleration = !Acceleration2D.IsNearlyZero(0.0001);
+    Acceleration = Snapshot.Acceleration;
+    Acceleration2D = FVector(Acceleration.X, Acceleration.Y, 0.0f);
+    bHasAcceleration = !Acceleration2D.IsNearlyZero(0.0001);
 
-        Velocity = MovementComponent->Velocity;
-        Velocity2D = FVector(Velocity.X, Velocity.Y, 0.0f);
-        LocomotionAngle = UKismetMathLibrary::NormalizedDeltaRotator(
-            UKismetMathLibrary::MakeRotFromX(Velocity2D),
-            OwnerCharacter->GetBaseAimRotation()
-        ).Yaw;
+    Velocity = Snapshot.Velocity;
+    Velocity2D = FVector(Velocity.X, Velocity.Y, 0.0f);
+    LocomotionAngle = UKismetMathLibrary::NormalizedDeltaRotator(
+        UKismetMathLibrary::MakeRotFromX(Velocity2D),
+        Snapshot.BaseAimRotation
+    ).Yaw;
 
-        Velocity.Normalize(0.0001);
-        Acceleration.Normalize(0.0001);
-        SpeedAccelDotProduct = FVector::DotProduct(Velocity, Acceleration);
+    Velocity.Normalize(0.0001);
+    Acceleration.Normalize(0.0001);
+    SpeedAccelDotProduct = FVector::DotProduct(Velocity, Acceleration);
 
-        Direction = Velocity2D.Length() > 0 ? CalculateLocomotionDirection(LocomotionAngle) : EDirection::None;
-    }
+    Direction = Velocity2D.Length() > 0 ? CalculateLocomotionDirection(LocomotionAngle) : EDirection::None;
 }
 
 void UPlayerAnimInstance::NativePostEvaluateAnimation()
@@ -164,7 +127,7 @@ void UPlayerAnimInstance::SetRootYawOffset(float DeltaSeconds)
     {
         // RootYawOffset를 0으로 보간합니다.
         RootYawOffset = FMath::FInterpTo(RootYawOffset, 0, DeltaSeconds, 20.f);
-        MovingRotation = OwnerCharacter->GetActorRotation();
+        MovingRotation = Snapshot.WorldRotation;
         LastMovingRotation = MovingRotation;
         bCanTurnInPlace = false;
         RotationTimer = 0.f;
@@ -189,7 +152,7 @@ void UPlayerAnimInstance::UpdateDeltaRotation()
     LastMovingRotation = MovingRotation;
     LastDeltaRotation = DeltaRotation;
 
-    MovingRotation = OwnerCharacter->GetActorRotation();
+    MovingRotation = Snapshot.WorldRotation;
     DeltaRotation = UKismetMathLibrary::NormalizedDeltaRotator(MovingRotation, LastMovingRotation);
 
     RootYawOffset -= DeltaRotation.Yaw;
@@ -248,6 +211,14 @@ void UPlayerAnimInstance::SetTargetYawAndAnimLength(float AbsRootYawOffset)
     }
 }
 
+EBaseCharacterState UPlayerAnimInstance::ToBaseCharacterState(ECharacterState InState)
+{
+    constexpr uint32 BaseStateMask = static_cast<uint32>(ECharacterState::Q | ECharacterState::E | ECharacterState::R | ECharacterState::LMB | ECharacterState::RMB);
+    static_assert(static_cast<uint32>(ECharacterState::RMB) == static_cast<uint32>(EBaseCharacterState::RMB), "EBaseCharacterState must mirror the low bits of ECharacterState.");
+
+    return static_cast<EBaseCharacterState>(static_cast<uint32>(InState) & BaseStateMask);
+}
+
 bool UPlayerAnimInstance::IsCharacterStateActive(EBaseCharacterState State) const
 {
     return EnumHasAnyFlags(CharacterState, State);
@@ -23,6 +23,7 @@
 #include "Components/CapsuleComponent.h"
 #include "Components/StatComponent.h"
 #include "Components/ActionStatComponent.h"
+#include "Components/PeriodicEffectComponent.h"
 #include "Components/CharacterWidgetComponent.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "GameFramework/SpringArmComponent.h"
@@ -54,6 +55,7 @@
 #include "Structs/ActionData.h"
 #include "Structs/CharacterResources.h"
 #include "Plugins/UniqueCodeGenerator.h"
+#include "Plugins/GameLogger.h"
 
 
 
@@ -120,6 +122,9 @@ AAOSCharacterBase::AAOSCharacterBase()
 		UE_LOG(LogTemp, Warning, TEXT("ScreenParticleSystem initialization failed."));
 	}
 
+	// 회복 / 지속 피해 / 버프 틱을 한 곳에서 처리합니다.
+	PeriodicEffectComponent = CreateDefaultSubobject<UPeriodicEffectComponent>(TEXT("PeriodicEffectComponent"));
+
 	// ----- Character Movement -----
 	bUseControllerRotationPitch = false;
 	bUseControllerRotationYaw = true;
@@ -396,8 +401,8 @@ void AAOSCharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	GetWorld()->GetTimerManager().ClearTimer(CheckEnemyOnScreenTimer);
 	GetWorld()->GetTimerManager().ClearTimer(TargetMaterialChangeTimer);
 
-	DeactivateHealthRegenTimer();
-	DeactivateManaRegenTimer();
+	DeactivateHealthRegeneration();
+	DeactivateManaRegeneration();
 }
 
 void AAOSCharacterBase::PostInitializeComponents()
@@ -428,10 +433,10 @@ void AAOSCharacterBase::PostInitializeComponents()
 		StatComponent->InitStatComponent(StatTable);
 		ActionStatComponent->InitActionStatComponent(ActionStatTable, StatComponent);
 
-		StatComponent->OnHealthDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateHealthRegenTimer);
-		StatComponent->OnManaDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateManaRegenTimer);
-		StatComponent->OnHealthFull.AddDynamic(this, &AAOSCharacterBase::DeactivateHealthRegenTimer);
-		StatComponent->OnManaFull.AddDynamic(this, &AAOSCharacterBase::DeactivateManaRegenTimer);
+		StatComponent->OnHealthDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateHealthRegeneration);
+		StatComponent->OnManaDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateManaRegeneration);
+		StatComponent->OnHealthFull.AddDynamic(this, &AAOSCharacterBase::DeactivateHealthRegeneration);
+		StatComponent->OnManaFull.AddDynamic(this, &AAOSCharacterBase::DeactivateManaRegeneration);
 		StatComponent->OnOutOfCurrentHP.AddDynamic(this, &AAOSCharacterBase::OnCharacterDeath);
 		StatComponent->OnCurrentLevelChanged.AddDynamic(this, &AAOSCharacterBase::SpawnLevelUpParticle);
 		StatComponent->OnCurrentLevelChanged.AddDynamic(ActionStatComponent, &UActionStatComponent::ServerUpdateUpgradableStatus);
@@ -1033,7 +1038,7 @@ void AAOSCharacterBase::CheckOutOfSight()
 	AAOSPlayerController* PlayerController = Cast<AAOSPlayerController>(GetController());
 	if (!::IsValid(PlayerController))
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AAOSCharacterBase::CheckOutOfSight] PlayerController is invalid."));
+		GAME_LOG_THROTTLED(LogArena, Error, 5.f, TEXT("PlayerController is invalid."));
 		return;
 	}
 
@@ -1044,7 +1049,7 @@ void AAOSCharacterBase::CheckOutOfSight()
 
 	if (!::IsValid(ArenaGameState))
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AAOSCharacterBase::CheckOutOfSight] ArenaGameState is invalid."));
+		GAME_LOG_THROTTLED(LogArena, Error, 5.f, TEXT("ArenaGameState is invalid."));
 		return;
 	}
 
@@ -1063,7 +1068,7 @@ void AAOSCharacterBase::CheckOutOfSight()
 	{
 		if (!::IsValid(Character))
 		{
-			UE_LOG(LogTemp, Warning, TEXT("[AAOSCharacterBase::CheckOutOfSight] Character is invalid."));
+			GAME_LOG_THROTTLED(LogArena, Warning, 5.f, TEXT("Character is invalid."));
 			continue;
 		}
 
@@ -1206,96 +1211,45 @@ void AAOSCharacterBase::ServerUpdateCameraLocation_Implementation(const FVector&
 
 //==================== HP/MP Regeneration Functions ====================//
 
-void AAOSCharacterBase::ActivateHealthRegenTimer()
+// 재생은 StatComponent 가 재생량과 기준 시각으로 계산합니다. 여기서는 재생 구간의 시작과 끝만 알립니다.
+void AAOSCharacterBase::ActivateHealthRegeneration()
 {
-	if (HasAuthority() == false)
-	{
-		return;
-	}
-
-	UWorld* World = GetWorld();
-	if (!World)
+	if (HasAuthority() == false || ::IsValid(StatComponent) == false)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Failed to retrieve the World context."), ANSI_TO_TCHAR(__FUNCTION__));
 		return;
 	}
 
-	auto HealthRegenLambda = [this]()
-		{
-			if (::IsValid(StatComponent) == false)
-			{
-				UE_LOG(LogTemp, Error, TEXT("[%s] StatComponent is invalid."), ANSI_TO_TCHAR(__FUNCTION__));
-				return;
-			}
-
-			float RegenerationAmount = StatComponent->GetHealthRegeneration();
-			StatComponent->ModifyCurrentHP(RegenerationAmount);
-		};
-
-	World->GetTimerManager().SetTimer(HealthRegenTimer, HealthRegenLambda, 1.0f, true, 1.0f);
+	StatComponent->SetHealthRegenerationActive(true);
 }
 
-void AAOSCharacterBase::ActivateManaRegenTimer()
+void AAOSCharacterBase::ActivateManaRegeneration()
 {
-	if (HasAuthority() == false)
-	{
-		return;
-	}
-
-	UWorld* World = GetWorld();
-	if (!World)
+	if (HasAuthority() == false || ::IsValid(StatComponent) == false)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Failed to retrieve the World context."), ANSI_TO_TCHAR(__FUNCTION__));
 		return;
 	}
 
-	auto ManaRegenLambda = [this]()
-		{
-			if (::IsValid(StatComponent) == false)
-			{
-				UE_LOG(LogTemp, Error, TEXT("[%s] StatComponent is invalid."), ANSI_TO_TCHAR(__FUNCTION__));
-				return;
-			}
-
-			float RegenerationAmount = StatComponent->GetManaRegeneration();
-			StatComponent->ModifyCurrentMP(RegenerationAmount);
-		};
-
-	World->GetTimerManager().SetTimer(ManaRegenTimer, ManaRegenLambda, 1.0f, true, 1.0f);
+	StatComponent->SetManaRegenerationActive(true);
 }
 
-void AAOSCharacterBase::DeactivateHealthRegenTimer()
+void AAOSCharacterBase::DeactivateHealthRegeneration()
 {
-	if (HasAuthority() == false)
+	if (HasAuthority() == false || ::IsValid(StatComponent) == false)
 	{
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Failed to retrieve the World context."), ANSI_TO_TCHAR(__FUNCTION__));
-		return;
-	}
-
-	World->GetTimerManager().ClearTimer(HealthRegenTimer);
+	StatComponent->SetHealthRegenerationActive(false);
 }
 
-void AAOSCharacterBase::DeactivateManaRegenTimer()
+void AAOSCharacterBase::DeactivateManaRegeneration()
 {
-	if (HasAuthority() == false)
-	{
-		return;
-	}
-
-	UWorld* World = GetWorld();
-	if (!World)
+	if (HasAuthority() == false || ::IsValid(StatComponent) == false)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Failed to retrieve the World context."), ANSI_TO_TCHAR(__FUNCTION__));
 		return;
 	}
 
-	World->GetTimerManager().ClearTimer(ManaRegenTimer);
+	StatComponent->SetManaRegenerationActive(false);
 }
 
 //==================== Character Attribute Functions ====================//
@@ -1388,18 +1342,18 @@ void AAOSCharacterBase::OnCharacterDeath()
 		StatComponent->OnOutOfCurrentHP.RemoveDynamic(this, &ThisClass::OnCharacterDeath);
 	}
 
-	if (StatComponent->OnHealthDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateHealthRegenTimer))
+	if (StatComponent->OnHealthDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateHealthRegeneration))
 	{
-		StatComponent->OnHealthDepleted.RemoveDynamic(this, &AAOSCharacterBase::ActivateHealthRegenTimer);
+		StatComponent->OnHealthDepleted.RemoveDynamic(this, &AAOSCharacterBase::ActivateHealthRegeneration);
 	}
 
-	if (StatComponent->OnManaDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateManaRegenTimer))
+	if (StatComponent->OnManaDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateManaRegeneration))
 	{
-		StatComponent->OnManaDepleted.RemoveDynamic(this, &AAOSCharacterBase::ActivateManaRegenTimer);
+		StatComponent->OnManaDepleted.RemoveDynamic(this, &AAOSCharacterBase::ActivateManaRegeneration);
 	}
 
-	DeactivateHealthRegenTimer();
-	DeactivateManaRegenTimer();
+	DeactivateHealthRegeneration();
+	DeactivateManaRegeneration();
 
 	EnumAddFlags(CharacterState, ECharacterState::Death);
 
@@ -1531,14 +1485,14 @@ void AAOSCharacterBase::Respawn(const float RestoreRatio)
 		StatComponent->OnOutOfCurrentHP.AddDynamic(this, &ThisClass::OnCharacterDeath);
 	}
 
-	if (StatComponent->OnHealthDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateHealthRegenTimer) == false)
+	if (StatComponent->OnHealthDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateHealthRegeneration) == false)
 	{
-		StatComponent->OnHealthDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateHealthRegenTimer);
+		StatComponent->OnHealthDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateHealthRegeneration);
 	}
 
-	if (StatComponent->OnManaDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateManaRegenTimer) == false)
+	if (StatComponent->OnManaDepleted.IsAlreadyBound(this, &AAOSCharacterBase::ActivateManaRegeneration) == false)
 	{
-		StatComponent->OnManaDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateManaRegenTimer);
+		StatComponent->OnManaDepleted.AddDynamic(this, &AAOSCharacterBase::ActivateManaRegeneration);
 	}
 
 	const float RestoreHP = StatComponent->GetMaxHP() * RestoreRatio;
@@ -22,7 +22,9 @@
 #include "Props/SplineActor.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/Engine.h"
-#include "Engine/OverlapResult.h"
+#include "Plugins/GameplayQuery.h"
+#include "Plugins/TerrainHeightSubsystem.h"
+#include "Game/DebugOverlaySubsystem.h"
 #include "Props/FreezeSegment.h"
 #include "CrowdControls/StunEffect.h"
 #include "CrowdControls/SlowEffect.h"
@@ -98,27 +100,7 @@ void AAuroraCharacter::Tick(float DeltaSeconds)
 		SmoothMovement(DeltaSeconds);
 	}
 
-	FString CharacterStateString;
-	UEnum* EnumPtr = StaticEnum<ECharacterState>();
-
-	if (EnumPtr)
-	{
-		for (int32 i = 0; i < EnumPtr->NumEnums() - 1; ++i)
-		{
-			int64 Value = EnumPtr->GetValueByIndex(i);
-
-			if (EnumHasAnyFlags(CharacterState, static_cast<ECharacterState>(Value)) && Value != static_cast<int64>(ECharacterState::None))
-			{
-				if (!CharacterStateString.IsEmpty())
-				{
-					CharacterStateString += TEXT(", ");
-				}
-				CharacterStateString += EnumPtr->GetNameStringByIndex(i);
-			}
-		}
-	}
-
-	UKismetSystemLibrary::PrintString(GetWorld(), FString::Printf(TEXT("CharacterState: %s"), *CharacterStateString), true, false, FLinearColor::Green, 2.0f, FName("1"));
+	ARENA_DEBUG_TEXT(this, EDebugOverlayCategory::CharacterState, 0.f, TEXT("%s: %s"), *GetName(), *UDebugOverlaySubsystem::DescribeFlags(StaticEnum<ECharacterState>(), static_cast<int64>(CharacterState)));
 }
 
 void AAuroraCharacter::BeginPlay()
@@ -273,10 +255,10 @@ void AAuroraCharacter::Q_CheckHit()
 	if (FreezeSegment != nullptr)
 	{
 		FreezeSegment->Radius = ActionAttributes.Radius;
-		FreezeSegment->Rate = GetUniqueAttribute(EActionSlot::Q, "Rate", 0.01f);
-		FreezeSegment->NumParicles = GetUniqueAttribute(EActionSlot::Q, "NumParticles", 28);
-		FreezeSegment->Lifetime = GetUniqueAttribute(EActionSlot::Q, "RingDuration", 2.f);
-		FreezeSegment->Scale = GetUniqueAttribute(EActionSlot::Q, "ParticleScale", 1.f);
+		FreezeSegment->Rate = GetUniqueAttribute(EActionSlot::Q, EUniqueAttribute::Rate, 0.01f);
+		FreezeSegment->NumParicles = GetUniqueAttribute(EActionSlot::Q, EUniqueAttribute::NumParticles, 28);
+		FreezeSegment->Lifetime = GetUniqueAttribute(EActionSlot::Q, EUniqueAttribute::RingDuration, 2.f);
+		FreezeSegment->Scale = GetUniqueAttribute(EActionSlot::Q, EUniqueAttribute::ParticleScale, 1.f);
 		FreezeSegment->Detection = ActiveActionState.CollisionDetection;
 		FreezeSegment->DamageInformation = DamageInformation;
 
@@ -368,9 +350,9 @@ void AAuroraCharacter::ExecutePrimary()
 	OnSwitchActionStateEnded.AddDynamic(this, &ThisClass::RestoreSwitchActionState);
 
 	const FActionAttributes& Stats	= ActionStatComponent->GetActionAttributes(EActionSlot::E);
-	const float MaxHeightDifference = GetUniqueAttribute(EActionSlot::E, "MaxHeightDifference", 100.f);
-	const float HeightThreshold		= GetUniqueAttribute(EActionSlot::E, "HeightThreshold", 600.f);
-	const float SegmentLength		= GetUniqueAttribute(EActionSlot::E, "SegmentLength", 50.f);
+	const float MaxHeightDifference = GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::MaxHeightDifference, 100.f);
+	const float HeightThreshold		= GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::HeightThreshold, 600.f);
+	const float SegmentLength		= GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::SegmentLength, 50.f);
 
 	// 1. 지형 트레이스
 	TArray<FVector> Path = TraceTerrainPath(Stats.Range, SegmentLength, HeightThreshold);
@@ -386,7 +368,7 @@ void AAuroraCharacter::ExecutePrimary()
 
 	//VisualizeTerrainSegments(TerrainSegments, Path);
 
-	DashingDuration = GetUniqueAttribute(EActionSlot::E, "CreationRate", 0.5);
+	DashingDuration = GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::CreationRate, 0.5);
 	IcePath->InitializeSpline(Path, DashingDuration, SegmentLength);
 	DashingDistance = IcePath->SplineComponent->GetSplineLength();
 	DashingDestination = IcePath->SplineComponent->GetLocationAtDistanceAlongSpline(DashingDistance, ESplineCoordinateSpace::World) + FVector(0, 0, 95);
@@ -534,9 +516,12 @@ TArray<FVector> AAuroraCharacter::TraceTerrainPath(const float TraceDistance, co
 		return TArray<FVector>();
 	}
 
-	FHitResult HitResult;
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
+	const UTerrainHeightSubsystem* Terrain = UTerrainHeightSubsystem::Get(this);
+	if (!Terrain)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[%s] Failed: TerrainHeightSubsystem is null."), ANSI_TO_TCHAR(__FUNCTION__));
+		return TArray<FVector>();
+	}
 
 	if (TraceDistance <= 0.f || StepSize <= 0.f)
 	{
@@ -547,15 +532,16 @@ TArray<FVector> AAuroraCharacter::TraceTerrainPath(const float TraceDistance, co
 	TArray<FVector> OutPath;
 
 	int32 Iterations = FMath::CeilToInt(TraceDistance / StepSize);
+	OutPath.Reserve(Iterations);
+
 	FVector TraceStart = LastCharacterLocation;
 	for (int32 i = 0; i < Iterations; i++)
 	{
 		TraceStart = LastCharacterLocation + LastForwardVector * StepSize * i;
 
-		if (World->LineTraceSingleByChannel(HitResult, TraceStart + FVector(0, 0, 5000), TraceStart + FVector(0, 0, -5000), ECC_WorldStatic, QueryParams))
+		FVector HitLocation;
+		if (Terrain->ProjectToGround(TraceStart, HitLocation, this))
 		{
-			FVector HitLocation = HitResult.Location;
-
 			// 높이 차 확인
 			if (OutPath.Num() > 0 && FMath::Abs(HitLocation.Z - OutPath.Last().Z) > HeightThreshold)
 			{
@@ -722,7 +708,7 @@ void AAuroraCharacter::VisualizeTerrainSegments(const TArray<FTerrainSegment>& T
 
 		for (int32 i = Segment.StartIndex; i <= Segment.EndIndex; ++i)
 		{
-			DrawDebugSphere(World, PathPoints[i], 10.f, 12, SegmentColor, true, -1.0f, 0, 2.0f);
+			ARENA_DEBUG_SPHERE(this, EDebugOverlayCategory::Terrain, PathPoints[i], 10.f, SegmentColor, -1.f);
 		}
 	}
 }
@@ -784,7 +770,7 @@ void AAuroraCharacter::R_Executed()
 
 	ServerPlayMontage(Montage, 1.0f, NAME_None, true);
 
-	const float BoostStrength = GetUniqueAttribute(EActionSlot::R, TEXT("BoostStrength"), 600.f);
+	const float BoostStrength = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::BoostStrength, 600.f);
 	if (!GetCharacterMovement()->IsFalling())
 	{
 		LaunchCharacter(FVector(0, 0, BoostStrength), false, true);
@@ -797,24 +783,12 @@ void AAuroraCharacter::R_Executed()
 
 void AAuroraCharacter::FindExplosionTargets(const FVector& Pos, TSet<TWeakObjectPtr<ACharacterBase>>& OutTargets, TEnumAsByte<ECollisionChannel> CollisionChannel, const float InRadius)
 {
-	TArray<FOverlapResult> OverlapResults;
-	if (GetWorld()->OverlapMultiByChannel(OverlapResults, Pos, FQuat::Identity, CollisionChannel, FCollisionShape::MakeSphere(InRadius)))
-	{
-		for (const auto& Result : OverlapResults)
-		{
-			ACharacterBase* OverlappedCharacter = Cast<ACharacterBase>(Result.GetActor());
-			if (IsValid(OverlappedCharacter) == false)
-			{
-				continue;
-			}
+	TArray<ACharacterBase*> OverlappedCharacters;
+	GameplayQuery::Overlap(GetWorld(), FGameplayQuery::Sphere(Pos, InRadius, CollisionChannel).EnemiesOf(TeamSide), OverlappedCharacters);
 
-			if (OverlappedCharacter->TeamSide == this->TeamSide)
-			{
-				continue; // 적 팀이 아닌 경우 다음으로
-			}
-
-			OutTargets.Add(OverlappedCharacter);
-		}
+	for (ACharacterBase* OverlappedCharacter : OverlappedCharacters)
+	{
+		OutTargets.Add(OverlappedCharacter);
 	}
 }
 
@@ -824,7 +798,7 @@ void AAuroraCharacter::R_CheckHit()
 
 	const FActionAttributes& StatTable = ActionStatComponent->GetActionAttributes(EActionSlot::R);
 	const FActiveActionState& ActiveAbilityState = ActionStatComponent->GetActiveActionState(EActionSlot::R);
-	const float FirstDelay = GetUniqueAttribute(EActionSlot::R, "FirstDelay", 1.5f);
+	const float FirstDelay = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::FirstDelay, 1.5f);
 
 	ServerModifyCharacterState(ECharacterStateOperation::Remove, ECharacterState::R);
 
@@ -857,8 +831,8 @@ void AAuroraCharacter::ScheduleExplosion(TSet<TWeakObjectPtr<ACharacterBase>>& T
 	const FActionAttributes& StatTable = ActionStatComponent->GetActionAttributes(EActionSlot::R);
 	const FActiveActionState& ActiveAbilityState = ActionStatComponent->GetActiveActionState(EActionSlot::R);
 
-	const float SlowDuration = GetUniqueAttribute(EActionSlot::R, "SlowDuration", 1.5f);
-	const float MovementSpeedSlow = GetUniqueAttribute(EActionSlot::R, "MovementSpeedSlow", 20.f);
+	const float SlowDuration = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::SlowDuration, 1.5f);
+	const float MovementSpeedSlow = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::MovementSpeedSlow, 20.f);
 
 	FCrowdControlInformation SlowEffect;
 	SlowEffect.Type = ECrowdControl::Slow;
@@ -897,13 +871,13 @@ void AAuroraCharacter::HandleExplosion(TSet<TWeakObjectPtr<ACharacterBase>>& Fro
 	const FActiveActionState& ActiveAbilityState = ActionStatComponent->GetActiveActionState(EActionSlot::R);
 	const FActionAttributes& ActionAttributes = ActionStatComponent->GetActionAttributes(EActionSlot::R);
 
-	const float StunDuration = GetUniqueAttribute(EActionSlot::R, "StunDuration", 1.0f);
-	const float ChainRadius = GetUniqueAttribute(EActionSlot::R, "ChainRadius", 500.0f);
-	const float HeroShatterAbilityDamage = GetUniqueAttribute(EActionSlot::R, "HeroShatterAbilityDamage", 0.f);
-	const float NonHeroShatterAbilityDamage = GetUniqueAttribute(EActionSlot::R, "NonHeroShatterAbilityDamage", 0.f);
-	const float InitialPowerScaling = GetUniqueAttribute(EActionSlot::R, "InitialPowerScaling", 0.f);
-	const float PowerScalingOnHero = GetUniqueAttribute(EActionSlot::R, "PowerScalingOnHero", 0.f);
-	const float PowerScalingOnNonHero = GetUniqueAttribute(EActionSlot::R, "PowerScalingOnNonHero", 0.f);
+	const float StunDuration = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::StunDuration, 1.0f);
+	const float ChainRadius = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::ChainRadius, 500.0f);
+	const float HeroShatterAbilityDamage = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::HeroShatterAbilityDamage, 0.f);
+	const float NonHeroShatterAbilityDamage = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::NonHeroShatterAbilityDamage, 0.f);
+	const float InitialPowerScaling = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::InitialPowerScaling, 0.f);
+	const float PowerScalingOnHero = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::PowerScalingOnHero, 0.f);
+	const float PowerScalingOnNonHero = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::PowerScalingOnNonHero, 0.f);
 
 	const float CharacterAP = StatComponent->GetAbilityPower();
 
@@ -920,7 +894,8 @@ void AAuroraCharacter::HandleExplosion(TSet<TWeakObjectPtr<ACharacterBase>>& Fro
 	PlayerDamageInfo.AddCrowdControl(FCrowdControlInformation(ECrowdControl::Stun, StunDuration));
 	NonHeroDamageInfo.AddCrowdControl(FCrowdControlInformation(ECrowdControl::Stun, StunDuration));
 
-	TSet<TWeakObjectPtr<ACharacterBase>> ChainTargets;
+	// 얼어붙은 대상마다 주변을 찾는 질의는 모아서 한 번에 처리합니다.
+	FGameplayQueryBatch ChainQueries;
 	for (auto It = FrozenEnemy.CreateIterator(); It; ++It)
 	{
 		if (!It->IsValid())
@@ -943,10 +918,21 @@ void AAuroraCharacter::HandleExplosion(TSet<TWeakObjectPtr<ACharacterBase>>& Fro
 			ServerSpawnEmitterAttached(UltimateExplode, (*It)->GetMesh(), (*It)->GetMesh()->GetSocketTransform(FName("Root")), EAttachLocation::KeepWorldPosition);
 		}
 
-		FindExplosionTargets((*It)->GetActorLocation(), ChainTargets, ActiveAbilityState.CollisionDetection, ChainRadius);
+		ChainQueries.Add(FGameplayQuery::Sphere((*It)->GetActorLocation(), ChainRadius, ActiveAbilityState.CollisionDetection).EnemiesOf(TeamSide));
 		AffectedCharacters->Add((*It));
 	}
 
+	ChainQueries.Execute(GetWorld());
+
+	TSet<TWeakObjectPtr<ACharacterBase>> ChainTargets;
+	for (int32 Index = 0; Index < ChainQueries.Num(); ++Index)
+	{
+		for (ACharacterBase* ChainTarget : ChainQueries.GetResults(Index))
+		{
+			ChainTargets.Add(ChainTarget);
+		}
+	}
+
 
 	TSet<TWeakObjectPtr<ACharacterBase>> UniqueChainTargets;
 	for (auto It = ChainTargets.CreateIterator(); It; ++It)
@@ -1217,8 +1203,8 @@ void AAuroraCharacter::RMB_Executed()
 	OnSwitchActionStateEnded.AddDynamic(this, &ThisClass::RestoreSwitchActionState);
 
 	FName MontageSectionName = FName(*FString::Printf(TEXT("RMB%d"), CalculateDirectionIndex()));
-	TumblingHeightScale = GetUniqueAttribute(EActionSlot::RMB, TEXT("HeightScale"), 1000.f);
-	TumbleHeightThreshold = GetUniqueAttribute(EActionSlot::RMB, TEXT("HeightThreshold"), 500.f);
+	TumblingHeightScale = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::HeightScale, 1000.f);
+	TumbleHeightThreshold = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::HeightThreshold, 500.f);
 	TumblingDestination = CalculateTumblingDestination(MoveDirection, ActionAttributes.Range) + FVector(0, 0, 95.f);
 
 	// 능력을 사용하고 쿨다운 시작
@@ -1229,7 +1215,7 @@ void AAuroraCharacter::RMB_Executed()
 
 		GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_Flying);
 
-		TumblingSpeed = GetUniqueAttribute(EActionSlot::RMB, TEXT("TumblingSpeed"), 200.f);
+		TumblingSpeed = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::TumblingSpeed, 200.f);
 		TumblingDirection = (TumblingDestination - LastCharacterLocation).GetSafeNormal();
 		TumblingDistance = FVector::Dist(LastCharacterLocation, TumblingDestination);
 		TumblingDuration = 0.35f;
@@ -1501,7 +1487,7 @@ void AAuroraCharacter::ExecuteSomethingSpecial()
 		return;
 	}
 
-	UKismetSystemLibrary::PrintString(GetWorld(), TEXT("[AAuroraCharacter::ExecuteSomethingSpecial] ExecuteSomethingSpecial function called."), true, true, FLinearColor::Red, 2.0f, NAME_None);
+	ARENA_DEBUG_TEXT(this, EDebugOverlayCategory::Combat, 2.f, TEXT("[%s] ExecuteSomethingSpecial function called."), ANSI_TO_TCHAR(__FUNCTION__));
 
 	FCrowdControlInformation CrowdControlInformation;
 	CrowdControlInformation.Type = ECrowdControl::Snare;
@@ -22,10 +22,13 @@
 
 // 게임 관련 헤더
 #include "Game/AOSGameInstance.h"
+#include "Game/ArenaSignificanceSubsystem.h"
+#include "Controllers/BaseAIController.h"
 
 // 기타 유틸리티
 #include "Particles/ParticleSystemComponent.h"
 #include "Plugins/GameTimerManager.h"
+#include "Plugins/CosmeticDispatcher.h"
 
 // 구조체 관련 헤더
 #include "Structs/CustomCombatData.h"
@@ -61,6 +64,7 @@ ACharacterBase::ACharacterBase()
 	CrowdControlManager = nullptr;
 
 	CharacterName = NAME_None;
+	SignificanceTier = ESignificanceTier::High;
 }
 
 
@@ -81,6 +85,29 @@ void ACharacterBase::BeginPlay()
 	EnumAddFlags(CharacterState, ECharacterState::SwitchAction);
 
 	OnMovementSpeedChanged(0, StatComponent->GetMovementSpeed());
+
+	// 미니언 / 몬스터는 중요도 관리 대상으로 등록
+	if (UArenaSignificanceSubsystem::IsManagedCharacter(this))
+	{
+		if (UArenaSignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UArenaSignificanceSubsystem>())
+		{
+			SignificanceSubsystem->RegisterCharacter(this);
+		}
+	}
+}
+
+
+void ACharacterBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UArenaSignificanceSubsystem* SignificanceSubsystem = World->GetSubsystem<UArenaSignificanceSubsystem>())
+		{
+			SignificanceSubsystem->UnregisterCharacter(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 
@@ -250,12 +277,45 @@ void ACharacterBase::RotateWidgetToLocalPlayer()
 	WidgetComponent->SetWorldRotation(LookAtRotation);
 }
 
+void ACharacterBase::ApplySignificance(ESignificanceTier NewTier, const FSignificanceTierSettings& Settings)
+{
+	SignificanceTier = NewTier;
+
+	// 서버의 틱과 애니메이션은 판정 노티파이와 이동을 결정하므로 항상 전체 주기로 돌립니다.
+	// 서버에서는 아래의 AI 서비스 주기만 조정합니다.
+	if (HasAuthority() == false)
+	{
+		SetActorTickInterval(Settings.ActorTickInterval);
+
+		USkeletalMeshComponent* CharacterMesh = GetMesh();
+		if (::IsValid(CharacterMesh))
+		{
+			CharacterMesh->bEnableUpdateRateOptimizations = Settings.bEnableUpdateRateOptimizations;
+			CharacterMesh->SetComponentTickInterval(Settings.AnimationTickInterval);
+		}
+	}
 
-float ACharacterBase::GetUniqueAttribute(EActionSlot SlotID, const FName& Key, float DefaultValue) const
+	// 위젯은 화면이 있는 곳에서만 의미가 있습니다.
+	if (::IsValid(WidgetComponent) && GetNetMode() != NM_DedicatedServer)
+	{
+		WidgetComponent->SetVisibility(Settings.bShowWidget);
+		WidgetComponent->SetComponentTickInterval(Settings.WidgetTickInterval);
+	}
+
+	// AI 컨트롤러는 서버에만 존재합니다.
+	ABaseAIController* AIController = Cast<ABaseAIController>(GetController());
+	if (::IsValid(AIController))
+	{
+		AIController->SetServiceIntervalScale(Settings.AIServiceIntervalScale);
+	}
+}
+
+
+float ACharacterBase::GetUniqueAttribute(EActionSlot SlotID, EUniqueAttribute Attribute, float DefaultValue) const
 {
 	if (ActionStatComponent)
 	{
-		return ActionStatComponent->GetUniqueValue(SlotID, Key, DefaultValue);
+		return ActionStatComponent->GetUniqueValue(SlotID, Attribute, DefaultValue);
 	}
 	return DefaultValue;
 }
@@ -575,12 +635,11 @@ UParticleSystemComponent* ACharacterBase::SpawnEmitterAtLocation(UParticleSystem
 		return nullptr;
 	}
 
-	// 파티클 생성
-	UParticleSystemComponent* ParticleSystemComponent = UGameplayStatics::SpawnEmitterAtLocation(
-		GetWorld(), Particle, Transform.GetLocation(), Transform.GetRotation().Rotator(), Transform.GetScale3D(), bAutoDestory, PoolingMethod, bAutoActivate);
+	// 리슨 서버 호스트만 직접 생성합니다. 데디케이티드 서버에서는 nullptr 입니다.
+	UParticleSystemComponent* ParticleSystemComponent = UCosmeticDispatcher::SpawnEmitterAtLocation(this, Particle, Transform, bAutoDestory, PoolingMethod, bAutoActivate);
 
 	// 클라이언트들에게 파티클 생성 요청
-	MulticastSpawnEmitterAtLocation(Particle, Transform);
+	MulticastSpawnEmitterAtLocation(Particle, Transform, bAutoDestory, PoolingMethod, bAutoActivate);
 
 	return ParticleSystemComponent;
 }
@@ -601,8 +660,7 @@ void ACharacterBase::MulticastSpawnEmitterAtLocation_Implementation(UParticleSys
 	}
 
 	// 클라이언트에서 파티클 생성
-	UParticleSystemComponent* ParticleSystemComponent = UGameplayStatics::SpawnEmitterAtLocation(
-		GetWorld(), Particle, Transform.GetLocation(), Transform.GetRotation().Rotator(), Transform.GetScale3D(), bAutoDestory, PoolingMethod, bAutoActivate);
+	UCosmeticDispatcher::SpawnEmitterAtLocation(this, Particle, Transform, bAutoDestory, PoolingMethod, bAutoActivate);
 }
 
 void ACharacterBase::ServerSpawnEmitterAttached_Implementation(UParticleSystem* Particle, USceneComponent* AttachToComponent, FTransform Transform, EAttachLocation::Type LocationType)
@@ -615,12 +673,8 @@ void ACharacterBase::ServerSpawnEmitterAttached_Implementation(UParticleSystem*
 
 void ACharacterBase::MulticastSpawnEmitterAttached_Implementation(UParticleSystem* Particle, USceneComponent* AttachToComponent, FTransform Transform, EAttachLocation::Type LocationType)
 {
-	if (!HasAuthority())
-	{
-		UGameplayStatics::SpawnEmitterAttached(
-			Particle, AttachToComponent, "Name_None", Transform.GetLocation(), Transform.GetRotation().Rotator(), Transform.GetScale3D(), LocationType, true, EPSCPoolMethod::None, true
-		);
-	}
+	// 데디케이티드 서버에서는 UCosmeticDispatcher 가 무시합니다.
+	UCosmeticDispatcher::SpawnEmitterAttached(Particle, AttachToComponent, Transform, LocationType);
 }
 
 //==================== Mesh Functions ====================//
@@ -635,43 +689,14 @@ void ACharacterBase::ServerSpawnMeshAttached_Implementation(UStaticMesh* MeshToS
 
 void ACharacterBase::MulticastSpawnMeshAttached_Implementation(UStaticMesh* MeshToSpawn, USceneComponent* AttachToComponent, float Duration)
 {
-	if (HasAuthority())
-	{
-		return;
-	}
-
 	if (::IsValid(MeshToSpawn) == false)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[%s] Mesh is not valid"), ANSI_TO_TCHAR(__FUNCTION__));
 		return;
 	}
 
-	UStaticMeshComponent* NewMeshComponent = NewObject<UStaticMeshComponent>(this, UStaticMeshComponent::StaticClass());
-	if (::IsValid(NewMeshComponent) == false)
-	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create new mesh component."), ANSI_TO_TCHAR(__FUNCTION__));
-		return;
-	}
-
-	FAttachmentTransformRules AttachmentRules(EAttachmentRule::KeepRelative, false);
-
-	NewMeshComponent->CreationMethod = EComponentCreationMethod::Instance;
-	NewMeshComponent->AttachToComponent(AttachToComponent != nullptr ? AttachToComponent : GetRootComponent(), AttachmentRules);
-	NewMeshComponent->SetStaticMesh(MeshToSpawn);
-	NewMeshComponent->SetCollisionProfileName("CharacterMesh");
-	NewMeshComponent->RegisterComponent();
-
-	FTimerHandle NewTimerHandle;
-	GetWorldTimerManager().SetTimer(NewTimerHandle,[MeshComponent = NewMeshComponent]()
-		{
-			if (MeshComponent)
-			{
-				MeshComponent->DestroyComponent();
-			}
-		},
-		Duration,
-		false
-	);
+	// 데디케이티드 서버에서는 UCosmeticDispatcher 가 무시합니다.
+	UCosmeticDispatcher::SpawnMeshAttached(this, MeshToSpawn, AttachToComponent, Duration);
 }
 
 void ACharacterBase::ServerSpawnActorAtLocation_Implementation(UClass* SpawnActor, FTransform SpawnTransform)
@@ -112,6 +112,38 @@ void AMeleeMinion::LMB_CheckHit()
 		return;
 	}
 
+	ServerApplyDamage(Enemy, this, AIController, MakeAttackDamageInformation());
+}
+
+void AMeleeMinion::OnMeleeTraceHit(EActionSlot SlotID, const TArray<FHitResult>& HitResults)
+{
+	if (!HasAuthority() || SlotID != EActionSlot::LMB)
+	{
+		return;
+	}
+
+	if (!::IsValid(ActionStatComponent) || !::IsValid(StatComponent))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[AMeleeMinion::OnMeleeTraceHit] Stat components are not valid."));
+		return;
+	}
+
+	const FDamageInformation DamageInformation = MakeAttackDamageInformation();
+
+	for (const FHitResult& HitResult : HitResults)
+	{
+		ACharacterBase* Enemy = Cast<ACharacterBase>(HitResult.GetActor());
+		if (!::IsValid(Enemy) || Enemy->TeamSide == TeamSide || EnumHasAnyFlags(Enemy->CharacterState, ECharacterState::Death))
+		{
+			continue;
+		}
+
+		ServerApplyDamage(Enemy, this, AIController, DamageInformation);
+	}
+}
+
+FDamageInformation AMeleeMinion::MakeAttackDamageInformation() const
+{
 	const FActionAttributes& ActionAttributes = ActionStatComponent->GetActionAttributes(EActionSlot::LMB);
 
 	const float Character_AttackDamage = StatComponent->GetAttackDamage();
@@ -124,5 +156,5 @@ void AMeleeMinion::LMB_CheckHit()
 	DamageInformation.ActionSlot = EActionSlot::LMB;
 	DamageInformation.AddDamage(EDamageType::Physical, FinalDamage);
 
-	ServerApplyDamage(Enemy, this, AIController, DamageInformation);
+	return DamageInformation;
 }
\ No newline at end of file
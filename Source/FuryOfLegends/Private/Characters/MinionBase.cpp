@@ -20,7 +20,7 @@
 #include "Net/UnrealNetwork.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
-#include "Engine/OverlapResult.h"
+#include "Plugins/GameplayQuery.h"
 #include "NavigationSystem.h"
 #include "NavModifierComponent.h"
 #include "NavAreas/NavArea_Null.h"
@@ -121,6 +121,7 @@ AMinionBase::AMinionBase()
 	ReplicatedSkeletalMesh = nullptr;
 
 	RelativeDirection = 0;
+	SpawnWave = 0;
 
 	ObjectType = EObjectType::Minion;
 
@@ -222,9 +223,8 @@ void AMinionBase::BeginPlay()
 
 void AMinionBase::Tick(float DeltaTime)
 {
+	// 위젯 회전은 ACharacterBase::Tick 에서 처리하고, 틱 주기는 중요도 단계에 따라 조정됩니다.
 	Super::Tick(DeltaTime);
-
-	RotateWidgetToLocalPlayer();
 }
 
 void AMinionBase::PostInitializeComponents()
@@ -248,7 +248,17 @@ void AMinionBase::PostInitializeComponents()
 		UMinionStatComponent* MinionStatComponent = Cast<UMinionStatComponent>(StatComponent);
 		if (MinionStatComponent)
 		{
-			MinionStatComponent->InitStatComponent(StatTable);
+			// 게임 모드가 미리 계산한 성장 테이블이 있으면 웨이브 번호로 조회만 합니다.
+			AArenaGameMode* GameMode = GetWorld()->GetAuthGameMode<AArenaGameMode>();
+			const FMinionGrowthTable* GrowthTable = GameMode ? GameMode->FindMinionGrowthTable(MinionsListRow->MinionType) : nullptr;
+			if (GrowthTable)
+			{
+				MinionStatComponent->InitStatComponent(StatTable, *GrowthTable, SpawnWave);
+			}
+			else
+			{
+				MinionStatComponent->InitStatComponent(StatTable);
+			}
 			MinionStatComponent->OnOutOfCurrentHP.AddDynamic(this, &AMinionBase::OnCharacterDeath);
 		}
 
@@ -590,47 +600,16 @@ void AMinionBase::DistributeExperience(ACharacterBase* Eliminator, const TArray<
 
 void AMinionBase::FindNearbyPlayers(TArray<ACharacterBase*>& PlayerCharacters, ETeamSide InTeamSide, float Distance)
 {
-	// Overlap detection
-	TArray<FOverlapResult> OutHits;
-	FVector CollisionBoxSize = FVector(2 * Distance, 2 * Distance, 2 * Distance); // 박스의 한 변의 길이를 원의 지름으로 설정
 	FVector OverlapLocation = GetActorLocation();
-	FCollisionQueryParams Params(NAME_None, false, this);
 
-	bool bResult = GetWorld()->OverlapMultiByChannel(
-		OutHits,
-		OverlapLocation,
-		FQuat::Identity,
-		ECC_GameTraceChannel4,
-		FCollisionShape::MakeBox(CollisionBoxSize),
-		Params
-	);
+	FGameplayQuery Query = FGameplayQuery::Sphere(OverlapLocation, Distance, ECC_GameTraceChannel4).EnemiesOf(TeamSide).OnlyType(EObjectType::Player).Ignore(this);
+	Query.Ignore(LastHitCharacter);
 
-	if (bResult)
+	TArray<ACharacterBase*> OverlappedCharacters;
+	if (GameplayQuery::Overlap(GetWorld(), Query, OverlappedCharacters) > 0)
 	{
-		for (const auto& OutHit : OutHits)
+		for (ACharacterBase* OverlappedCharacter : OverlappedCharacters)
 		{
-			AActor* OverlappedActor = OutHit.GetActor();
-			if (!::IsValid(OverlappedActor) || OverlappedActor == LastHitCharacter)
-			{
-				continue;
-			}
-
-			ACharacterBase* OverlappedCharacter = Cast<ACharacterBase>(OverlappedActor);
-			if (!::IsValid(OverlappedCharacter))
-			{
-				continue;
-			}
-
-			if (OverlappedCharacter->ObjectType != EObjectType::Player)
-			{
-				continue;
-			}
-
-			if (TeamSide == OverlappedCharacter->TeamSide)
-			{
-				continue;
-			}
-
 			// 추가적인 거리 확인
 			float DistanceToPlayer = FVector::Dist(OverlapLocation, OverlappedCharacter->GetActorLocation());
 			if (DistanceToPlayer <= Distance)
@@ -140,9 +140,9 @@ void ARangedMinion::LMB_Executed()
 	AProjectile* Projectile = Cast<AProjectile>(UGameplayStatics::BeginDeferredActorSpawnFromClass(GetWorld(), ProjectileClass, Transform, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn, this));
 	if (Projectile)
 	{
-		const float HomingAcceleration = GetUniqueAttribute(EActionSlot::LMB, TEXT("HomingAcceleration"), 1024.f);
-		const float InitialSpeed = GetUniqueAttribute(EActionSlot::LMB, TEXT("InitialSpeed"), 2000.f);
-		const float MaxSpeed = GetUniqueAttribute(EActionSlot::LMB, TEXT("MaxSpeed"), 2000.f);
+		const float HomingAcceleration = GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::HomingAcceleration, 1024.f);
+		const float InitialSpeed = GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::InitialSpeed, 2000.f);
+		const float MaxSpeed = GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::MaxSpeed, 2000.f);
 
 		Projectile->TargetActor = Enemy;
 		Projectile->TrailParticleSystem->Template = TrailEffect;
@@ -23,8 +23,10 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Structs/CustomCombatData.h"
 #include "Props/ArrowBase.h"
-#include "Engine/OverlapResult.h"
 #include "Plugins/UniqueCodeGenerator.h"
+#include "Plugins/GameplayQuery.h"
+#include "Plugins/TerrainHeightSubsystem.h"
+#include "Game/DebugOverlaySubsystem.h"
 
 
 
@@ -65,21 +67,13 @@ void ASparrowCharacter::Tick(float DeltaSeconds)
 	if (EnumHasAnyFlags(CharacterState, ECharacterState::Q) && IsLocallyControlled())
 	{
 		FHitResult ImpactResult = GetImpactPoint(Ability_Q_Range);
-		FVector ImpactPoint = ImpactResult.Location;
-		FVector TraceStart = FVector(ImpactPoint.X, ImpactPoint.Y, ImpactPoint.Z + 10000.f);
-		FVector TraceEnd = FVector(ImpactPoint.X, ImpactPoint.Y, ImpactPoint.Z - 10000.f);
-
-		FHitResult GroundHitResult;
-		FCollisionQueryParams CollisionParams(NAME_None, false, this);
-		bool bGroundHit = GetWorld()->LineTraceSingleByChannel(
-			GroundHitResult,
-			TraceStart,
-			TraceEnd,
-			ECollisionChannel::ECC_WorldStatic,
-			CollisionParams
-		);
-
-		Ability_Q_DecalLocation = GroundHitResult.Location;
+
+		// 매 프레임 호출되므로 구워 둔 지형 높이를 사용합니다.
+		const UTerrainHeightSubsystem* Terrain = UTerrainHeightSubsystem::Get(this);
+		if (!Terrain || Terrain->ProjectToGround(ImpactResult.Location, Ability_Q_DecalLocation, this) == false)
+		{
+			Ability_Q_DecalLocation = FVector::ZeroVector;
+		}
 
 		if (::IsValid(TargetDecalActor))
 		{
@@ -96,27 +90,7 @@ void ASparrowCharacter::Tick(float DeltaSeconds)
 		ChangeCameraLength(500.f);
 	}
 
-	FString CharacterStateString;
-	UEnum* EnumPtr = StaticEnum<ECharacterState>();
-
-	if (EnumPtr)
-	{
-		for (int32 i = 0; i < EnumPtr->NumEnums() - 1; ++i)
-		{
-			int64 Value = EnumPtr->GetValueByIndex(i);
-
-			if (EnumHasAnyFlags(CharacterState, static_cast<ECharacterState>(Value)) && Value != static_cast<int64>(ECharacterState::None))
-			{
-				if (!CharacterStateString.IsEmpty())
-				{
-					CharacterStateString += TEXT(", "); // 🌟 여러 상태가 있을 경우 쉼표로 구분
-				}
-				CharacterStateString += EnumPtr->GetNameStringByIndex(i);
-			}
-		}
-	}
-
-	UKismetSystemLibrary::PrintString(GetWorld(), FString::Printf(TEXT("CharacterState: %s"), *CharacterStateString), true, false, FLinearColor::Green, 2.0f, FName("1"));
+	ARENA_DEBUG_TEXT(this, EDebugOverlayCategory::CharacterState, 0.f, TEXT("%s: %s"), *GetName(), *UDebugOverlaySubsystem::DescribeFlags(StaticEnum<ECharacterState>(), static_cast<int64>(CharacterState)));
 }
 
 
@@ -342,10 +316,9 @@ void ASparrowCharacter::Q_Executed()
 	else
 	{
 		FHitResult HitResult = SweepTraceFromAimAngles(ActionAttributes.Range);
-		FCollisionQueryParams CollisionParams(NAME_None, false, this);
-		if (GetWorld()->LineTraceSingleByChannel(HitResult, FVector(HitResult.Location.X, HitResult.Location.Y, HitResult.Location.Z + 10000.f), FVector(HitResult.Location.X, HitResult.Location.Y, HitResult.Location.Z - 10000.f), ECC_WorldStatic, CollisionParams))
+		const UTerrainHeightSubsystem* Terrain = UTerrainHeightSubsystem::Get(this);
+		if (Terrain && Terrain->ProjectToGround(HitResult.Location, TargetLocation, this))
 		{
-			TargetLocation = HitResult.Location;
 			TargetLocations.Add(EActionSlot::Q, TargetLocation);
 		}
 		else
@@ -465,8 +438,8 @@ void ASparrowCharacter::Q_CheckHit()
 	int32 PlayerIndex = ArenaPlayerState->GetPlayerIndex();
 	const uint32 UniqueCode = UUniqueCodeGenerator::GenerateUniqueCode(ObjectType, PlayerIndex, ETimerCategory::Action, static_cast<uint8>(EActionSlot::Q), static_cast<uint8>(FPlatformTime::Seconds() * 1000) % 256);
 	const ECollisionChannel CollisionChannel = ActiveAbilityState.CollisionDetection;
-	const float ExplosionRadius = GetUniqueAttribute(EActionSlot::Q, "ExplosionRadius", 400.f);
-	const int MaxExplosions = GetUniqueAttribute(EActionSlot::Q, "MaxHitCount", 10);
+	const float ExplosionRadius = GetUniqueAttribute(EActionSlot::Q, EUniqueAttribute::ExplosionRadius, 400.f);
+	const int MaxExplosions = GetUniqueAttribute(EActionSlot::Q, EUniqueAttribute::MaxHitCount, 10);
 
 	const float PlayerAttackDamage = StatComponent->GetAttackDamage();
 	const float PlayerAbilityPower = StatComponent->GetAbilityPower();
@@ -497,28 +470,16 @@ void ASparrowCharacter::Q_CheckHit()
 				return;
 			}
 
-			TArray<FOverlapResult> OverlapResults;
-			FCollisionQueryParams QueryParams(NAME_None, false, this);
+			TArray<ACharacterBase*> OverlappedCharacters;
 
 			// 범위 내 대상 감지 실패 시 조기 반환
-			if (!GetWorld()->OverlapMultiByChannel(OverlapResults, TargetLocation, FQuat::Identity, CollisionChannel, FCollisionShape::MakeSphere(ExplosionRadius), QueryParams))
+			if (GameplayQuery::Overlap(GetWorld(), FGameplayQuery::Sphere(TargetLocation, ExplosionRadius, CollisionChannel).EnemiesOf(TeamSide).Ignore(this), OverlappedCharacters) == 0)
 			{
 				return;
 			}
 
-			for (const auto& OverlapResult : OverlapResults)
+			for (ACharacterBase* OverlappedCharacter : OverlappedCharacters)
 			{
-				ACharacterBase* OverlappedCharacter = Cast<ACharacterBase>(OverlapResult.GetActor());
-				if (::IsValid(OverlappedCharacter) == false)
-				{
-					continue;
-				}
-
-				if (OverlappedCharacter->TeamSide == this->TeamSide)
-				{
-					continue;
-				}
-
 				FDamageInformation DamageInformation;
 				DamageInformation.ActionSlot = EActionSlot::Q;
 				DamageInformation.AddDamage(EDamageType::Physical, TotalDamage / MaxExplosions);
@@ -565,10 +526,10 @@ void ASparrowCharacter::E_Executed()
 		return;
 	}
 
-	float Duration = GetUniqueAttribute(EActionSlot::E, "Duration", 4.0f);
-	const float BonusAttackSpeed = GetUniqueAttribute(EActionSlot::E, "BonusAttackSpeed", 0.f);
-	const float BonusFlatMovementSpeed = GetUniqueAttribute(EActionSlot::E, "BonusFlatMovementSpeed", 0.f);
-	const float BonusPercentMovementSpeed = GetUniqueAttribute(EActionSlot::E, "BonusPercentMovementSpeed", 0.f);
+	float Duration = GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::Duration, 4.0f);
+	const float BonusAttackSpeed = GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::BonusAttackSpeed, 0.f);
+	const float BonusFlatMovementSpeed = GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::BonusFlatMovementSpeed, 0.f);
+	const float BonusPercentMovementSpeed = GetUniqueAttribute(EActionSlot::E, EUniqueAttribute::BonusPercentMovementSpeed, 0.f);
 
 	ServerModifyCharacterState(ECharacterStateOperation::Add, ECharacterState::E);
 
@@ -621,7 +582,7 @@ void ASparrowCharacter::R_Executed()
 	}
 	
 	int32 PlayerIndex = ArenaPlayerState->GetPlayerIndex();
-	const float Duration = GetUniqueAttribute(EActionSlot::R, "Duration", 4.0f);
+	const float Duration = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::Duration, 4.0f);
 	uint32 UniqueCode = UUniqueCodeGenerator::GenerateUniqueCode(ObjectType, PlayerIndex, ETimerCategory::Action, static_cast<uint8>(EActionSlot::R), 1);
 
 	if (::IsValid(BowParticleSystem))
@@ -716,10 +677,10 @@ void ASparrowCharacter::ExecutePrimaryAction()
 	ArrowProperties.Detection	= ActiveAbilityState.CollisionDetection;
 	ArrowProperties.TargetActor = ::IsValid(CurrentTarget) ? CurrentTarget : nullptr;
 
-	ArrowProperties.MaxSpeed			= GetUniqueAttribute(EActionSlot::LMB, "MaxSpeed", 6500.f);
-	ArrowProperties.InitialSpeed		= GetUniqueAttribute(EActionSlot::LMB, "InitialSpeed", 6500.f);
-	ArrowProperties.HomingAcceleration	= GetUniqueAttribute(EActionSlot::LMB, "HomingAcceleration", 20000.f);
-	ArrowProperties.CollisionRadius		= GetUniqueAttribute(EActionSlot::LMB, "CollisionRadius", 20.f);
+	ArrowProperties.MaxSpeed			= GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::MaxSpeed, 6500.f);
+	ArrowProperties.InitialSpeed		= GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::InitialSpeed, 6500.f);
+	ArrowProperties.HomingAcceleration	= GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::HomingAcceleration, 20000.f);
+	ArrowProperties.CollisionRadius		= GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::CollisionRadius, 20.f);
 
 	const float CharacterAD = StatComponent->GetAttackDamage();
 	const float CharacterAP = StatComponent->GetAbilityPower();
@@ -761,10 +722,10 @@ void ASparrowCharacter::ExecuteUltimateAction()
 	ArrowProperties.MaxRange	= ActionAttributes.Range;
 	ArrowProperties.Detection	= ActiveAbilityState.CollisionDetection;
 
-	ArrowProperties.MaxSpeed		= GetUniqueAttribute(EActionSlot::R, "MaxSpeed", 6500.f);
-	ArrowProperties.InitialSpeed	= GetUniqueAttribute(EActionSlot::R, "InitialSpeed", 6500.f);
-	ArrowProperties.CollisionRadius = GetUniqueAttribute(EActionSlot::R, "CollisionRadius", 50.f);
-	ArrowProperties.ExplosionRadius = GetUniqueAttribute(EActionSlot::R, "ExplosionRadius", 300.f);
+	ArrowProperties.MaxSpeed		= GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::MaxSpeed, 6500.f);
+	ArrowProperties.InitialSpeed	= GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::InitialSpeed, 6500.f);
+	ArrowProperties.CollisionRadius = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::CollisionRadius, 50.f);
+	ArrowProperties.ExplosionRadius = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::ExplosionRadius, 300.f);
 
 	const float CharacterAD = StatComponent->GetAttackDamage();
 	const float CharacterAP = StatComponent->GetAbilityPower();
@@ -777,8 +738,8 @@ void ASparrowCharacter::ExecuteUltimateAction()
 	DamageInformation.AddTrigger(EAttackTrigger::AbilityEffects);
 
 	// 궁극기 화살 설정
-	const float SideDamage = GetUniqueAttribute(EActionSlot::R, "SideArrowsDamage", 55.f);
-	const float Angle = GetUniqueAttribute(EActionSlot::R, "SideArrowsAngle", 10.f);
+	const float SideDamage = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::SideArrowsDamage, 55.f);
+	const float Angle = GetUniqueAttribute(EActionSlot::R, EUniqueAttribute::SideArrowsAngle, 10.f);
 
 	// 타겟팅 및 임팩트 포인트 계산
 	FHitResult ImpactResult = SweepTraceFromAimAngles(ActionAttributes.Range);
@@ -931,7 +892,7 @@ void ASparrowCharacter::RMB_Executed()
 		return;
 	}
 
-	float ChargeTimeThreshold = GetUniqueAttribute(EActionSlot::RMB, TEXT("ChargeTimeThreshold"), 1.0f);
+	float ChargeTimeThreshold = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::ChargeTimeThreshold, 1.0f);
 	if (KeyElapsedTimes.Contains(EActionSlot::RMB) && KeyElapsedTimes[EActionSlot::RMB] <= ChargeTimeThreshold)
 	{
 		ServerStopMontage(0.4f, Montage, true);
@@ -981,11 +942,11 @@ void ASparrowCharacter::RMB_Executed()
 	ArrowProperties.MaxRange = ActionAttributes.Range;
 	ArrowProperties.Detection = ActiveAbilityState.CollisionDetection;
 
-	ArrowProperties.InitialSpeed = GetUniqueAttribute(EActionSlot::RMB, "InitialSpeed", 6500.f);
-	ArrowProperties.MaxSpeed = GetUniqueAttribute(EActionSlot::RMB, "MaxSpeed", 6500.f);
-	ArrowProperties.MaxPierceCount = GetUniqueAttribute(EActionSlot::RMB, "PierceCount", 3);
-	ArrowProperties.DamageReductionPerPierce = GetUniqueAttribute(EActionSlot::RMB, "DamageReduction", 10);
-	ArrowProperties.CollisionRadius = GetUniqueAttribute(EActionSlot::RMB, "CollisionRadius", 20.f);
+	ArrowProperties.InitialSpeed = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::InitialSpeed, 6500.f);
+	ArrowProperties.MaxSpeed = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::MaxSpeed, 6500.f);
+	ArrowProperties.MaxPierceCount = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::PierceCount, 3);
+	ArrowProperties.DamageReductionPerPierce = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::DamageReduction, 10);
+	ArrowProperties.CollisionRadius = GetUniqueAttribute(EActionSlot::RMB, EUniqueAttribute::CollisionRadius, 20.f);
 
 	FDamageInformation DamageInformation;
 	DamageInformation.ActionSlot = EActionSlot::RMB;
@@ -1095,7 +1056,7 @@ void ASparrowCharacter::ExecuteSomethingSpecial()
 		return;
 	}
 
-	UKismetSystemLibrary::PrintString(GetWorld(), TEXT("[ASparrowCharacter::ExecuteSomethingSpecial] ExecuteSomethingSpecial function called."), true, true, FLinearColor::Red, 2.0f, NAME_None);
+	ARENA_DEBUG_TEXT(this, EDebugOverlayCategory::Combat, 2.f, TEXT("[%s] ExecuteSomethingSpecial function called."), ANSI_TO_TCHAR(__FUNCTION__));
 
 	FCrowdControlInformation CrowdControlInformation;
 	CrowdControlInformation.Type = ECrowdControl::Slow;
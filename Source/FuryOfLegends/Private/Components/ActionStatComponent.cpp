@@ -256,6 +256,9 @@ bool UActionStatComponent::InitializeAction(EActionSlot SlotID, FActiveActionSta
 		ActionAttributesSlot.Emplace(ActionStat);
 	}
 
+	// 능력 코드에서 키 검색 없이 조회할 수 있도록 고유 속성을 미리 펼쳐 둡니다.
+	ResolveUniqueAttributes(SlotID, ActionAttributesSlot);
+
 	if (InLevel >= 1 && ActiveActionState.bCanCastAction)
 	{
 		ClientNotifyActivationChanged(SlotID, true);
@@ -622,82 +625,87 @@ const FActionAttributes& UActionStatComponent::GetActionAttributes(EActionSlot S
 
 
 
-float UActionStatComponent::GetUniqueValue(EActionSlot SlotID, const FName& InKey)
+int32 UActionStatComponent::GetSlotIndex(EActionSlot SlotID)
 {
-	// 능력 정보와 능력 속성 배열에 대한 포인터 정의
-	const FActiveActionState* ActiveActionState = nullptr;
-	const TArray<FActionAttributes>* StatTables = nullptr;
-
-	// SlotID에 따라 포인터 설정
 	switch (SlotID)
 	{
-	case EActionSlot::Q:
-		ActiveActionState = &ActiveActionState_Q;
-		StatTables = &ActionAttributes_Q;
-		break;
-	case EActionSlot::E:
-		ActiveActionState = &ActiveActionState_E;
-		StatTables = &ActionAttributes_E;
-		break;
-	case EActionSlot::R:
-		ActiveActionState = &ActiveActionState_R;
-		StatTables = &ActionAttributes_R;
-		break;
-	case EActionSlot::LMB:
-		ActiveActionState = &ActiveActionState_LMB;
-		StatTables = &ActionAttributes_LMB;
-		break;
-	case EActionSlot::RMB:
-		ActiveActionState = &ActiveActionState_RMB;
-		StatTables = &ActionAttributes_RMB;
-		break;
-	default:
-		UE_LOG(LogTemp, Error, TEXT("[%s] Invalid SlotID: %d. Please check the input."), ANSI_TO_TCHAR(__FUNCTION__), static_cast<int32>(SlotID));
-		return 0.0f;
+	case EActionSlot::Q:	return 0;
+	case EActionSlot::E:	return 1;
+	case EActionSlot::R:	return 2;
+	case EActionSlot::LMB:	return 3;
+	case EActionSlot::RMB:	return 4;
+	default:				return INDEX_NONE;
+	}
+}
+
+void UActionStatComponent::ResolveUniqueAttributes(EActionSlot SlotID, const TArray<FActionAttributes>& ActionAttributesSlot)
+{
+	const int32 SlotIndex = GetSlotIndex(SlotID);
+	if (SlotIndex == INDEX_NONE)
+	{
+		return;
 	}
 
-	// ActiveActionState와 ActionStatTables가 유효한지 확인
-	if (!ActiveActionState || !StatTables)
+	TArray<FUniqueAttributeSet>& ResolvedSlot = ResolvedUniqueAttributes[SlotIndex];
+	ResolvedSlot.SetNum(ActionAttributesSlot.Num());
+
+	for (int32 InstanceIndex = 0; InstanceIndex < ActionAttributesSlot.Num(); ++InstanceIndex)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Invalid Action info or attributes"), ANSI_TO_TCHAR(__FUNCTION__));
-		return 0.f;
+		ResolvedSlot[InstanceIndex].Resolve(ActionAttributesSlot[InstanceIndex].UniqueAttributes);
 	}
+}
 
-	if (ActiveActionState->InstanceIndex <= 0)
+float UActionStatComponent::GetUniqueValue(EActionSlot SlotID, EUniqueAttribute Attribute, float DefaultValue) const
+{
+	const int32 SlotIndex = GetSlotIndex(SlotID);
+	if (SlotIndex == INDEX_NONE || Attribute == EUniqueAttribute::MAX)
 	{
-		FString SlotName = StaticEnum<EActionSlot>()->GetNameStringByValue(static_cast<int64>(ActiveActionState->SlotID));
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Action slot [%s] is not initialized yet. InstanceIndex: %d"),
-			ANSI_TO_TCHAR(__FUNCTION__), *SlotName, ActiveActionState->InstanceIndex);
-		return 0.f;
+		return DefaultValue;
 	}
 
-	// 인덱스를 제한하고 속성 배열 가져오기
-	if ((*StatTables).IsValidIndex(ActiveActionState->InstanceIndex -1) == false)
+	int32 InstanceIndex = 0;
+	switch (SlotID)
 	{
-		return 0.f;
+	case EActionSlot::Q:	InstanceIndex = ActiveActionState_Q.InstanceIndex;		break;
+	case EActionSlot::E:	InstanceIndex = ActiveActionState_E.InstanceIndex;		break;
+	case EActionSlot::R:	InstanceIndex = ActiveActionState_R.InstanceIndex;		break;
+	case EActionSlot::LMB:	InstanceIndex = ActiveActionState_LMB.InstanceIndex;	break;
+	case EActionSlot::RMB:	InstanceIndex = ActiveActionState_RMB.InstanceIndex;	break;
+	default:				break;
 	}
 
-	const TArray<FUniqueAttribute>& Attributes = (*StatTables)[ActiveActionState->InstanceIndex -1].UniqueAttributes;
-	for (const auto& ActionAttribute : Attributes)
+	const TArray<FUniqueAttributeSet>& ResolvedSlot = ResolvedUniqueAttributes[SlotIndex];
+	if (ResolvedSlot.IsValidIndex(InstanceIndex - 1) == false)
 	{
-		if (ActionAttribute.Key.IsEqual(InKey))
-		{
-			return ActionAttribute.Value;
-		}
+		return DefaultValue;
 	}
 
-	return 0.f;
+	return ResolvedSlot[InstanceIndex - 1].Get(Attribute, DefaultValue);
 }
 
-float UActionStatComponent::GetUniqueValue(EActionSlot SlotID, const FName& InKey, float DefaultValue)
+void UActionStatComponent::OnRep_ActionAttributes_Q()
 {
-	float Value = GetUniqueValue(SlotID, InKey);
-	if (FMath::IsNearlyZero(Value))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Key '%s' not found for SlotID '%d', using default value %f."), ANSI_TO_TCHAR(__FUNCTION__), *InKey.ToString(), static_cast<int32>(SlotID), DefaultValue);
-		return DefaultValue;
-	}
-	return Value;
+	ResolveUniqueAttributes(EActionSlot::Q, ActionAttributes_Q);
+}
+
+void UActionStatComponent::OnRep_ActionAttributes_E()
+{
+	ResolveUniqueAttributes(EActionSlot::E, ActionAttributes_E);
+}
+
+void UActionStatComponent::OnRep_ActionAttributes_R()
+{
+	ResolveUniqueAttributes(EActionSlot::R, ActionAttributes_R);
+}
+
+void UActionStatComponent::OnRep_ActionAttributes_LMB()
+{
+	ResolveUniqueAttributes(EActionSlot::LMB, ActionAttributes_LMB);
+}
+
+void UActionStatComponent::OnRep_ActionAttributes_RMB()
+{
+	ResolveUniqueAttributes(EActionSlot::RMB, ActionAttributes_RMB);
 }
 
 
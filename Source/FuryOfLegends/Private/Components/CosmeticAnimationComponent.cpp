@@ -0,0 +1,119 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/CosmeticAnimationComponent.h"
+#include "Components/SceneComponent.h"
+#include "Particles/ParticleSystemComponent.h"
+
+
+UCosmeticAnimationComponent::UCosmeticAnimationComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
+	bAutoActivate = true;
+}
+
+void UCosmeticAnimationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UpdateTickEnabled();
+}
+
+void UCosmeticAnimationComponent::AddRotator(USceneComponent* Component, const FRotator& RotationRate)
+{
+	if (::IsValid(Component) == false || RotationRate.IsZero())
+	{
+		return;
+	}
+
+	FCosmeticRotator& Rotator = Rotators.AddDefaulted_GetRef();
+	Rotator.Component = Component;
+	Rotator.RotationRate = RotationRate;
+
+	UpdateTickEnabled();
+}
+
+void UCosmeticAnimationComponent::AddParticleTracker(UParticleSystemComponent* Particle, const FName& ParameterName, TFunction<AActor*()>&& TargetGetter)
+{
+	if (::IsValid(Particle) == false || ParameterName.IsNone() || !TargetGetter)
+	{
+		return;
+	}
+
+	FCosmeticParticleTracker& Tracker = ParticleTrackers.AddDefaulted_GetRef();
+	Tracker.Particle = Particle;
+	Tracker.ParameterName = ParameterName;
+	Tracker.TargetGetter = MoveTemp(TargetGetter);
+
+	UpdateTickEnabled();
+}
+
+void UCosmeticAnimationComponent::StopAll()
+{
+	bStopped = true;
+	UpdateTickEnabled();
+}
+
+void UCosmeticAnimationComponent::UpdateTickEnabled()
+{
+	// 서버에는 볼 사람이 없습니다.
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	if (HasBegunPlay() == false)
+	{
+		return;
+	}
+
+	const bool bHasWork = Rotators.Num() > 0 || ParticleTrackers.Num() > 0;
+	SetComponentTickEnabled(bHasWork && bStopped == false);
+}
+
+bool UCosmeticAnimationComponent::ShouldAnimate() const
+{
+	const AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return false;
+	}
+
+	return RenderedTolerance <= 0.f || Owner->WasRecentlyRendered(RenderedTolerance);
+}
+
+void UCosmeticAnimationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	if (ShouldAnimate() == false)
+	{
+		return;
+	}
+
+	for (const FCosmeticRotator& Rotator : Rotators)
+	{
+		if (USceneComponent* Component = Rotator.Component.Get())
+		{
+			Component->AddLocalRotation(Rotator.RotationRate * DeltaTime);
+		}
+	}
+
+	for (const FCosmeticParticleTracker& Tracker : ParticleTrackers)
+	{
+		UParticleSystemComponent* Particle = Tracker.Particle.Get();
+		if (!Particle || Particle->IsActive() == false)
+		{
+			continue;
+		}
+
+		const AActor* Target = Tracker.TargetGetter();
+		if (::IsValid(Target))
+		{
+			Particle->SetVectorParameter(Tracker.ParameterName, Target->GetActorLocation());
+		}
+	}
+}
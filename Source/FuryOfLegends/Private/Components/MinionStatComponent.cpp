@@ -27,76 +27,46 @@ void UMinionStatComponent::InitStatComponent(UDataTable* InStatTable)
 
     StatTable = InStatTable;
 
-    if (GetWorld())
-    {
-        AArenaGameState* GameState = Cast<AArenaGameState>(UGameplayStatics::GetGameState(GetWorld()));
-        if (GameState)
-        {
-            ElapsedTime = GameState->GetElapsedTime();
-            UpdateStatsBasedOnElapsedTime(ElapsedTime);
-        }
-    }
-}
-
-void UMinionStatComponent::UpdateStatsBasedOnElapsedTime(const float InElapsedTime)
-{
-    if (!StatTable)
-    {
-        UE_LOG(LogTemp, Error, TEXT("UMinionStatComponent::UpdateStatsBasedOnElapsedTime - StatTable is null"));
-        return;
-    }
-
     FStatTableRow* StatRow = StatTable->FindRow<FStatTableRow>(FName(*FString::FromInt(1)), TEXT(""));
     if (!StatRow)
     {
         return;
     }
 
-    TMap<FString, float> UniqueValues = StatRow->UniqueAttributes;
-
-    const float* HealthIncreasePtr = UniqueValues.Find("HealthIncreaseAmount");
-    const float* AdditionalIncreasePtr = UniqueValues.Find("AdditionalHealthAmount");
+    //    ̺   (׽Ʈ  )  ð ٷ մϴ.
+    AArenaGameState* GameState = GetWorld() ? Cast<AArenaGameState>(UGameplayStatics::GetGameState(GetWorld())) : nullptr;
+    ElapsedTime = GameState ? GameState->GetElapsedTime() : 0.f;
 
-    const float StartIncreaseTime = 165.0f; // 2:45 in seconds
-    const float MaxHealthLimit = 1300.0f;
-    const float Interval = 90.0f; // 90 seconds
-    const float InitialMaxHP = StatRow->MaxHP;
-    const float InitialAttackDamage = StatRow->AttackDamage;
-    const float BaseHealthIncrease = (HealthIncreasePtr != nullptr) ? *HealthIncreasePtr : 22.f;
-    const float AdditionalIncreasePerInterval = (AdditionalIncreasePtr != nullptr) ? *AdditionalIncreasePtr : 0.3f;
+    FMinionGrowthTable GrowthTable;
+    GrowthTable.Initialize(*StatRow);
 
-    const float BaseAttackIncrease = 5.0f; // Base attack increase amount
+    ApplyBaseStats(*StatRow, GrowthTable.EvaluateGrowthLevel(GrowthTable.Growth.GetGrowthLevel(ElapsedTime)));
+}
 
-    // ð  
-    float TimeSinceStart = FMath::Max(0.0f, ElapsedTime - StartIncreaseTime);
-    int IntervalsPassed = static_cast<int>(TimeSinceStart / Interval);
+void UMinionStatComponent::InitStatComponent(UDataTable* InStatTable, const FMinionGrowthTable& GrowthTable, int32 SpawnWave)
+{
+    StatTable = InStatTable;
 
-    // ü  
-    float TotalHealthIncrease = 0.0f;
-    float TotalAttackIncrease = 0.0f;
+    AArenaGameState* GameState = GetWorld() ? Cast<AArenaGameState>(UGameplayStatics::GetGameState(GetWorld())) : nullptr;
+    ElapsedTime = GameState ? GameState->GetElapsedTime() : 0.f;
 
-    for (int i = 0; i < IntervalsPassed; ++i)
-    {
-        TotalHealthIncrease += BaseHealthIncrease + (i * AdditionalIncreasePerInterval);
-        TotalAttackIncrease += BaseAttackIncrease;
-    }
-
-    //  ü° ݷ 
-    float CurrentMaxHealth = FMath::Min(InitialMaxHP + TotalHealthIncrease, MaxHealthLimit);
-    float CurrentAttackDamage = InitialAttackDamage + TotalAttackIncrease;
+    ApplyBaseStats(GrowthTable.BaseStats, GrowthTable.GetWaveStats(SpawnWave));
+}
 
+void UMinionStatComponent::ApplyBaseStats(const FStatTableRow& BaseStats, const FMinionWaveStats& WaveStats)
+{
     // ⺻  
-    BaseMaxHP = CurrentMaxHealth;
+    BaseMaxHP = WaveStats.MaxHP;
     BaseMaxMP = 0;
-    BaseHealthRegeneration = StatRow->HealthRegeneration;
-    BaseManaRegeneration = StatRow->ManaRegeneration;
-    BaseAttackDamage = CurrentAttackDamage;
-    BaseAbilityPower = StatRow->AbilityPower;
-    BaseDefensePower = StatRow->DefensePower;
-    BaseMagicResistance = StatRow->MagicResistance;
-    BaseAttackSpeed = StatRow->AttackSpeed;
-    BaseCriticalChance = StatRow->CriticalChance;
-    BaseMovementSpeed = StatRow->MovementSpeed;
+    BaseHealthRegeneration = BaseStats.HealthRegeneration;
+    BaseManaRegeneration = BaseStats.ManaRegeneration;
+    BaseAttackDamage = WaveStats.AttackDamage;
+    BaseAbilityPower = BaseStats.AbilityPower;
+    BaseDefensePower = BaseStats.DefensePower;
+    BaseMagicResistance = BaseStats.MagicResistance;
+    BaseAttackSpeed = BaseStats.AttackSpeed;
+    BaseCriticalChance = BaseStats.CriticalChance;
+    BaseMovementSpeed = BaseStats.MovementSpeed;
 
     //  氪 ʱȭ   0̾ մϴ.
     AccumulatedFlatMaxHP = 0;
@@ -113,4 +83,3 @@ void UMinionStatComponent::UpdateStatsBasedOnElapsedTime(const float InElapsedTi
 
     RecalculateStats();
 }
-
@@ -0,0 +1,397 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/PeriodicEffectComponent.h"
+#include "Components/StatComponent.h"
+#include "Characters/CharacterBase.h"
+#include "Game/ArenaPlayerState.h"
+#include "GameFramework/GameStateBase.h"
+#include "Structs/CustomCombatData.h"
+#include "Net/UnrealNetwork.h"
+#include "TimerManager.h"
+
+
+UPeriodicEffectComponent::UPeriodicEffectComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	bWantsInitializeComponent = false;
+
+	SetIsReplicatedByDefault(true);
+}
+
+void UPeriodicEffectComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	DOREPLIFETIME_CONDITION(ThisClass, ReplicatedEffects, COND_OwnerOnly);
+}
+
+void UPeriodicEffectComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(ProcessTimerHandle);
+		World->GetTimerManager().ClearTimer(DisplayTimerHandle);
+	}
+
+	ActiveEffects.Empty();
+	NotifiedStacks.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UPeriodicEffectComponent::AddEffect(const FPeriodicEffectSpec& Spec)
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return false;
+	}
+
+	if (Spec.Duration <= 0.f)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Ignored effect %u with non-positive duration."), ANSI_TO_TCHAR(__FUNCTION__), Spec.SourceCode);
+		return false;
+	}
+
+	const float Now = GetServerTime();
+	const int32 MaxStacks = FMath::Max(Spec.MaxStacks, 1);
+
+	FPeriodicEffect* Existing = ActiveEffects.FindByPredicate([&Spec](const FPeriodicEffect& Effect) { return Effect.Spec.SourceCode == Spec.SourceCode; });
+	if (Existing)
+	{
+		switch (Spec.Stacking)
+		{
+		case EPeriodicEffectStacking::Queue:
+			// 대기 중첩만 늘리고, 진행 중인 효과는 그대로 둡니다.
+			if (Existing->Stacks >= MaxStacks)
+			{
+				return false;
+			}
+			Existing->Stacks++;
+			break;
+
+		case EPeriodicEffectStacking::Intensify:
+			Existing->Spec = Spec;
+			Existing->Stacks = FMath::Min(Existing->Stacks + 1, MaxStacks);
+			StartApplication(*Existing, Now);
+			break;
+
+		case EPeriodicEffectStacking::Refresh:
+		default:
+			Existing->Spec = Spec;
+			StartApplication(*Existing, Now);
+			break;
+		}
+	}
+	else
+	{
+		FPeriodicEffect& NewEffect = ActiveEffects.AddDefaulted_GetRef();
+		NewEffect.Spec = Spec;
+		NewEffect.Stacks = 1;
+		StartApplication(NewEffect, Now);
+	}
+
+	SyncReplicatedEffects();
+	UpdateProcessTimer();
+	return true;
+}
+
+void UPeriodicEffectComponent::RemoveEffect(const uint32 SourceCode)
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	const int32 Removed = ActiveEffects.RemoveAllSwap([SourceCode](const FPeriodicEffect& Effect) { return Effect.Spec.SourceCode == SourceCode; });
+	if (Removed == 0)
+	{
+		return;
+	}
+
+	OnEffectRemoved.Broadcast(SourceCode);
+
+	SyncReplicatedEffects();
+	UpdateProcessTimer();
+}
+
+void UPeriodicEffectComponent::ClearEffects()
+{
+	if (GetOwnerRole() != ROLE_Authority || ActiveEffects.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FPeriodicEffect> RemovedEffects = MoveTemp(ActiveEffects);
+	ActiveEffects.Reset();
+
+	for (const FPeriodicEffect& Effect : RemovedEffects)
+	{
+		OnEffectRemoved.Broadcast(Effect.Spec.SourceCode);
+	}
+
+	SyncReplicatedEffects();
+	UpdateProcessTimer();
+}
+
+int32 UPeriodicEffectComponent::GetStacks(const uint32 SourceCode) const
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		const FPeriodicEffect* Effect = ActiveEffects.FindByPredicate([SourceCode](const FPeriodicEffect& Element) { return Element.Spec.SourceCode == SourceCode; });
+		return Effect ? Effect->Stacks : 0;
+	}
+
+	const FPeriodicEffectTimer* Timer = ReplicatedEffects.FindByPredicate([SourceCode](const FPeriodicEffectTimer& Element) { return Element.SourceCode == SourceCode; });
+	return Timer ? Timer->Stacks : 0;
+}
+
+void UPeriodicEffectComponent::StartApplication(FPeriodicEffect& Effect, const float Now) const
+{
+	Effect.StartTime = Now;
+	Effect.EndTime = Now + Effect.Spec.Duration;
+
+	if (Effect.Spec.Type == EPeriodicEffectType::Buff || Effect.Spec.TickInterval <= 0.f)
+	{
+		Effect.RemainingTicks = 0;
+		Effect.NextTickTime = Effect.EndTime;
+		return;
+	}
+
+	// 마지막 틱은 지속 시간이 끝나는 시점에 맞춥니다.
+	Effect.RemainingTicks = FMath::Max(FMath::CeilToInt(Effect.Spec.Duration / Effect.Spec.TickInterval), 1);
+	Effect.NextTickTime = FMath::Min(Now + Effect.Spec.TickInterval, Effect.EndTime);
+}
+
+void UPeriodicEffectComponent::ProcessEffects()
+{
+	const float Now = GetServerTime();
+	bool bChanged = false;
+
+	// 만료 알림은 순회가 끝난 뒤에 보냅니다. 수신 측에서 효과를 다시 걸 수 있기 때문입니다.
+	TArray<uint32, TInlineAllocator<4>> ExpiredSourceCodes;
+
+	for (int32 Index = ActiveEffects.Num() - 1; Index >= 0; --Index)
+	{
+		FPeriodicEffect& Effect = ActiveEffects[Index];
+
+		// 처리 간격보다 짧은 틱도 밀린 만큼 모두 적용합니다.
+		while (Effect.RemainingTicks > 0 && Now >= Effect.NextTickTime)
+		{
+			ApplyTick(Effect);
+			--Effect.RemainingTicks;
+			Effect.NextTickTime = FMath::Min(Effect.NextTickTime + Effect.Spec.TickInterval, Effect.EndTime);
+		}
+
+		if (Effect.RemainingTicks > 0 || Now < Effect.EndTime)
+		{
+			continue;
+		}
+
+		// 대기 중인 중첩이 있으면 다음 효과를 이어서 시작합니다.
+		if (Effect.Spec.Stacking == EPeriodicEffectStacking::Queue && Effect.Stacks > 1)
+		{
+			Effect.Stacks--;
+			StartApplication(Effect, Now);
+		}
+		else
+		{
+			ExpiredSourceCodes.Add(Effect.Spec.SourceCode);
+			ActiveEffects.RemoveAtSwap(Index);
+		}
+
+		bChanged = true;
+	}
+
+	if (bChanged)
+	{
+		SyncReplicatedEffects();
+		UpdateProcessTimer();
+	}
+
+	for (const uint32 SourceCode : ExpiredSourceCodes)
+	{
+		OnEffectRemoved.Broadcast(SourceCode);
+	}
+}
+
+void UPeriodicEffectComponent::ApplyTick(const FPeriodicEffect& Effect) const
+{
+	ACharacterBase* Character = Cast<ACharacterBase>(GetOwner());
+	if (::IsValid(Character) == false)
+	{
+		return;
+	}
+
+	const float Multiplier = Effect.Spec.Stacking == EPeriodicEffectStacking::Intensify ? static_cast<float>(Effect.Stacks) : 1.f;
+	const float Amount = Effect.Spec.AmountPerTick * Multiplier;
+
+	switch (Effect.Spec.Type)
+	{
+	case EPeriodicEffectType::Heal:
+		if (UStatComponent* StatComponent = Character->GetStatComponent())
+		{
+			StatComponent->ModifyCurrentHP(Amount);
+		}
+		break;
+
+	case EPeriodicEffectType::Mana:
+		if (UStatComponent* StatComponent = Character->GetStatComponent())
+		{
+			StatComponent->ModifyCurrentMP(Amount);
+		}
+		break;
+
+	case EPeriodicEffectType::Damage:
+	{
+		ACharacterBase* Instigator = Cast<ACharacterBase>(Effect.Spec.Instigator.Get());
+		if (::IsValid(Instigator) == false)
+		{
+			break;
+		}
+
+		FDamageInformation DamageInformation;
+		DamageInformation.AddMagicDamage(Amount);
+		Instigator->ServerApplyDamage(Character, Instigator, Instigator->GetController(), DamageInformation);
+		break;
+	}
+
+	case EPeriodicEffectType::Buff:
+	default:
+		break;
+	}
+}
+
+void UPeriodicEffectComponent::UpdateProcessTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	const bool bActive = TimerManager.IsTimerActive(ProcessTimerHandle);
+
+	if (ActiveEffects.Num() > 0 && !bActive)
+	{
+		TimerManager.SetTimer(ProcessTimerHandle, this, &UPeriodicEffectComponent::ProcessEffects, ProcessInterval, true);
+	}
+	else if (ActiveEffects.Num() == 0 && bActive)
+	{
+		TimerManager.ClearTimer(ProcessTimerHandle);
+	}
+}
+
+void UPeriodicEffectComponent::SyncReplicatedEffects()
+{
+	ReplicatedEffects.Reset(ActiveEffects.Num());
+
+	for (const FPeriodicEffect& Effect : ActiveEffects)
+	{
+		FPeriodicEffectTimer& Timer = ReplicatedEffects.AddDefaulted_GetRef();
+		Timer.SourceCode = Effect.Spec.SourceCode;
+		Timer.StartTime = Effect.StartTime;
+		Timer.EndTime = Effect.EndTime;
+		Timer.Stacks = Effect.Stacks;
+	}
+
+	// 리슨 서버 호스트는 복제를 받지 않으므로 직접 갱신합니다.
+	if (IsOwnerLocallyControlled())
+	{
+		OnRep_ReplicatedEffects();
+	}
+}
+
+void UPeriodicEffectComponent::OnRep_ReplicatedEffects()
+{
+	AArenaPlayerState* PlayerState = GetOwnerPlayerState();
+
+	// 중첩 수가 바뀐 효과만 HUD 에 알립니다.
+	TMap<uint32, int32> CurrentStacks;
+	CurrentStacks.Reserve(ReplicatedEffects.Num());
+
+	for (const FPeriodicEffectTimer& Timer : ReplicatedEffects)
+	{
+		CurrentStacks.Add(Timer.SourceCode, Timer.Stacks);
+
+		const int32* PreviousStacks = NotifiedStacks.Find(Timer.SourceCode);
+		if (PlayerState && (!PreviousStacks || *PreviousStacks != Timer.Stacks))
+		{
+			PlayerState->OnTimerUpdated.Broadcast(Timer.SourceCode, Timer.Stacks);
+		}
+	}
+
+	for (const TPair<uint32, int32>& Previous : NotifiedStacks)
+	{
+		if (PlayerState && !CurrentStacks.Contains(Previous.Key))
+		{
+			PlayerState->OnTimerUpdated.Broadcast(Previous.Key, 0);
+			PlayerState->OnRemainingTimeChanged.Broadcast(Previous.Key, 0.f, 0.f);
+		}
+	}
+
+	NotifiedStacks = MoveTemp(CurrentStacks);
+
+	BroadcastRemainingTimes();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (ReplicatedEffects.Num() > 0)
+	{
+		if (!TimerManager.IsTimerActive(DisplayTimerHandle))
+		{
+			TimerManager.SetTimer(DisplayTimerHandle, this, &UPeriodicEffectComponent::BroadcastRemainingTimes, DisplayInterval, true);
+		}
+	}
+	else
+	{
+		TimerManager.ClearTimer(DisplayTimerHandle);
+	}
+}
+
+void UPeriodicEffectComponent::BroadcastRemainingTimes()
+{
+	AArenaPlayerState* PlayerState = GetOwnerPlayerState();
+	if (!PlayerState || !PlayerState->OnRemainingTimeChanged.IsBound())
+	{
+		return;
+	}
+
+	const float Now = GetServerTime();
+	for (const FPeriodicEffectTimer& Timer : ReplicatedEffects)
+	{
+		const float RemainingTime = FMath::Max(0.f, Timer.EndTime - Now);
+		const float ElapsedTime = FMath::Clamp(Now - Timer.StartTime, 0.f, Timer.EndTime - Timer.StartTime);
+		PlayerState->OnRemainingTimeChanged.Broadcast(Timer.SourceCode, RemainingTime, ElapsedTime);
+	}
+}
+
+float UPeriodicEffectComponent::GetServerTime() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+AArenaPlayerState* UPeriodicEffectComponent::GetOwnerPlayerState() const
+{
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	return OwnerPawn ? OwnerPawn->GetPlayerState<AArenaPlayerState>() : nullptr;
+}
+
+bool UPeriodicEffectComponent::IsOwnerLocallyControlled() const
+{
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	return OwnerPawn && OwnerPawn->IsLocallyControlled();
+}
@@ -3,14 +3,44 @@
 #include "Game/AOSGameInstance.h"
 #include "Game/ArenaPlayerState.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/GameStateBase.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/Engine.h"
+#include "TimerManager.h"
 #include "Structs/CharacterStatData.h"
 
 
+namespace
+{
+	//  ð     . ִġ  ʽϴ.
+	float ExtrapolateRegeneration(float Value, float MaxValue, float Rate, float AnchorTime, float Now)
+	{
+		if (AnchorTime < 0.f || Rate <= 0.f || Value >= MaxValue)
+		{
+			return Value;
+		}
+
+		return FMath::Min(MaxValue, Value + Rate * FMath::Max(0.f, Now - AnchorTime));
+	}
+
+	// ִġ    ð.   ƴϰų ̹ ִġ ȮǾ  Դϴ.
+	float GetSecondsUntilSaturated(float Value, float MaxValue, float Rate, float AnchorTime, float Now)
+	{
+		if (AnchorTime < 0.f || Rate <= 0.f || Value >= MaxValue)
+		{
+			return -1.f;
+		}
+
+		return FMath::Max(0.f, (MaxValue - Value) / Rate - FMath::Max(0.f, Now - AnchorTime));
+	}
+}
+
+
 UStatComponent::UStatComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// ƽ Ŭ̾Ʈ   ٸ   մϴ.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	bWantsInitializeComponent = false;
 
 	CurrentLevel = 1;
@@ -21,6 +51,8 @@ void UStatComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	SetComponentTickInterval(RegenerationDisplayInterval);
+
 }
 
 void UStatComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -130,6 +162,8 @@ void UStatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME(ThisClass, CurrentLevel);
 	DOREPLIFETIME(ThisClass, HealthRegeneration);
 	DOREPLIFETIME(ThisClass, ManaRegeneration);
+	DOREPLIFETIME(ThisClass, HealthRegenAnchorTime);
+	DOREPLIFETIME(ThisClass, ManaRegenAnchorTime);
 	DOREPLIFETIME(ThisClass, AttackDamage);
 	DOREPLIFETIME(ThisClass, AbilityPower);
 	DOREPLIFETIME(ThisClass, DefensePower);
@@ -155,22 +189,214 @@ void UStatComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME(ThisClass, BaseCriticalChance);
 }
 
+void UStatComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	//    ÿ  UI  ˸ϴ. Ʈũδ ƹ͵  ʽϴ.
+	const float NewHP = GetCurrentHP();
+	if (FMath::IsNearlyEqual(NewHP, DisplayedHP) == false && OnCurrentHPChanged.IsBound())
+	{
+		OnCurrentHPChanged.Broadcast(DisplayedHP, NewHP);
+	}
+	DisplayedHP = NewHP;
+
+	const float NewMP = GetCurrentMP();
+	if (FMath::IsNearlyEqual(NewMP, DisplayedMP) == false && OnCurrentMPChanged.IsBound())
+	{
+		OnCurrentMPChanged.Broadcast(DisplayedMP, NewMP);
+	}
+	DisplayedMP = NewMP;
+}
+
+float UStatComponent::GetCurrentHP() const
+{
+	if (HealthRegenAnchorTime < 0.f)
+	{
+		return CurrentHP;
+	}
+
+	return ExtrapolateRegeneration(CurrentHP, MaxHP, HealthRegeneration, HealthRegenAnchorTime, GetServerWorldTime());
+}
+
+float UStatComponent::GetCurrentMP() const
+{
+	if (ManaRegenAnchorTime < 0.f)
+	{
+		return CurrentMP;
+	}
+
+	return ExtrapolateRegeneration(CurrentMP, MaxMP, ManaRegeneration, ManaRegenAnchorTime, GetServerWorldTime());
+}
+
+void UStatComponent::MaterializeHealth()
+{
+	if (HealthRegenAnchorTime < 0.f)
+	{
+		return;
+	}
+
+	const float Now = GetServerWorldTime();
+	CurrentHP = ExtrapolateRegeneration(CurrentHP, MaxHP, HealthRegeneration, HealthRegenAnchorTime, Now);
+	HealthRegenAnchorTime = Now;
+}
+
+void UStatComponent::MaterializeMana()
+{
+	if (ManaRegenAnchorTime < 0.f)
+	{
+		return;
+	}
+
+	const float Now = GetServerWorldTime();
+	CurrentMP = ExtrapolateRegeneration(CurrentMP, MaxMP, ManaRegeneration, ManaRegenAnchorTime, Now);
+	ManaRegenAnchorTime = Now;
+}
+
+void UStatComponent::SetHealthRegenerationActive(bool bActive)
+{
+	if (GetOwnerRole() != ROLE_Authority || IsHealthRegenerationActive() == bActive)
+	{
+		return;
+	}
+
+	//   ݱ   尪 ϴ.
+	MaterializeHealth();
+	HealthRegenAnchorTime = bActive ? GetServerWorldTime() : -1.f;
+	UpdateRegenerationTick();
+	UpdateHealthFullTimer();
+}
+
+void UStatComponent::SetManaRegenerationActive(bool bActive)
+{
+	if (GetOwnerRole() != ROLE_Authority || IsManaRegenerationActive() == bActive)
+	{
+		return;
+	}
+
+	MaterializeMana();
+	ManaRegenAnchorTime = bActive ? GetServerWorldTime() : -1.f;
+	UpdateRegenerationTick();
+	UpdateManaFullTimer();
+}
+
+void UStatComponent::UpdateHealthFullTimer()
+{
+	UWorld* World = GetWorld();
+	if (GetOwnerRole() != ROLE_Authority || !World)
+	{
+		return;
+	}
+
+	const float Delay = GetSecondsUntilSaturated(CurrentHP, MaxHP, HealthRegeneration, HealthRegenAnchorTime, GetServerWorldTime());
+	if (Delay < 0.f)
+	{
+		World->GetTimerManager().ClearTimer(HealthFullTimerHandle);
+		return;
+	}
+
+	// Ÿ̸Ӵ 0   Ƿ ̹ á  ƽ óմϴ.
+	World->GetTimerManager().SetTimer(HealthFullTimerHandle, this, &ThisClass::OnHealthRegenerationSaturated, FMath::Max(Delay, KINDA_SMALL_NUMBER), false);
+}
+
+void UStatComponent::UpdateManaFullTimer()
+{
+	UWorld* World = GetWorld();
+	if (GetOwnerRole() != ROLE_Authority || !World)
+	{
+		return;
+	}
+
+	const float Delay = GetSecondsUntilSaturated(CurrentMP, MaxMP, ManaRegeneration, ManaRegenAnchorTime, GetServerWorldTime());
+	if (Delay < 0.f)
+	{
+		World->GetTimerManager().ClearTimer(ManaFullTimerHandle);
+		return;
+	}
+
+	World->GetTimerManager().SetTimer(ManaFullTimerHandle, this, &ThisClass::OnManaRegenerationSaturated, FMath::Max(Delay, KINDA_SMALL_NUMBER), false);
+}
+
+void UStatComponent::OnHealthRegenerationSaturated()
+{
+	//  Ȯϸ OnHealthFull   ߰  ð ϴ.
+	if (IsHealthRegenerationActive())
+	{
+		SetCurrentHP(MaxHP);
+	}
+}
+
+void UStatComponent::OnManaRegenerationSaturated()
+{
+	if (IsManaRegenerationActive())
+	{
+		SetCurrentMP(MaxMP);
+	}
+}
+
+void UStatComponent::UpdateRegenerationTick()
+{
+	// Ƽ  ٸ ׸ Ƿ ƽ ʿ ϴ.
+	if (GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	const bool bRegenerating = IsHealthRegenerationActive() || IsManaRegenerationActive();
+	if (bRegenerating && IsComponentTickEnabled() == false)
+	{
+		DisplayedHP = GetCurrentHP();
+		DisplayedMP = GetCurrentMP();
+	}
+
+	SetComponentTickEnabled(bRegenerating);
+}
+
+float UStatComponent::GetServerWorldTime() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void UStatComponent::OnRep_RegenerationAnchor()
+{
+	UpdateRegenerationTick();
+}
+
 #pragma region Setter
 
 void UStatComponent::SetMaxHP(float InMaxHP)
 {
+	// ִġ ٲ   ݿؾ  ұ  ʽϴ.
+	MaterializeHealth();
+
 	float NewMaxHP = FMath::Clamp(InMaxHP, 0.0f, 99999.f);
 
 	OnMaxHPChanged_NetMulticast(MaxHP, NewMaxHP);
 	MaxHP = NewMaxHP;
+
+	UpdateHealthFullTimer();
 }
 
 void UStatComponent::SetCurrentHP(float InCurrentHP)
 {
 	float NewCurrentHP = FMath::Clamp<float>(InCurrentHP, 0, MaxHP);
-	OnCurrentHPChanged_NetMulticast(CurrentHP, NewCurrentHP);
+	OnCurrentHPChanged_NetMulticast(GetCurrentHP(), NewCurrentHP);
 	CurrentHP = NewCurrentHP;
 
+	//  ̸      ˴ϴ.
+	if (IsHealthRegenerationActive())
+	{
+		HealthRegenAnchorTime = GetServerWorldTime();
+	}
+	UpdateHealthFullTimer();
+
 	if (CurrentHP < KINDA_SMALL_NUMBER)
 	{
 		OnOutOfCurrentHP_NetMulticast();
@@ -190,18 +416,28 @@ void UStatComponent::SetCurrentHP(float InCurrentHP)
 
 void UStatComponent::SetMaxMP(float InMaxMP)
 {
+	MaterializeMana();
+
 	float NewMaxMP = FMath::Clamp(InMaxMP, 0.0f, 99999.f); // MaxMaxMP ʿ  
 
 	OnMaxMPChanged_NetMulticast(MaxMP, NewMaxMP);
 	MaxMP = NewMaxMP;
+
+	UpdateManaFullTimer();
 }
 
 void UStatComponent::SetCurrentMP(float InCurrentMP)
 {
 	float NewCurrentMP = FMath::Clamp<float>(InCurrentMP, 0, MaxMP);
-	OnCurrentMPChanged_NetMulticast(CurrentMP, NewCurrentMP);
+	OnCurrentMPChanged_NetMulticast(GetCurrentMP(), NewCurrentMP);
 	CurrentMP = NewCurrentMP;
 
+	if (IsManaRegenerationActive())
+	{
+		ManaRegenAnchorTime = GetServerWorldTime();
+	}
+	UpdateManaFullTimer();
+
 	if (CurrentMP != MaxMP && OnManaDepleted.IsBound())
 	{
 		OnManaDepleted.Broadcast();
@@ -292,8 +528,8 @@ void UStatComponent::SetCurrentLevel(int32 InCurrentLevel)
 		SetMovementSpeed(BaseMovementSpeed * (1.0f + AccumulatedPercentMovementSpeed / 100.0f) + AccumulatedFlatMovementSpeed);
 
 		//  HP MP  ִ밪 ° Ʈ
-		SetCurrentHP(CurrentHP + (BaseMaxHP- OldMaxHP));
-		SetCurrentMP(CurrentMP + (BaseMaxMP - OldMaxMP));
+		SetCurrentHP(GetCurrentHP() + (BaseMaxHP- OldMaxHP));
+		SetCurrentMP(GetCurrentMP() + (BaseMaxMP - OldMaxMP));
 
 		// ġ   Ʈ
 		SetMaxEXP(NewLevelStatRow->MaxEXP);
@@ -305,16 +541,25 @@ void UStatComponent::SetCurrentLevel(int32 InCurrentLevel)
 
 void UStatComponent::SetHealthRegeneration(float InHealthRegeneration)
 {
+	//  ٲ     ݿմϴ.
+	MaterializeHealth();
+
 	float NewHealthRegeneration = FMath::Clamp<float>(InHealthRegeneration, 0, 9999.f);
 	OnHealthRegenerationChanged_NetMulticast(HealthRegeneration, NewHealthRegeneration);
 	HealthRegeneration = NewHealthRegeneration;
+
+	UpdateHealthFullTimer();
 }
 
 void UStatComponent::SetManaRegeneration(float InManaRegeneration)
 {
+	MaterializeMana();
+
 	float NewManaRegeneration = FMath::Clamp<float>(InManaRegeneration, 0, 9999.f);
 	OnManaRegenerationChanged_NetMulticast(ManaRegeneration, NewManaRegeneration);
 	ManaRegeneration = NewManaRegeneration;
+
+	UpdateManaFullTimer();
 }
 
 void UStatComponent::SetAttackDamage(float InAttackDamage)
@@ -380,12 +625,12 @@ void UStatComponent::SetMovementSpeed(float InMovementSpeed)
 
 void UStatComponent::ModifyCurrentHP(float Delta)
 {
-	SetCurrentHP(CurrentHP + Delta);
+	SetCurrentHP(GetCurrentHP() + Delta);
 }
 
 void UStatComponent::ModifyCurrentMP(float Delta)
 {
-	SetCurrentMP(CurrentMP + Delta);
+	SetCurrentMP(GetCurrentMP() + Delta);
 }
 
 void UStatComponent::ModifyCurrentEXP(float Delta)
@@ -541,6 +786,8 @@ void UStatComponent::OnMaxHPChanged_NetMulticast_Implementation(float InOldMaxHP
 
 void UStatComponent::OnCurrentHPChanged_NetMulticast_Implementation(float InOldCurrentHP, float InNewCurrentHP)
 {
+	DisplayedHP = InNewCurrentHP;
+
 	if (OnCurrentHPChanged.IsBound())
 	{
 		OnCurrentHPChanged.Broadcast(InOldCurrentHP, InNewCurrentHP);
@@ -557,6 +804,8 @@ void UStatComponent::OnMaxMPChanged_NetMulticast_Implementation(float InOldMaxMP
 
 void UStatComponent::OnCurrentMPChanged_NetMulticast_Implementation(float InOldCurrentMP, float InNewCurrentMP)
 {
+	DisplayedMP = InNewCurrentMP;
+
 	if (OnCurrentMPChanged.IsBound())
 	{
 		OnCurrentMPChanged.Broadcast(InOldCurrentMP, InNewCurrentMP);
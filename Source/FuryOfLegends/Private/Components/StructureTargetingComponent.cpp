@@ -0,0 +1,236 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Components/StructureTargetingComponent.h"
+#include "Characters/CharacterBase.h"
+#include "Characters/MinionBase.h"
+#include "Structs/CustomCombatData.h"
+#include "Algo/BinarySearch.h"
+
+
+UStructureTargetingComponent::UStructureTargetingComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+	bWantsInitializeComponent = false;
+}
+
+void UStructureTargetingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+bool UStructureTargetingComponent::AddCharacter(ACharacterBase* Character)
+{
+	const ACharacterBase* OwnerCharacter = Cast<ACharacterBase>(GetOwner());
+	if (::IsValid(Character) == false || ::IsValid(OwnerCharacter) == false || Character == OwnerCharacter)
+	{
+		return false;
+	}
+
+	// 아군 챔피언은 공격받는지만 감시합니다.
+	if (Character->TeamSide == OwnerCharacter->TeamSide)
+	{
+		if (EnumHasAnyFlags(Character->ObjectType, EObjectType::Player) && AlliesInRange.Contains(Character) == false)
+		{
+			AlliesInRange.Add(Character, Character);
+			Character->OnPostReceiveDamageEvent.AddUniqueDynamic(this, &UStructureTargetingComponent::OnAllyDamaged);
+		}
+		return false;
+	}
+
+	if (EnemyPriorities.Contains(Character))
+	{
+		return true;
+	}
+
+	EStructureTargetPriority Priority;
+	if (ClassifyEnemy(Character, Priority) == false)
+	{
+		return false;
+	}
+
+	const int32 BucketIndex = static_cast<int32>(Priority);
+	TArray<FStructureTargetCandidate>& Bucket = Buckets[BucketIndex];
+
+	FStructureTargetCandidate Candidate;
+	Candidate.Character = Character;
+	Candidate.Key = Character;
+	Candidate.EntryDistanceSquared = FVector::DistSquared(Character->GetActorLocation(), OwnerCharacter->GetActorLocation());
+
+	const int32 InsertIndex = Algo::UpperBoundBy(Bucket, Candidate.EntryDistanceSquared, &FStructureTargetCandidate::EntryDistanceSquared);
+	Bucket.Insert(Candidate, InsertIndex);
+
+	EnemyPriorities.Add(Character, Priority);
+	NonEmptyBucketMask |= (1u << BucketIndex);
+	return true;
+}
+
+void UStructureTargetingComponent::RemoveCharacter(ACharacterBase* Character)
+{
+	if (!Character)
+	{
+		return;
+	}
+
+	EStructureTargetPriority Priority;
+	if (EnemyPriorities.RemoveAndCopyValue(Character, Priority))
+	{
+		RemoveFromBucket(Character, Priority);
+	}
+
+	if (AlliesInRange.Remove(Character) > 0)
+	{
+		UnbindAlly(Character);
+	}
+}
+
+void UStructureTargetingComponent::Reset()
+{
+	for (const TPair<TObjectKey<ACharacterBase>, TWeakObjectPtr<ACharacterBase>>& Ally : AlliesInRange)
+	{
+		UnbindAlly(Ally.Value.Get());
+	}
+
+	for (TArray<FStructureTargetCandidate>& Bucket : Buckets)
+	{
+		Bucket.Reset();
+	}
+
+	NonEmptyBucketMask = 0;
+	EnemyPriorities.Reset();
+	AlliesInRange.Reset();
+}
+
+ACharacterBase* UStructureTargetingComponent::SelectTarget()
+{
+	while (NonEmptyBucketMask != 0)
+	{
+		const int32 BucketIndex = static_cast<int32>(FMath::CountTrailingZeros(NonEmptyBucketMask));
+		TArray<FStructureTargetCandidate>& Bucket = Buckets[BucketIndex];
+
+		ACharacterBase* Candidate = Bucket[0].Character.Get();
+		if (IsTargetable(Candidate))
+		{
+			return Candidate;
+		}
+
+		// 이탈 이벤트 없이 사라졌거나 죽은 후보. 맨 앞에서만 지우므로 선택 비용은 상수로 유지됩니다.
+		EnemyPriorities.Remove(Bucket[0].Key);
+		Bucket.RemoveAt(0, 1, EAllowShrinking::No);
+		if (Bucket.Num() == 0)
+		{
+			NonEmptyBucketMask &= ~(1u << BucketIndex);
+		}
+	}
+
+	return nullptr;
+}
+
+bool UStructureTargetingComponent::IsEnemyInRange(const ACharacterBase* Character) const
+{
+	return Character && EnemyPriorities.Contains(Character);
+}
+
+bool UStructureTargetingComponent::IsAllyInRange(const ACharacterBase* Character) const
+{
+	return Character && AlliesInRange.Contains(Character);
+}
+
+void UStructureTargetingComponent::OnAllyDamaged(AActor* DamageReceiver, AActor* DamageCauser, AController* InstigatorActor, FDamageInformation& DamageInformation)
+{
+	const ACharacterBase* Ally = Cast<ACharacterBase>(DamageReceiver);
+	ACharacterBase* Attacker = Cast<ACharacterBase>(DamageCauser);
+	if (!Ally || !Attacker)
+	{
+		return;
+	}
+
+	// 사거리 안의 아군 챔피언을 사거리 안의 적 챔피언이 공격한 경우에만 대상을 바꿉니다.
+	if (IsAllyInRange(Ally) == false || IsEnemyInRange(Attacker) == false)
+	{
+		return;
+	}
+
+	if (EnumHasAnyFlags(Attacker->ObjectType, EObjectType::Player) == false)
+	{
+		return;
+	}
+
+	OnAggroTargetRequested.Broadcast(Attacker);
+}
+
+bool UStructureTargetingComponent::ClassifyEnemy(const ACharacterBase* Character, EStructureTargetPriority& OutPriority) const
+{
+	if (EnumHasAnyFlags(Character->ObjectType, EObjectType::Minion))
+	{
+		const AMinionBase* Minion = Cast<AMinionBase>(Character);
+		if (!Minion)
+		{
+			return false;
+		}
+
+		static const FName SuperName(TEXT("Super"));
+		static const FName MeleeName(TEXT("Melee"));
+		static const FName RangedName(TEXT("Ranged"));
+
+		const FName MinionName = Minion->GetCharacterName();
+		if (MinionName == SuperName)
+		{
+			OutPriority = EStructureTargetPriority::SuperMinion;
+			return true;
+		}
+		if (MinionName == MeleeName)
+		{
+			OutPriority = EStructureTargetPriority::MeleeMinion;
+			return true;
+		}
+		if (MinionName == RangedName)
+		{
+			OutPriority = EStructureTargetPriority::RangedMinion;
+			return true;
+		}
+		return false;
+	}
+
+	if (EnumHasAnyFlags(Character->ObjectType, EObjectType::Player))
+	{
+		OutPriority = EStructureTargetPriority::Champion;
+		return true;
+	}
+
+	return false;
+}
+
+bool UStructureTargetingComponent::IsTargetable(const ACharacterBase* Character) const
+{
+	return ::IsValid(Character) && EnumHasAnyFlags(Character->CharacterState, ECharacterState::Death) == false;
+}
+
+void UStructureTargetingComponent::RemoveFromBucket(ACharacterBase* Character, EStructureTargetPriority Priority)
+{
+	const int32 BucketIndex = static_cast<int32>(Priority);
+	TArray<FStructureTargetCandidate>& Bucket = Buckets[BucketIndex];
+
+	const TObjectKey<ACharacterBase> Key(Character);
+	const int32 Index = Bucket.IndexOfByPredicate([&Key](const FStructureTargetCandidate& Candidate) { return Candidate.Key == Key; });
+	if (Index != INDEX_NONE)
+	{
+		// 순서를 유지해야 하므로 Swap 제거를 쓰지 않습니다.
+		Bucket.RemoveAt(Index, 1, EAllowShrinking::No);
+	}
+
+	if (Bucket.Num() == 0)
+	{
+		NonEmptyBucketMask &= ~(1u << BucketIndex);
+	}
+}
+
+void UStructureTargetingComponent::UnbindAlly(ACharacterBase* Ally)
+{
+	if (::IsValid(Ally))
+	{
+		Ally->OnPostReceiveDamageEvent.RemoveDynamic(this, &UStructureTargetingComponent::OnAllyDamaged);
+	}
+}
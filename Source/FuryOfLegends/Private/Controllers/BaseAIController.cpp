@@ -1,5 +1,6 @@
 #include "Controllers/BaseAIController.h"
 #include "Characters/CharacterBase.h"
+#include "Game/ArenaSignificanceSubsystem.h"
 #include "BehaviorTree/BehaviorTree.h"
 #include "BehaviorTree/BlackboardData.h"
 #include "BehaviorTree/BlackboardComponent.h"
@@ -22,6 +23,8 @@ ABaseAIController::ABaseAIController()
 {
 	Blackboard = CreateDefaultSubobject<UBlackboardComponent>(TEXT("BlackBoard"));
 	BrainComponent = CreateDefaultSubobject<UBehaviorTreeComponent>(TEXT("BrainComponent"));
+
+	ServiceIntervalScale = 1.f;
 }
 
 void ABaseAIController::BeginPlay()
@@ -68,5 +71,18 @@ void ABaseAIController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
 
+	// 빙의 전에 이미 평가된 중요도 단계를 반영
+	ACharacterBase* Character = Cast<ACharacterBase>(InPawn);
+	UArenaSignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UArenaSignificanceSubsystem>();
+	if (::IsValid(Character) && SignificanceSubsystem)
+	{
+		SetServiceIntervalScale(SignificanceSubsystem->GetTierSettings(Character->GetSignificanceTier()).AIServiceIntervalScale);
+	}
+
 	BeginAI(InPawn);
-}
\ No newline at end of file
+}
+
+void ABaseAIController::SetServiceIntervalScale(float InScale)
+{
+	ServiceIntervalScale = FMath::Max(InScale, 0.1f);
+}
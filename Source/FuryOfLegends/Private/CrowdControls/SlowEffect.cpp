@@ -6,6 +6,7 @@
 #include "Components/StatComponent.h"
 #include "CrowdControls/CrowdControlManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Plugins/GameLogger.h"
 
 void USlowEffect::ApplyEffect(ACharacter* InTarget, const float InDuration, const float InPercent)
 {
@@ -172,7 +173,7 @@ void USlowEffect::ReturnEffect()
     // ActiveEffects ȿ 
     if (Character->ActiveEffects.Remove(ECrowdControl::Slow) > 0)
     {
-        UE_LOG(LogTemp, Log, TEXT("Removed Stun effect from ActiveEffects."));
+        GAME_LOG(LogArenaCombat, Verbose, TEXT("Removed Slow effect from ActiveEffects."));
     }
     else
     {
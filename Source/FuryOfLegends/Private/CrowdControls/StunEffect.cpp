@@ -9,6 +9,7 @@
 #include "Components/ActionStatComponent.h"
 #include "CrowdControls/CrowdControlManager.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Plugins/GameLogger.h"
 
 
 void UStunEffect::ApplyEffect(ACharacter* InTarget, const float InDuration, const float InPercent)
@@ -76,7 +77,7 @@ void UStunEffect::ApplyEffect(ACharacter* InTarget, const float InDuration, cons
 		ActionStatComponent->ClientNotifyActivationChanged(ActiveAbilityState->SlotID, false);
 		DisabledAbilities.Add(ActiveAbilityState);
 
-		UE_LOG(LogTemp, Log, TEXT("%s skill has been disabled due to Stun effect."), *ActiveAbilityState->Name.ToString());
+		GAME_LOG(LogArenaCombat, Verbose, TEXT("%s skill has been disabled due to Stun effect."), *ActiveAbilityState->Name.ToString());
 	}
 }
 
@@ -249,7 +250,7 @@ void UStunEffect::ReturnEffect()
 	// ActiveEffects ȿ 
 	if (Character->ActiveEffects.Remove(ECrowdControl::Stun) > 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Removed Stun effect from ActiveEffects."));
+		GAME_LOG(LogArenaCombat, Verbose, TEXT("Removed Stun effect from ActiveEffects."));
 	}
 	else
 	{
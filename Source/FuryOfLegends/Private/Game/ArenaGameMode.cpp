@@ -3,6 +3,8 @@
 #include "Game/ArenaGameState.h"
 #include "Game/ArenaPlayerState.h"
 #include "Game/PlayerStateSave.h"
+#include "Game/MinionWaveSpawner.h"
+#include "Game/MatchStartBarrier.h"
 #include "Characters/AOSCharacterBase.h"
 #include "Characters/MinionBase.h"
 #include "Controllers/AOSPlayerController.h"
@@ -17,10 +19,11 @@
 #include "CrowdControls/CrowdControlManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "Kismet/KismetMathLibrary.h"
-#include "Item/Item.h"
+#include "Item/ItemRegistry.h"
 #include "NavigationSystem.h"
 #include "Props/Nexus.h"
 #include "Plugins/UniqueCodeGenerator.h"
+#include "Algo/StableSort.h"
 
 
 AArenaGameMode::AArenaGameMode()
@@ -66,113 +69,23 @@ void AArenaGameMode::InitGame(const FString& MapName, const FString& Options, FS
 	LoadGameData();
 	LoadItemData();
 	LoadMinionData();
-}
-
-void AArenaGameMode::LoadItemData()
-{
-	if (!ItemTable)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed: ItemTable is not initialized."), ANSI_TO_TCHAR(__FUNCTION__));
-		return;
-	}
-
-	TArray<FItemTableRow*> Items;
-	ItemTable->GetAllRows<FItemTableRow>(TEXT("GENERAL"), Items);
-
-	LoadedItems.Empty();
-	LoadedItems.Shrink();
-	RequiredSubItems.Empty();
-
-	if (Items.Num() == 0)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] No items found in ItemDataTable."), ANSI_TO_TCHAR(__FUNCTION__));
-		return;
-	}
-
-	LoadedItems.Reserve(Items.Num());
-
-	for (const auto& ItemRow : Items)
-	{
-		if (!ItemRow)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid ItemRow."), ANSI_TO_TCHAR(__FUNCTION__));
-			continue;
-		}
-
-		if (!ItemRow->ItemClass)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid ItemClass for ItemCode: %d"), ANSI_TO_TCHAR(__FUNCTION__), ItemRow->ItemCode);
-			continue;
-		}
-
-		if (LoadedItems.Contains(ItemRow->ItemCode))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[%s] Duplicate ItemCode found: %d"), ANSI_TO_TCHAR(__FUNCTION__), ItemRow->ItemCode);
-			continue;
-		}
 
-		AItem* ItemInstance = NewObject<AItem>(this, ItemRow->ItemClass);
-		if (!ItemInstance)
-		{
-			UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create ItemInstance for ItemCode: %d, Class: %s"), ANSI_TO_TCHAR(__FUNCTION__), ItemRow->ItemCode, *ItemRow->ItemClass->GetName());
-			continue;
-		}
-
-		ItemInstance->ItemCode = ItemRow->ItemCode;
-		ItemInstance->Name = ItemRow->Name;
-		ItemInstance->Price = ItemRow->Price;
-		ItemInstance->Icon = ItemRow->Icon;
-		ItemInstance->Classification = ItemRow->Classification;
-		ItemInstance->Description = ItemRow->Description;
-		ItemInstance->MaxStackPerSlot = ItemRow->MaxStackPerSlot;
-		ItemInstance->MaxInventoryQuantity = ItemRow->MaxInventoryQuantity;
-		ItemInstance->MaxConcurrentUses = ItemRow->MaxConcurrentUses;
-		ItemInstance->StatModifiers = ItemRow->StatModifiers;
-		ItemInstance->UniqueAttributes = ItemRow->UniqueAttributes;
-		ItemInstance->RequiredItems = ItemRow->RequiredItems;
-		ItemInstance->Initialize();
-
-		// 새로운 아이템을 LoadedItems에 추가 후 하위 아이템을 재귀적으로 추가.
-		LoadedItems.Add(ItemInstance->ItemCode, ItemInstance);
-		GenerateSubItem(ItemInstance->ItemCode);
-
-		UE_LOG(LogTemp, Log, TEXT("Loaded Item: %d, %s, %d, %s"),
-			ItemInstance->ItemCode,
-			*ItemInstance->Name,
-			ItemInstance->Price,
-			*ItemInstance->Description);
-	}
+	// 플레이어 로그인 전에 만들어 두어야 PostLogin 부터 로딩 단계를 기록할 수 있습니다.
+	MatchStartBarrier = NewObject<UMatchStartBarrier>(this);
+	MatchStartBarrier->Initialize(GameInstance->NumberOfPlayer != -1 ? NumberOfPlayer : 0, MaxLoadWaitTime);
+	MatchStartBarrier->OnReleased.AddUObject(this, &AArenaGameMode::HandleMatchStartBarrierReleased);
+	MatchStartBarrier->OnLatePlayerReady.AddUObject(this, &AArenaGameMode::HandleLatePlayerReady);
+	MatchStartBarrier->OnPlayerLoadStageChanged.AddUObject(this, &AArenaGameMode::HandlePlayerLoadStageChanged);
 }
 
-void AArenaGameMode::GenerateSubItem(int32 ItemCode)
+void AArenaGameMode::LoadItemData()
 {
-	if (!LoadedItems.Contains(ItemCode))
+	if (!ItemRegistry)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("GenerateSubItemMap failed: Invalid ItemCode %d."), ItemCode);
-		return;
+		ItemRegistry = NewObject<UItemRegistry>(this);
 	}
 
-	TMap<int32, int32>& SubItemMap = RequiredSubItems.FindOrAdd(ItemCode);
-	TFunction<void(int32)> FindSubItemsRecursive = [this, &FindSubItemsRecursive, &SubItemMap](int32 CurrentItemCode)
-		{
-			if (!LoadedItems.Contains(CurrentItemCode))
-			{
-				return;
-			}
-
-			// 현재 아이템의 하위 아이템 가져오기
-			for (int32 SubItemCode : LoadedItems[CurrentItemCode]->RequiredItems)
-			{
-				// 하위 아이템이 이미 존재하면 개수를 증가, 없으면 추가
-				SubItemMap.FindOrAdd(SubItemCode)++;
-
-				// 재귀적으로 처리
-				FindSubItemsRecursive(SubItemCode);
-			}
-		};
-
-	// 재귀 탐색 시작
-	FindSubItemsRecursive(ItemCode);
+	ItemRegistry->Build(ItemTable);
 }
 
 void AArenaGameMode::LoadGameData()
@@ -191,6 +104,13 @@ void AArenaGameMode::LoadGameData()
 	}
 
 	GameplayConfig = *DataRow;
+
+	MinionShareFactor.Empty(5);
+	MinionShareFactor.Add(1, 1.0f);
+	MinionShareFactor.Add(2, GameplayConfig.ExpShareFactorTwoPlayers);
+	MinionShareFactor.Add(3, GameplayConfig.ExpShareFactorThreePlayers);
+	MinionShareFactor.Add(4, GameplayConfig.ExpShareFactorFourPlayers);
+	MinionShareFactor.Add(5, GameplayConfig.ExpShareFactorFivePlayers);
 }
 
 void AArenaGameMode::LoadMinionData()
@@ -204,6 +124,7 @@ void AArenaGameMode::LoadMinionData()
 
 	// 기존 데이터 클리어
 	MinionsData.Empty();
+	MinionGrowthTables.Empty();
 
 	TArray<FName> RowNames = DataTable->GetRowNames();
 	for (const auto& RowName : RowNames)
@@ -216,9 +137,26 @@ void AArenaGameMode::LoadMinionData()
 		}
 
 		MinionsData.Add(DataRow->MinionType, *DataRow);
+
+		// 웨이브별 성장 스탯을 미리 계산해 두고, 스폰 시에는 조회만 합니다.
+		const FStatTableRow* StatRow = DataRow->StatTable ? DataRow->StatTable->FindRow<FStatTableRow>(FName(*FString::FromInt(1)), TEXT("")) : nullptr;
+		if (!StatRow)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Missing stat row for MinionType: %d"), ANSI_TO_TCHAR(__FUNCTION__), (int32)DataRow->MinionType);
+			continue;
+		}
+
+		FMinionGrowthTable& GrowthTable = MinionGrowthTables.FindOrAdd(DataRow->MinionType);
+		GrowthTable.Initialize(*StatRow);
+		GrowthTable.Bake(NumBakedMinionWaves, GameplayConfig.MinionSpawnTime, GameplayConfig.MinionSpawnInterval);
 	}
 }
 
+const FMinionGrowthTable* AArenaGameMode::FindMinionGrowthTable(EMinionType MinionType) const
+{
+	return MinionGrowthTables.Find(MinionType);
+}
+
 
 void AArenaGameMode::BeginPlay()
 {
@@ -238,12 +176,14 @@ void AArenaGameMode::BeginPlay()
 	}
 
 
+	MinionWaveSpawner = NewObject<UMinionWaveSpawner>(this);
+	MinionWaveSpawner->Initialize(GameplayConfig.MinionSpawnFrameBudgetMs);
+	MinionWaveSpawner->OnExecuteSpawn.BindUObject(this, &AArenaGameMode::ExecuteMinionSpawn);
+
 	FindPlayerStart();
 	FindTaggedActors(FName("MinionSplinePath"), MinionPaths);
 	FindTaggedActors(FName("OrientationPoint"), OrientationPoints);
 
-	//GetWorldTimerManager().SetTimer(LoadTimerHandle, this, &AArenaGameMode::StartGame, MaxLoadWaitTime, false, MaxLoadWaitTime);
-	GetWorldTimerManager().SetTimerForNextTick(this, &AArenaGameMode::CheckAllPlayersLoaded);
 }
 
 void AArenaGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -278,17 +218,16 @@ void AArenaGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	OrientationPoints.Empty();
 	PlayerStarts.Empty();
 
-	for (auto& ItemPair : LoadedItems)
+	if (ItemRegistry)
 	{
-		if (ItemPair.Value)
-		{
-			UE_LOG(LogTemp, Log, TEXT("[%s] Destroying item: %s"), ANSI_TO_TCHAR(__FUNCTION__), *ItemPair.Value->Name);
-			ItemPair.Value->Destroy(true);
-		}
+		ItemRegistry->Reset();
 	}
 
-	LoadedItems.Empty(); // 모든 아이템을 제거
-	LoadedItems.Shrink(); // 메모리 최적화
+	if (MinionWaveSpawner)
+	{
+		MinionWaveSpawner->OnExecuteSpawn.Unbind();
+		MinionWaveSpawner->Clear();
+	}
 
 	// 다른 시스템에서 참조하고 있는 객체 해제
 	UCrowdControlManager::Release();
@@ -367,6 +306,11 @@ void AArenaGameMode::PostLogin(APlayerController* NewPlayer)
 	}
 
 	Players.Add(PlayerIndex, FPlayerInformation(PlayerIndex, nullptr, NewPlayerController, NewPlayerState));
+
+	if (MatchStartBarrier)
+	{
+		MatchStartBarrier->RegisterPlayer(PlayerIndex);
+	}
 	//SpawnCharacter(NewPlayerController, ChampionRowName, TeamSide, PlayerIndex);
 }
 
@@ -392,6 +336,11 @@ void AArenaGameMode::Logout(AController* Exiting)
 		ExitingPlayers.Add(Players[PlayerIndex]);
 		Players.Remove(PlayerIndex);
 	}
+
+	if (MatchStartBarrier)
+	{
+		MatchStartBarrier->RemovePlayer(PlayerIndex);
+	}
 }
 
 
@@ -427,7 +376,18 @@ void AArenaGameMode::PlayerLoaded(APlayerController* PlayerController)
 		return;
 	}
 
+	if (MatchStartBarrier)
+	{
+		MatchStartBarrier->AdvanceStage(PlayerIndex, EPlayerLoadStage::WorldLoaded);
+	}
+
 	SpawnCharacter(LoadedPlayerController, ChampionRowName, TeamSide, PlayerIndex);
+
+	const FPlayerInformation* PlayerInfo = Players.Find(PlayerIndex);
+	if (MatchStartBarrier && PlayerInfo && ::IsValid(PlayerInfo->PlayerCharacter))
+	{
+		MatchStartBarrier->AdvanceStage(PlayerIndex, EPlayerLoadStage::PawnSpawned);
+	}
 }
 
 void AArenaGameMode::PlayerPawnReady(AAOSCharacterBase* PlayerCharacter)
@@ -442,22 +402,39 @@ void AArenaGameMode::PlayerPawnReady(AAOSCharacterBase* PlayerCharacter)
 
 	UE_LOG(LogTemp, Log, TEXT("[%s] Player '%s' is ready. Total connected players: %u/%u"),
 		ANSI_TO_TCHAR(__FUNCTION__), *PlayerCharacter->GetName(), ConnectedPlayer, NumberOfPlayer);
+
+	AArenaPlayerState* ReadyPlayerState = PlayerCharacter->GetPlayerState<AArenaPlayerState>();
+	if (MatchStartBarrier && ::IsValid(ReadyPlayerState))
+	{
+		MatchStartBarrier->AdvanceStage(ReadyPlayerState->GetPlayerIndex(), EPlayerLoadStage::Ready);
+	}
 }
 
 
-void AArenaGameMode::CheckAllPlayersLoaded()
+void AArenaGameMode::HandleMatchStartBarrierReleased()
 {
-	bool bAllPlayersLoaded = (NumberOfPlayer > 0 && NumberOfPlayer == ConnectedPlayer);
+	UE_LOG(LogTemp, Log, TEXT("[%s] All players have loaded. Starting the game."), ANSI_TO_TCHAR(__FUNCTION__));
+	StartGame();
+}
 
-	if (bAllPlayersLoaded)
+void AArenaGameMode::HandleLatePlayerReady(int32 PlayerIndex)
+{
+	const FPlayerInformation* PlayerInfo = Players.Find(PlayerIndex);
+	if (!PlayerInfo)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[%s] All players have loaded. Starting the game."), ANSI_TO_TCHAR(__FUNCTION__));
-		GetWorldTimerManager().ClearTimer(LoadTimerHandle);
-		StartGame();
+		return;
 	}
-	else
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] Player %d joined after the match started."), ANSI_TO_TCHAR(__FUNCTION__), PlayerIndex);
+	StartPlayer(*PlayerInfo);
+}
+
+void AArenaGameMode::HandlePlayerLoadStageChanged(int32 PlayerIndex, EPlayerLoadStage NewStage)
+{
+	const FPlayerInformation* PlayerInfo = Players.Find(PlayerIndex);
+	if (PlayerInfo && ::IsValid(PlayerInfo->PlayerState))
 	{
-		GetWorldTimerManager().SetTimerForNextTick(this, &AArenaGameMode::CheckAllPlayersLoaded);
+		PlayerInfo->PlayerState->SetLoadStage(NewStage);
 	}
 }
 
@@ -522,60 +499,69 @@ void AArenaGameMode::StartGame()
 		return;
 	}
 
-	bool bLoadTimerActicate = GetWorld()->GetTimerManager().IsTimerActive(LoadTimerHandle);
-	if (bLoadTimerActicate)
-	{
-		GetWorld()->GetTimerManager().ClearTimer(LoadTimerHandle);
-	}
-
 	for (const TPair<int32, FPlayerInformation>& PlayerEntry : Players)
 	{
-		const FPlayerInformation& PlayerInfo = PlayerEntry.Value;
-		if (PlayerInfo.Index == -1)
+		// 시간 초과된 플레이어는 준비가 끝나면 HandleLatePlayerReady 에서 시작합니다.
+		if (MatchStartBarrier && MatchStartBarrier->GetPlayerStage(PlayerEntry.Key) != EPlayerLoadStage::Ready)
 		{
 			continue;
 		}
 
-		AAOSPlayerController* PlayerController = PlayerInfo.PlayerController;
-		if (::IsValid(PlayerController) == false)
-		{
-			continue;
-		}
+		StartPlayer(PlayerEntry.Value);
+	}
 
-		AAOSCharacterBase* PlayerCharacter = PlayerInfo.PlayerCharacter;
-		if (::IsValid(PlayerCharacter) == false)
-		{
-			continue;
-		}
+	UE_LOG(LogTemp, Warning, TEXT("[%s] Start Game."), ANSI_TO_TCHAR(__FUNCTION__));
 
-		FName TeamName = (PlayerCharacter->TeamSide == ETeamSide::Blue) ? FName(TEXT("Blue")) : FName(TEXT("Red"));
-		FVector OrientationPoint = (PlayerCharacter->TeamSide == ETeamSide::Blue) ? FVector(12500.f, 12500.f, 335.f) : FVector(-12500.f, -12500.f, 335.f);
-		FVector CurrentLocation = PlayerCharacter->GetActorLocation();
+	ArenaGameState->StartGame();
 
-		if (OrientationPoints.Contains(TeamName) && ::IsValid(OrientationPoints[TeamName]))
-		{
-			OrientationPoint = OrientationPoints[TeamName]->GetActorLocation();
-		}
+	FTimerHandle NewTimerHandle;
+	GetWorldTimerManager().SetTimer(NewTimerHandle, this, &ThisClass::ActivateSpawnMinion, GameplayConfig.MinionSpawnInterval, true, GameplayConfig.MinionSpawnTime);
+}
+
+void AArenaGameMode::StartPlayer(const FPlayerInformation& PlayerInfo)
+{
+	if (PlayerInfo.Index == -1)
+	{
+		return;
+	}
 
-		FVector LookVector = (OrientationPoint - CurrentLocation).GetSafeNormal();
-		LookVector.Z = 0.f;
-		FRotator SpawnRotation = UKismetMathLibrary::MakeRotFromX(LookVector);
+	AAOSPlayerController* PlayerController = PlayerInfo.PlayerController;
+	if (::IsValid(PlayerController) == false)
+	{
+		return;
+	}
 
-		PlayerController->SetControlRotation(SpawnRotation);
-		PlayerCharacter->ClientSetControlRotation(SpawnRotation);
-		
-		PlayerController->RemoveLoadingScreen();
-		PlayerCharacter->SetActorTickEnabled(true);
-		PlayerCharacter->ClientEnableInput();
+	AAOSCharacterBase* PlayerCharacter = PlayerInfo.PlayerCharacter;
+	if (::IsValid(PlayerCharacter) == false)
+	{
+		return;
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("[%s] Start Game."), ANSI_TO_TCHAR(__FUNCTION__));
+	FName TeamName = (PlayerCharacter->TeamSide == ETeamSide::Blue) ? FName(TEXT("Blue")) : FName(TEXT("Red"));
+	FVector OrientationPoint = (PlayerCharacter->TeamSide == ETeamSide::Blue) ? FVector(12500.f, 12500.f, 335.f) : FVector(-12500.f, -12500.f, 335.f);
+	FVector CurrentLocation = PlayerCharacter->GetActorLocation();
 
-	ArenaGameState->StartGame();
+	if (OrientationPoints.Contains(TeamName) && ::IsValid(OrientationPoints[TeamName]))
+	{
+		OrientationPoint = OrientationPoints[TeamName]->GetActorLocation();
+	}
 
-	FTimerHandle NewTimerHandle;
-	GetWorldTimerManager().SetTimer(NewTimerHandle, this, &ThisClass::ActivateSpawnMinion, GameplayConfig.MinionSpawnInterval, true, GameplayConfig.MinionSpawnTime);
-	ActivateCurrencyIncrement();
+	FVector LookVector = (OrientationPoint - CurrentLocation).GetSafeNormal();
+	LookVector.Z = 0.f;
+	FRotator SpawnRotation = UKismetMathLibrary::MakeRotFromX(LookVector);
+
+	PlayerController->SetControlRotation(SpawnRotation);
+	PlayerCharacter->ClientSetControlRotation(SpawnRotation);
+	
+	PlayerController->RemoveLoadingScreen();
+	PlayerCharacter->SetActorTickEnabled(true);
+	PlayerCharacter->ClientEnableInput();
+
+	// 초당 IncrementCurrencyAmount 의 패시브 골드. 이후 시간에 따른 증가는 복제 없이 각 머신에서 계산됩니다.
+	if (::IsValid(PlayerInfo.PlayerState))
+	{
+		PlayerInfo.PlayerState->StartPassiveIncome(static_cast<float>(GameplayConfig.IncrementCurrencyAmount));
+	}
 }
 
 void AArenaGameMode::EndGame()
@@ -634,92 +620,92 @@ void AArenaGameMode::NotifyNexusDestroyed(ANexus* Nexus)
 }
 
 
-void AArenaGameMode::ActivateCurrencyIncrement()
+void AArenaGameMode::ActivateSpawnMinion()
 {
-	GetWorldTimerManager().SetTimer(AddCurrencyTimerHandle, this, &AArenaGameMode::IncrementPlayerCurrency, 1.0f, true);
+	GetWorldTimerManager().SetTimer(SpawnMinionTimerHandle, this, &AArenaGameMode::QueueMinionWave, GameplayConfig.MinionSpawnInterval, true, 0.0f); // 90초마다 반복 실행
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] Timer set for minion spawning every %.1f seconds."), ANSI_TO_TCHAR(__FUNCTION__), GameplayConfig.MinionSpawnInterval);
 }
 
 
-void AArenaGameMode::IncrementPlayerCurrency()
+void AArenaGameMode::QueueMinionWave()
 {
-	for (const TPair<int32, FPlayerInformation>& Player : Players)
+	if (::IsValid(MinionWaveSpawner) == false)
 	{
-		const FPlayerInformation& PlayerInformation = Player.Value;
-
-		if (!::IsValid(PlayerInformation.PlayerState))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[%s] Failed to add currency: Invalid PlayerState for Player ID %d."), ANSI_TO_TCHAR(__FUNCTION__), Player.Key);
-			continue;
-		}
-
-		PlayerInformation.PlayerState->AddCurrency(GameplayConfig.IncrementCurrencyAmount);
+		UE_LOG(LogTemp, Error, TEXT("[%s] MinionWaveSpawner is not initialized."), ANSI_TO_TCHAR(__FUNCTION__));
+		return;
 	}
-}
 
+	SpawnCount++;
 
+	// 세 라인의 요청을 시간순으로 합쳐 한 대기열에 넣습니다. 실제 스폰은 프레임 예산 안에서 나눠 처리됩니다.
+	const double WaveStartTime = GetWorld()->GetTimeSeconds();
 
-void AArenaGameMode::ActivateSpawnMinion()
-{
-	GetWorldTimerManager().SetTimer(SpawnMinionTimerHandle, [this]()
-		{
-			SpawnCount++;
-			SpawnMinionsForLane(ELaneType::Top);
-			SpawnMinionsForLane(ELaneType::Mid);
-			SpawnMinionsForLane(ELaneType::Bottom);
-		}, GameplayConfig.MinionSpawnInterval, true, 0.0f); // 90초마다 반복 실행
+	TArray<FMinionSpawnRequest> Requests;
+	BuildLaneWaveRequests(ELaneType::Top, WaveStartTime, Requests);
+	BuildLaneWaveRequests(ELaneType::Mid, WaveStartTime, Requests);
+	BuildLaneWaveRequests(ELaneType::Bottom, WaveStartTime, Requests);
 
-	UE_LOG(LogTemp, Log, TEXT("[%s] Timer set for minion spawning every 90 seconds."), ANSI_TO_TCHAR(__FUNCTION__));
+	Algo::StableSortBy(Requests, &FMinionSpawnRequest::ReadyTime);
+	MinionWaveSpawner->EnqueueWave(SpawnCount, MoveTemp(Requests));
 }
 
 
-void AArenaGameMode::SpawnMinionsForLane(ELaneType Lane)
+void AArenaGameMode::BuildLaneWaveRequests(ELaneType Lane, double WaveStartTime, TArray<FMinionSpawnRequest>& OutRequests) const
 {
-	const int32 MinionsPerWave = (SpawnCount % GameplayConfig.SuperMinionSpawnInterval == 0) ? GameplayConfig.MinionsPerWave + 1 : GameplayConfig.MinionsPerWave;
-	uint32 UniqueCode = UUniqueCodeGenerator::GenerateUniqueCode(EObjectType::System, 0, ETimerCategory::Spawn, static_cast<uint8>(EObjectType::Minion), static_cast<uint8>(Lane));
+	const bool bSuperWave = (SpawnCount % GameplayConfig.SuperMinionSpawnInterval == 0); // 3번째 소환마다
+	const int32 MinionsPerWave = bSuperWave ? GameplayConfig.MinionsPerWave + 1 : GameplayConfig.MinionsPerWave;
+	const int32 HalfWave = GameplayConfig.MinionsPerWave / 2;
+
+	OutRequests.Reserve(OutRequests.Num() + MinionsPerWave * 2);
 
-	TSharedPtr<int32> CurrentIndex = MakeShareable(new int32(0));
-	auto TimerCallback = [this, Lane, MinionsPerWave, CurrentIndex, UniqueCode]()
+	for (int32 Index = 0; Index < MinionsPerWave; ++Index)
+	{
+		EMinionType MinionType;
+
+		if (bSuperWave)
 		{
-			if (*CurrentIndex >= MinionsPerWave)
+			if (Index < HalfWave)
 			{
-				// 모든 미니언 스폰이 완료되었으므로 타이머를 해제
-				ClearTimer(UniqueCode);
-				return;
+				MinionType = EMinionType::Melee; // 처음 3마리는 Melee
 			}
-
-			EMinionType MinionType;
-
-			if (SpawnCount % GameplayConfig.SuperMinionSpawnInterval == 0) // 3번째 소환마다
+			else if (Index == HalfWave)
 			{
-				if (*CurrentIndex < GameplayConfig.MinionsPerWave / 2)
-				{
-					MinionType = EMinionType::Melee; // 처음 3마리는 Melee
-				}
-				else if (*CurrentIndex == GameplayConfig.MinionsPerWave / 2)
-				{
-					MinionType = EMinionType::Super; // 4번째는 Super Minion
-				}
-				else
-				{
-					MinionType = EMinionType::Ranged; // 나머지는 Ranged
-				}
+				MinionType = EMinionType::Super; // 4번째는 Super Minion
 			}
 			else
 			{
-				MinionType = (*CurrentIndex < GameplayConfig.MinionsPerWave / 2) ? EMinionType::Melee : EMinionType::Ranged; // 평소에는 Melee 3, Ranged 3
-				const TCHAR* MinionTypeStr = (*CurrentIndex < 3) ? TEXT("Melee") : TEXT("Ranged");
+				MinionType = EMinionType::Ranged; // 나머지는 Ranged
 			}
+		}
+		else
+		{
+			MinionType = (Index < HalfWave) ? EMinionType::Melee : EMinionType::Ranged; // 평소에는 Melee 3, Ranged 3
+		}
 
-			SpawnMinion(MinionType, Lane, ETeamSide::Blue);
-			SpawnMinion(MinionType, Lane, ETeamSide::Red);
-			(*CurrentIndex)++;
-		};
+		// 기존 SpawnInterval 간격을 그대로 유지합니다.
+		FMinionSpawnRequest Request;
+		Request.MinionType = MinionType;
+		Request.Lane = Lane;
+		Request.Wave = SpawnCount;
+		Request.ReadyTime = WaveStartTime + Index * GameplayConfig.SpawnInterval;
+
+		Request.Team = ETeamSide::Blue;
+		OutRequests.Add(Request);
+
+		Request.Team = ETeamSide::Red;
+		OutRequests.Add(Request);
+	}
+}
 
-	SetTimer(UniqueCode, TimerCallback, GameplayConfig.SpawnInterval, true);
+
+void AArenaGameMode::ExecuteMinionSpawn(const FMinionSpawnRequest& Request)
+{
+	SpawnMinion(Request.MinionType, Request.Lane, Request.Team, Request.Wave);
 }
 
 
-void AArenaGameMode::SpawnMinion(EMinionType MinionType, ELaneType Lane, ETeamSide Team)
+void AArenaGameMode::SpawnMinion(EMinionType MinionType, ELaneType Lane, ETeamSide Team, int32 Wave)
 {
 	FName LaneName = *StaticEnum<ELaneType>()->GetNameStringByValue(static_cast<int64>(Lane));
 
@@ -777,16 +763,13 @@ void AArenaGameMode::SpawnMinion(EMinionType MinionType, ELaneType Lane, ETeamSi
 	NewMinion->TeamSide = Team;
 
 	NewMinion->ExperienceShareRadius = GameplayConfig.ExperienceShareRadius;
-	NewMinion->ShareFactor.Add(1, 1.0f);
-	NewMinion->ShareFactor.Add(2, GameplayConfig.ExpShareFactorTwoPlayers);
-	NewMinion->ShareFactor.Add(3, GameplayConfig.ExpShareFactorThreePlayers);
-	NewMinion->ShareFactor.Add(4, GameplayConfig.ExpShareFactorFourPlayers);
-	NewMinion->ShareFactor.Add(5, GameplayConfig.ExpShareFactorFivePlayers);
+	NewMinion->ShareFactor = MinionShareFactor;
 
 	NewMinion->SetExpBounty(MinionDataPtr->ExpBounty);
 	NewMinion->SetGoldBounty(MinionDataPtr->GoldBounty);
 
 	NewMinion->ChaseThreshold = GameplayConfig.ChaseThreshold;
+	NewMinion->SpawnWave = Wave;
 
 	// SplineActor 설정
 	NewMinion->SplineActor = MinionPaths[LaneName];
@@ -1211,8 +1194,7 @@ void AArenaGameMode::AddCurrencyToPlayer(ACharacterBase* Character, int32 Amount
 		return;
 	}
 
-	int32 CurrentGold = PlayerState->GetCurrency();
-	PlayerState->SetCurrency(CurrentGold + Amount);
+	PlayerState->AddCurrency(Amount);
 }
 
 void AArenaGameMode::AddExpToPlayer(ACharacterBase* Character, int32 Amount)
@@ -1233,37 +1215,42 @@ void AArenaGameMode::AddExpToPlayer(ACharacterBase* Character, int32 Amount)
 }
 
 
+const FItemDefinition* AArenaGameMode::FindItemDefinition(int32 ItemCode) const
+{
+	return ItemRegistry ? ItemRegistry->Find(ItemCode) : nullptr;
+}
+
 const TMap<int32, int32>* AArenaGameMode::GetSubItemsForItem(int32 ItemCode) const
 {
-	const TMap<int32, int32>* FoundSubItems = RequiredSubItems.Find(ItemCode);
-	return FoundSubItems ? FoundSubItems : nullptr;
+	return ItemRegistry ? ItemRegistry->GetSubItems(ItemCode) : nullptr;
 }
 
 TArray<FItemTableRow> AArenaGameMode::GetLoadedItems() const
 {
 	TArray<FItemTableRow> OutItems;
+	if (!ItemRegistry)
+	{
+		return OutItems;
+	}
+
+	OutItems.Reserve(ItemRegistry->Num());
 
-	for (const auto& ItemPair : LoadedItems)
+	for (const auto& DefinitionPair : ItemRegistry->GetDefinitions())
 	{
-		if (ItemPair.Value == nullptr)
-		{
-			UE_LOG(LogTemp, Error, TEXT("[AArenaGameMode::GetLoadedItems] Item index %d is not valid."), ItemPair.Key);
-			continue;  // null 아이템을 건너뜀
-		}
+		const FItemTableRow& Row = DefinitionPair.Value.Row;
 
 		FItemTableRow Item;
-		Item.ItemCode = ItemPair.Value->ItemCode;
-		Item.Name = ItemPair.Value->Name;
-		Item.Price = ItemPair.Value->Price;
-		Item.Description = ItemPair.Value->Description;
-		Item.Icon = ItemPair.Value->Icon;
-		Item.Classification = ItemPair.Value->Classification;
-		Item.MaxConcurrentUses = ItemPair.Value->MaxConcurrentUses;
-		Item.MaxStackPerSlot = ItemPair.Value->MaxStackPerSlot;
-		Item.MaxInventoryQuantity = ItemPair.Value->MaxInventoryQuantity;
-		Item.Classification = ItemPair.Value->Classification;
-		Item.StatModifiers = ItemPair.Value->StatModifiers;
-		Item.RequiredItems = ItemPair.Value->RequiredItems;
+		Item.ItemCode = Row.ItemCode;
+		Item.Name = Row.Name;
+		Item.Price = Row.Price;
+		Item.Description = Row.Description;
+		Item.Icon = Row.Icon;
+		Item.Classification = Row.Classification;
+		Item.MaxConcurrentUses = Row.MaxConcurrentUses;
+		Item.MaxStackPerSlot = Row.MaxStackPerSlot;
+		Item.MaxInventoryQuantity = Row.MaxInventoryQuantity;
+		Item.StatModifiers = Row.StatModifiers;
+		Item.RequiredItems = Row.RequiredItems;
 
 		OutItems.Add(Item);
 	}
@@ -12,6 +12,7 @@
 #include "TimerManager.h"
 #include "Item/ItemData.h"
 #include "Item/Item.h"
+#include "Item/ItemRegistry.h"
 
 constexpr int32 MaxInventorySize = 6;
 
@@ -22,11 +23,14 @@ AArenaPlayerState::AArenaPlayerState()
 	TeamSide = ETeamSide::None;
 	PlayerIndex = -1;
 	UpgradePoints = 0;
-	Currency = 10000;
+	Income.BaseAmount = 10000;
 	PlayerUniqueID = FString();
 	ChosenChampionName = NAME_None;
+	LoadStage = EPlayerLoadStage::None;
 
 	Inventory.SetNum(MaxInventorySize);
+	NextItemInstanceId = 1;
+	InventoryList.OwnerPlayerState = this;
 }
 
 void AArenaPlayerState::BeginPlay()
@@ -52,7 +56,9 @@ void AArenaPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Ou
 	DOREPLIFETIME(ThisClass, PlayerIndex);
 	DOREPLIFETIME(ThisClass, ChosenChampionName);
 	DOREPLIFETIME(ThisClass, UpgradePoints);
-	DOREPLIFETIME(ThisClass, Currency);
+	DOREPLIFETIME(ThisClass, Income);
+	DOREPLIFETIME_CONDITION(ThisClass, InventoryList, COND_OwnerOnly);
+	DOREPLIFETIME(ThisClass, LoadStage);
 }
 
 // Accessors
@@ -94,7 +100,7 @@ FString AArenaPlayerState::GetPlayerUniqueID() const
  * 이 함수는 플레이어가 아이템을 구매하려 할 때 호출됩니다.
  * 여러 가지 확인을 수행합니다:
  * - 게임 모드의 로드된 아이템 목록에서 해당 아이템이 존재하는지 확인합니다.
- * - 플레이어의 인벤토리에 아이템 객체를 복제합니다.
+ * - 아이템 정의를 찾아 플레이어 인벤토리 슬롯에 값 기록으로 추가합니다. (아이템 객체를 생성하지 않습니다)
  * - 적용 가능한 할인 항목을 적용하고, 필요한 하위 아이템을 플레이어 인벤토리에서 제거합니다.
  * - 플레이어가 아이템을 구매할 충분한 자금을 가지고 있는지 확인합니다.
  * - 플레이어의 인벤토리가 가득 차 있지 않은지, 플레이어가 해당 아이템의 최대 소지 한도를 초과하지 않았는지 확인합니다.
@@ -115,8 +121,8 @@ void AArenaPlayerState::ServerPurchaseItem_Implementation(const int32 ItemCode)
 		return;
 	}
 
-	AItem** FoundItem = GameMode->LoadedItems.Find(ItemCode);
-	if (!(FoundItem && *FoundItem))
+	const FItemDefinition* FoundItem = GameMode->FindItemDefinition(ItemCode);
+	if (!FoundItem || !FoundItem->Behavior)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[%s] failed: Invalid ItemCode %d."), ANSI_TO_TCHAR(__FUNCTION__), ItemCode);
 		ClientNotifyItemPurchased(ItemCode, false);
@@ -146,60 +152,61 @@ void AArenaPlayerState::ServerPurchaseItem_Implementation(const int32 ItemCode)
 	}
 }
 
-bool AArenaPlayerState::ProcessPurchaseTransaction(AItem* ItemToPurchase, FInventoryTransactionLog& TransactionLog)
+bool AArenaPlayerState::ProcessPurchaseTransaction(const FItemDefinition& ItemToPurchase, FInventoryTransactionLog& TransactionLog)
 {
-	if (!::IsValid(ItemToPurchase))
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid Item."));
-		return false;
-	}
+	const int32 PurchaseItemCode = ItemToPurchase.Row.ItemCode;
 
 	// 하위 아이템 제거 및 가격 조정
-	const TMap<int32, int32>* SubItems = GameMode->GetSubItemsForItem(ItemToPurchase->ItemCode);
+	const TMap<int32, int32>* SubItems = GameMode->GetSubItemsForItem(PurchaseItemCode);
 	if (!SubItems)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("No sub-items found for ItemCode: %d"), ItemToPurchase->ItemCode);
+		UE_LOG(LogTemp, Warning, TEXT("No sub-items found for ItemCode: %d"), PurchaseItemCode);
 		return false;
 	}
 
-	int32 FinalPrice = ItemToPurchase->Price;
+	int32 FinalPrice = ItemToPurchase.Row.Price;
 	TMap<int32, int32> ItemsToRemove = *SubItems;
 	int32 EmptySlot = -1;
 
+	AAOSCharacterBase* OwningCharacter = GetOwningCharacter();
+
 	for (int32 i = 0; i < Inventory.Num(); ++i)
 	{
-		AItem* CurrentItem = Inventory[i];
-		if (!CurrentItem)
+		FItemInstance& CurrentItem = Inventory[i];
+		if (CurrentItem.IsEmpty())
 		{
 			if (EmptySlot == -1) EmptySlot = i;
 			continue;
 		}
 
-		int32 ItemCode = CurrentItem->ItemCode;
+		int32 ItemCode = CurrentItem.ItemCode;
+
+		const FItemDefinition* CurrentDefinition = FindItemDefinition(ItemCode);
+		if (!CurrentDefinition)
+		{
+			continue;
+		}
 
 		// 하위 아이템 제거
 		if (int32* RequiredCount = ItemsToRemove.Find(ItemCode))
 		{
-			int32 AvailableCount = CurrentItem->CurrentStackPerSlot;
+			int32 AvailableCount = CurrentItem.Stack;
 			int32 RemovableCount = FMath::Min(*RequiredCount, AvailableCount);
 
-			FinalPrice = FMath::Max(0, FinalPrice - (RemovableCount * CurrentItem->Price));
+			FinalPrice = FMath::Max(0, FinalPrice - (RemovableCount * CurrentDefinition->Row.Price));
 
 			// 트랜잭션 로그 기록
-			TransactionLog.RemovedItems.Add(i, FRemovedItemData(ItemCode, RemovableCount, CurrentItem));
+			TransactionLog.RemovedItems.Add(i, FRemovedItemData(ItemCode, RemovableCount, CurrentItem.InstanceId));
 
-			CurrentItem->CurrentStackPerSlot -= RemovableCount;
-			CurrentItem->RemoveAbilitiesFromCharacter();
-			if (CurrentItem->CurrentStackPerSlot <= 0)
+			CurrentItem.Stack -= RemovableCount;
+			CurrentDefinition->Behavior->RemoveStats(CurrentItem, OwningCharacter);
+			if (CurrentItem.Stack <= 0)
 			{
-				ClientInventoryChanged(i, -1, 0);
-				Inventory[i] = nullptr;
+				CurrentItem.Reset();
 				if (EmptySlot == -1) EmptySlot = i;
 			}
-			else
-			{
-				ClientInventoryChanged(i, ItemCode, CurrentItem->CurrentStackPerSlot);
-			}
+
+			SyncInventorySlot(i);
 
 			*RequiredCount -= RemovableCount;
 			if (*RequiredCount <= 0)
@@ -209,17 +216,17 @@ bool AArenaPlayerState::ProcessPurchaseTransaction(AItem* ItemToPurchase, FInven
 		}
 
 		// 스택 가능한 슬롯 찾기
-		if (CurrentItem->ItemCode == ItemToPurchase->ItemCode && CurrentItem->CurrentStackPerSlot < CurrentItem->MaxStackPerSlot)
+		if (CurrentItem.ItemCode == PurchaseItemCode && CurrentItem.Stack < ItemToPurchase.Row.MaxStackPerSlot)
 		{
-			int32 SpaceLeft = CurrentItem->MaxStackPerSlot - CurrentItem->CurrentStackPerSlot;
+			int32 SpaceLeft = ItemToPurchase.Row.MaxStackPerSlot - CurrentItem.Stack;
 			int32 AddCount = FMath::Min(1, SpaceLeft); // 상위 아이템은 1개씩만 추가 가능
 
-			CurrentItem->CurrentStackPerSlot += AddCount;
-			CurrentItem->ApplyAbilitiesToCharacter();
+			CurrentItem.Stack += AddCount;
+			ItemToPurchase.Behavior->ApplyStats(ItemToPurchase, CurrentItem, OwningCharacter);
 
 			// 트랜잭션 로그에 추가
 			TransactionLog.AddedStacks.Add(i, AddCount);
-			ClientInventoryChanged(i, ItemToPurchase->ItemCode, CurrentItem->CurrentStackPerSlot);
+			SyncInventorySlot(i);
 
 			if (AddCount > 0)
 			{
@@ -229,36 +236,33 @@ bool AArenaPlayerState::ProcessPurchaseTransaction(AItem* ItemToPurchase, FInven
 	}
 
 	// 2인벤토리 공간 및 자금 확인
-	if (Currency < FinalPrice)
+	if (GetCurrency() < FinalPrice)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Insufficient funds for ItemCode: %d"), ItemToPurchase->ItemCode);
+		UE_LOG(LogTemp, Warning, TEXT("Insufficient funds for ItemCode: %d"), PurchaseItemCode);
 		return false;
 	}
 
 	// 빈 슬롯에 상위 아이템 추가
 	if (EmptySlot != -1)
 	{
-		AItem* NewItem = FindOrDuplicateItem(ItemToPurchase);
-		if (!NewItem)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("Failed to duplicate item for ItemCode: %d"), ItemToPurchase->ItemCode);
-			return false;
-		}
-
-		NewItem->CurrentStackPerSlot = 1;
-		Inventory[EmptySlot] = NewItem;
-		BindItemToPlayer(NewItem);
+		FItemInstance& NewItem = Inventory[EmptySlot];
+		NewItem.Reset();
+		NewItem.ItemCode = PurchaseItemCode;
+		NewItem.Stack = 1;
+		NewItem.InstanceId = NextItemInstanceId++;
+		BindItemToPlayer(EmptySlot);
 
 		TransactionLog.CurrencyChange = -FinalPrice;
-		Currency -= FinalPrice;
+		Income.BaseAmount -= FinalPrice;
+		NotifyCurrencyChanged();
 
-		ClientInventoryChanged(EmptySlot, NewItem->ItemCode, NewItem->CurrentStackPerSlot);
+		SyncInventorySlot(EmptySlot);
 
 		return true;
 	}
 
 	// 4인벤토리 공간 부족
-	UE_LOG(LogTemp, Warning, TEXT("Inventory full. Cannot add ItemCode: %d"), ItemToPurchase->ItemCode);
+	UE_LOG(LogTemp, Warning, TEXT("Inventory full. Cannot add ItemCode: %d"), PurchaseItemCode);
 	return false;
 }
 
@@ -269,7 +273,11 @@ void AArenaPlayerState::RollbackTransaction(const FInventoryTransactionLog& Tran
 	UE_LOG(LogTemp, Warning, TEXT("Transaction failed. Rolling back changes."));
 
 	// 금액 복원
-	Currency -= TransactionLog.CurrencyChange;
+	if (TransactionLog.CurrencyChange != 0)
+	{
+		Income.BaseAmount -= TransactionLog.CurrencyChange;
+		NotifyCurrencyChanged();
+	}
 
 	// 스택 롤백
 	for (const auto& Entry : TransactionLog.AddedStacks)
@@ -277,11 +285,11 @@ void AArenaPlayerState::RollbackTransaction(const FInventoryTransactionLog& Tran
 		int32 Index = Entry.Key;
 		int32 RevertCount = Entry.Value;
 
-		if (Inventory.IsValidIndex(Index) && Inventory[Index])
+		if (Inventory.IsValidIndex(Index) && Inventory[Index].IsEmpty() == false)
 		{
-			Inventory[Index]->CurrentStackPerSlot -= RevertCount;
-			Inventory[Index]->ApplyAbilitiesToCharacter();
-			ClientInventoryChanged(Index, Inventory[Index]->ItemCode, Inventory[Index]->CurrentStackPerSlot);
+			Inventory[Index].Stack -= RevertCount;
+			BindItemToPlayer(Index);
+			SyncInventorySlot(Index);
 		}
 	}
 
@@ -293,10 +301,17 @@ void AArenaPlayerState::RollbackTransaction(const FInventoryTransactionLog& Tran
 
 		if (Inventory.IsValidIndex(Index))
 		{
-			if (!Inventory[Index]) Inventory[Index] = Data.ItemInstance;
-			Inventory[Index]->CurrentStackPerSlot += Data.RemovedCount;
-			BindItemToPlayer(Data.ItemInstance);
-			ClientInventoryChanged(Index, Data.ItemCode, Inventory[Index]->CurrentStackPerSlot);
+			FItemInstance& Slot = Inventory[Index];
+			if (Slot.IsEmpty())
+			{
+				Slot.Reset();
+				Slot.ItemCode = Data.ItemCode;
+				Slot.InstanceId = Data.InstanceId;
+			}
+
+			Slot.Stack += Data.RemovedCount;
+			BindItemToPlayer(Index);
+			SyncInventorySlot(Index);
 		}
 	}
 }
@@ -484,76 +499,27 @@ void AArenaPlayerState::CommitTransaction(FInventoryTransactionLog& TransactionL
 
 void AArenaPlayerState::RemoveItemFromInventory(int32 Index)
 {
-	if (Inventory.IsValidIndex(Index) && Inventory[Index])
+	if (Inventory.IsValidIndex(Index) && Inventory[Index].ItemCode >= 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[%s] Removing item: %s from inventory slot %d"), ANSI_TO_TCHAR(__FUNCTION__), *Inventory[Index]->Name, Index);
-
+		UE_LOG(LogTemp, Log, TEXT("[%s] Removing item: %d from inventory slot %d"), ANSI_TO_TCHAR(__FUNCTION__), Inventory[Index].ItemCode, Index);
 
-		if (Inventory[Index]->ActivationState == EItemActivationState::Active || Inventory[Index]->ActivationState == EItemActivationState::Pending)
-		{
-			MoveItemToPendingDeletion(Index);
-			ClientInventoryChanged(Index, -1, 0);
-		}
-		else
-		{
-			Inventory[Index]->RemoveAbilitiesFromCharacter();
-			Inventory[Index]->Destroy();
-			Inventory[Index] = nullptr;
-			ClientInventoryChanged(Index, -1, 0);
-		}
+		// 진행 중인 효과(포션 회복, 재사용 대기)는 ItemEffects 에 남아 슬롯과 무관하게 이어집니다.
+		RemoveItemStats(Inventory[Index]);
+		Inventory[Index].Reset();
+		SyncInventorySlot(Index);
 	}
 }
 
-void AArenaPlayerState::MoveItemToPendingDeletion(int32 Index)
+void AArenaPlayerState::RemoveItemStats(FItemInstance& Instance)
 {
-	if (Inventory.IsValidIndex(Index) && Inventory[Index])
+	const FItemDefinition* Definition = FindItemDefinition(Instance.ItemCode);
+	if (!Definition)
 	{
-		UE_LOG(LogTemp, Log, TEXT("Moving item to PendingDeletion Index:%d ItemCode"), Index, Inventory[Index]->ItemCode);
-
-		PendingDeletionItems.Add(Inventory[Index]);
-		Inventory[Index]->CurrentStackPerSlot = 0;
-		Inventory[Index] = nullptr;
-		ClientInventoryChanged(Index, -1, 0);
-
-		GetWorld()->GetTimerManager().SetTimer(ActivationCheckTimer, this, &AArenaPlayerState::CheckExpiredItems, 0.1f, true);
-	}
-}
-
-void AArenaPlayerState::CheckExpiredItems()
-{
-	TArray<int32> ItemsToRemove;  // 삭제할 인덱스를 임시 저장
-
-	for (int32 i = 0; i < PendingDeletionItems.Num(); ++i)
-	{
-		AItem* Item = PendingDeletionItems[i];
-
-		if (!IsValid(Item)) // 객체가 이미 삭제되었거나 유효하지 않은 경우
-		{
-			ItemsToRemove.Add(i);
-			continue;
-		}
-
-		if (Item->ActivationState == EItemActivationState::Expired)
-		{
-			UE_LOG(LogTemp, Log, TEXT("[%s] Marking expired item for removal: %s (ItemCode: %d)"),
-				ANSI_TO_TCHAR(__FUNCTION__), *Item->Name, Item->ItemCode);
-
-			Item->Destroy();
-			ItemsToRemove.Add(i);
-		}
-	}
-
-	// 삭제 대상 제거 (역순으로 안전하게 삭제)
-	for (int32 i = ItemsToRemove.Num() - 1; i >= 0; --i)
-	{
-		PendingDeletionItems.RemoveAt(ItemsToRemove[i]);
+		Instance.AppliedStats.Reset();
+		return;
 	}
 
-	// 타이머 정리
-	if (PendingDeletionItems.Num() == 0)
-	{
-		GetWorld()->GetTimerManager().ClearTimer(ActivationCheckTimer);
-	}
+	Definition->Behavior->RemoveStats(Instance, GetOwningCharacter());
 }
 
 
@@ -562,8 +528,8 @@ void AArenaPlayerState::SwapItemsInInventory(int32 Index1, int32 Index2)
 	if (Inventory.IsValidIndex(Index1) && Inventory.IsValidIndex(Index2))
 	{
 		Inventory.Swap(Index1, Index2);
-		ClientInventoryChanged(Index1, Inventory[Index1]->ItemCode, Inventory[Index1]->CurrentStackPerSlot);
-		ClientInventoryChanged(Index2, Inventory[Index2]->ItemCode, Inventory[Index2]->CurrentStackPerSlot);
+		SyncInventorySlot(Index1);
+		SyncInventorySlot(Index2);
 	}
 	else
 	{
@@ -574,22 +540,28 @@ void AArenaPlayerState::SwapItemsInInventory(int32 Index1, int32 Index2)
 
 void AArenaPlayerState::UseItem(int32 Index)
 {
-	if (!Inventory.IsValidIndex(Index) || !Inventory[Index])
+	if (!Inventory.IsValidIndex(Index) || Inventory[Index].IsEmpty())
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[AArenaPlayerState::UseItem] Invalid item index or item not found"));
 		return;
 	}
 
-	Inventory[Index]->Use(this);
+	const FItemDefinition* Definition = FindItemDefinition(Inventory[Index].ItemCode);
+	if (!Definition)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[AArenaPlayerState::UseItem] No definition for ItemCode %d"), Inventory[Index].ItemCode);
+		return;
+	}
+
+	Definition->Behavior->Use(*Definition, Inventory[Index], this);
 
-	if (Inventory[Index]->CurrentStackPerSlot <= 0)
+	if (Inventory[Index].Stack <= 0)
 	{
-		ClientInventoryChanged(Index, -1, 0);
 		RemoveItemFromInventory(Index);
 	}
 	else
 	{
-		ClientInventoryChanged(Index, Inventory[Index]->ItemCode, Inventory[Index]->CurrentStackPerSlot);
+		SyncInventorySlot(Index);
 	}
 }
 
@@ -603,11 +575,11 @@ void AArenaPlayerState::UseItem(int32 Index)
 int32 AArenaPlayerState::GetItemTotalCount(const int32 ItemCode) const
 {
 	int32 ItemTotalCount = 0;
-	for (const auto& InventoryItem : Inventory)
+	for (const FItemInstance& InventoryItem : Inventory)
 	{
-		if (InventoryItem && InventoryItem->ItemCode == ItemCode)
+		if (InventoryItem.IsEmpty() == false && InventoryItem.ItemCode == ItemCode)
 		{
-			ItemTotalCount += InventoryItem->CurrentStackPerSlot;
+			ItemTotalCount += InventoryItem.Stack;
 		}
 	}
 	return ItemTotalCount;
@@ -615,76 +587,21 @@ int32 AArenaPlayerState::GetItemTotalCount(const int32 ItemCode) const
 
 
 // 최대 소지 한도 확인
-bool AArenaPlayerState::ExceedsMaxPossession(const AItem* OriginalItem) const
+bool AArenaPlayerState::ExceedsMaxPossession(const FItemDefinition& Definition) const
 {
-	int32 TotalItemCount = 0;
-	for (const auto& InventoryItem : Inventory)
-	{
-		if (::IsValid(InventoryItem) == false)
-		{
-			continue;
-		}
-
-		if (InventoryItem->ItemCode == OriginalItem->ItemCode)
-		{
-			TotalItemCount += InventoryItem->CurrentStackPerSlot;
-		}
-	}
-
-	return TotalItemCount < OriginalItem->MaxInventoryQuantity;
+	return GetItemTotalCount(Definition.Row.ItemCode) < Definition.Row.MaxInventoryQuantity;
 }
 
 
-AItem* AArenaPlayerState::FindItemInPendingDeletion(int32 ItemCode)
-{
-	for (int32 i = 0; i < PendingDeletionItems.Num(); ++i)
-	{
-		if (PendingDeletionItems[i] && PendingDeletionItems[i]->ItemCode == ItemCode)
-		{
-			return PendingDeletionItems[i];
-		}
-	}
-	return nullptr;
-}
-
-/**
- * @brief PendingDeletionItems에서 아이템을 찾거나, 없을 경우 새로 복제하여 반환합니다.
- *
- * @param OriginalItem 찾거나 생성할 아이템의 원본.
- * @return AItem* 찾거나 생성된 아이템을 반환.
- */
-AItem* AArenaPlayerState::FindOrDuplicateItem(const AItem* OriginalItem)
+const FItemDefinition* AArenaPlayerState::FindItemDefinition(int32 ItemCode) const
 {
-	if (::IsValid(OriginalItem) == false)
+	if (ItemCode < 0 || ::IsValid(GameMode) == false)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("OriginalItem is invalid."));
 		return nullptr;
 	}
 
-	// ✅ 안전한 Iterator 기반 순회 및 제거
-	for (auto It = PendingDeletionItems.CreateIterator(); It; ++It)
-	{
-		AItem* PendingItem = *It;
-		if (::IsValid(PendingItem) && PendingItem->ItemCode == OriginalItem->ItemCode)
-		{
-			UE_LOG(LogTemp, Log, TEXT("Item found in PendingDeletionItems: %d"), OriginalItem->ItemCode);
-			It.RemoveCurrent();
-			return PendingItem;
-		}
-	}
-
-	// 새로운 아이템 복제
-	AItem* NewItem = DuplicateObject<AItem>(OriginalItem, this);
-	if (NewItem)
-	{
-		UE_LOG(LogTemp, Log, TEXT("New item duplicated for ItemCode: %d"), OriginalItem->ItemCode);
-		return NewItem;
-	}
-	else
-	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to duplicate item for ItemCode: %d"), OriginalItem->ItemCode);
-		return nullptr;
-	}
+	const FItemDefinition* Definition = GameMode->FindItemDefinition(ItemCode);
+	return Definition && Definition->Behavior ? Definition : nullptr;
 }
 
 
@@ -712,34 +629,142 @@ bool AArenaPlayerState::ServerPurchaseItem_Validate(int32 ItemCode)
  */
 
 
-void AArenaPlayerState::BindItemToPlayer(AItem* Item)
+void AArenaPlayerState::BindItemToPlayer(int32 SlotIndex)
 {
-	AActor* OwnerActor = GetOwner();
-	if (::IsValid(OwnerActor) == false)
+	if (Inventory.IsValidIndex(SlotIndex) == false || Inventory[SlotIndex].IsEmpty())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] PlayerState's owner is not set"), ANSI_TO_TCHAR(__FUNCTION__));
 		return;
 	}
 
-	// PlayerController로 캐스팅
-	APlayerController* PlayerController = Cast<APlayerController>(OwnerActor);
-	if (::IsValid(PlayerController) == false)
+	FItemInstance& Instance = Inventory[SlotIndex];
+	const FItemDefinition* Definition = FindItemDefinition(Instance.ItemCode);
+	if (!Definition)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Owner is not a PlayerController"), ANSI_TO_TCHAR(__FUNCTION__));
+		UE_LOG(LogTemp, Warning, TEXT("[%s] No definition for ItemCode %d"), ANSI_TO_TCHAR(__FUNCTION__), Instance.ItemCode);
 		return;
 	}
 
-	// PlayerController의 Pawn을 가져와서 AAOSCharacterBase로 캐스팅
-	AAOSCharacterBase* OwningCharacter = Cast<AAOSCharacterBase>(PlayerController->GetPawn());
+	AAOSCharacterBase* OwningCharacter = GetOwningCharacter();
 	if (::IsValid(OwningCharacter) == false)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed to bind item %s: Controlled character is not valid or is not AAOSCharacterBase"), ANSI_TO_TCHAR(__FUNCTION__), *Item->GetName());
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed to bind item %s: Controlled character is not valid or is not AAOSCharacterBase"), ANSI_TO_TCHAR(__FUNCTION__), *Definition->Row.Name);
 		return;
 	}
 
 	// 아이템을 캐릭터에 바인딩
-	UE_LOG(LogTemp, Log, TEXT("[%s] Binding item %s to character %s"), ANSI_TO_TCHAR(__FUNCTION__), *Item->Name, *OwningCharacter->GetName());
-	Item->BindToPlayer(OwningCharacter);
+	UE_LOG(LogTemp, Log, TEXT("[%s] Binding item %s to character %s"), ANSI_TO_TCHAR(__FUNCTION__), *Definition->Row.Name, *OwningCharacter->GetName());
+	BindItemEventsToCharacter(OwningCharacter);
+	Definition->Behavior->ApplyStats(*Definition, Instance, OwningCharacter);
+}
+
+AAOSCharacterBase* AArenaPlayerState::GetOwningCharacter() const
+{
+	// PlayerController의 Pawn을 가져와서 AAOSCharacterBase로 캐스팅
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	if (::IsValid(PlayerController) == false)
+	{
+		return nullptr;
+	}
+
+	return Cast<AAOSCharacterBase>(PlayerController->GetPawn());
+}
+
+/**
+ * 캐릭터 이벤트를 플레이어 상태에 한 번만 바인딩합니다.
+ * 아이템 정의는 공유 객체이므로 직접 바인딩하지 않고, 이벤트가 오면 인벤토리의 아이템마다 전달합니다.
+ */
+void AArenaPlayerState::BindItemEventsToCharacter(AAOSCharacterBase* Character)
+{
+	if (::IsValid(Character) == false)
+	{
+		return;
+	}
+
+	if (Character->OnHitEventTriggered.IsAlreadyBound(this, &ThisClass::OnOwnerHit) == false)
+	{
+		Character->OnHitEventTriggered.AddDynamic(this, &ThisClass::OnOwnerHit);
+	}
+
+	if (Character->OnAttackEventTriggered.IsAlreadyBound(this, &ThisClass::OnOwnerAttack) == false)
+	{
+		Character->OnAttackEventTriggered.AddDynamic(this, &ThisClass::OnOwnerAttack);
+	}
+
+	if (Character->OnAbilityEffectsEventTriggered.IsAlreadyBound(this, &ThisClass::OnOwnerAbilityEffects) == false)
+	{
+		Character->OnAbilityEffectsEventTriggered.AddDynamic(this, &ThisClass::OnOwnerAbilityEffects);
+	}
+
+	if (Character->OnReceiveDamageEnteredEvent.IsAlreadyBound(this, &ThisClass::OnOwnerReceiveDamageEntered) == false)
+	{
+		Character->OnReceiveDamageEnteredEvent.AddDynamic(this, &ThisClass::OnOwnerReceiveDamageEntered);
+	}
+
+	if (Character->OnPreDeathEvent.IsAlreadyBound(this, &ThisClass::OnOwnerPreDeath) == false)
+	{
+		Character->OnPreDeathEvent.AddDynamic(this, &ThisClass::OnOwnerPreDeath);
+	}
+}
+
+void AArenaPlayerState::OnOwnerHit(FDamageInformation& DamageInformation)
+{
+	for (const FItemInstance& Instance : Inventory)
+	{
+		if (const FItemDefinition* Definition = Instance.IsEmpty() ? nullptr : FindItemDefinition(Instance.ItemCode))
+		{
+			Definition->Behavior->OnHit(*Definition, Instance, this, DamageInformation);
+		}
+	}
+}
+
+void AArenaPlayerState::OnOwnerAttack(FDamageInformation& DamageInformation)
+{
+	for (const FItemInstance& Instance : Inventory)
+	{
+		if (const FItemDefinition* Definition = Instance.IsEmpty() ? nullptr : FindItemDefinition(Instance.ItemCode))
+		{
+			Definition->Behavior->OnAttack(*Definition, Instance, this, DamageInformation);
+		}
+	}
+}
+
+void AArenaPlayerState::OnOwnerAbilityEffects(FDamageInformation& DamageInformation)
+{
+	for (const FItemInstance& Instance : Inventory)
+	{
+		if (const FItemDefinition* Definition = Instance.IsEmpty() ? nullptr : FindItemDefinition(Instance.ItemCode))
+		{
+			Definition->Behavior->OnAbilityEffects(*Definition, Instance, this, DamageInformation);
+		}
+	}
+}
+
+void AArenaPlayerState::OnOwnerReceiveDamageEntered(bool& bResult)
+{
+	for (const FItemInstance& Instance : Inventory)
+	{
+		if (const FItemDefinition* Definition = Instance.IsEmpty() ? nullptr : FindItemDefinition(Instance.ItemCode))
+		{
+			Definition->Behavior->OnReceiveDamageEntered(*Definition, Instance, this, bResult);
+		}
+	}
+}
+
+void AArenaPlayerState::OnOwnerPreDeath(bool& bDeath)
+{
+	for (const FItemInstance& Instance : Inventory)
+	{
+		// 한 아이템이 사망을 막았다면 나머지는 발동하지 않습니다.
+		if (bDeath == false)
+		{
+			return;
+		}
+
+		if (const FItemDefinition* Definition = Instance.IsEmpty() ? nullptr : FindItemDefinition(Instance.ItemCode))
+		{
+			Definition->Behavior->OnPreDeath(*Definition, Instance, this, bDeath);
+		}
+	}
 }
 
 
@@ -765,30 +790,181 @@ void AArenaPlayerState::OnPlayerLevelChanged(int32 OldLevel, int32 NewLevel)
 }
 
 
+int32 AArenaPlayerState::GetCurrency() const
+{
+	return Income.Evaluate(GetServerTime());
+}
+
+void AArenaPlayerState::SetCurrency(int32 NewCurrency)
+{
+	if (HasAuthority() == false)
+	{
+		return;
+	}
+
+	Income.BaseAmount += NewCurrency - GetCurrency();
+	NotifyCurrencyChanged();
+}
+
 void AArenaPlayerState::AddCurrency(const int32 Amount)
+{
+	if (HasAuthority() == false || Amount == 0)
+	{
+		return;
+	}
+
+	Income.BaseAmount += Amount;
+	NotifyCurrencyChanged();
+}
+
+void AArenaPlayerState::StartPassiveIncome(float GoldPerSecond)
 {
 	if (HasAuthority() == false)
 	{
 		return;
 	}
 
-	Currency = Currency + Amount;
+	// 지금까지 쌓인 골드를 BaseAmount 에 합치고, 1골드 미만의 진행분은 새 Epoch 로 옮깁니다.
+	const double Now = GetServerTime();
+	const double Accrued = Income.Rate > 0.f ? FMath::Max(Now - Income.Epoch, 0.0) * Income.Rate : 0.0;
+	const double Fraction = Accrued - FMath::FloorToDouble(Accrued);
+
+	Income.BaseAmount += FMath::FloorToInt32(Accrued);
+	Income.Rate = FMath::Max(GoldPerSecond, 0.f);
+	Income.Epoch = Income.Rate > 0.f ? Now - Fraction / Income.Rate : Now;
+
+	NotifyCurrencyChanged();
+}
+
+double AArenaPlayerState::GetServerTime() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.0;
+	}
+
+	const AGameStateBase* CurrentGameState = World->GetGameState();
+	return CurrentGameState ? CurrentGameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void AArenaPlayerState::NotifyCurrencyChanged()
+{
+	// 서버에서는 OnRep 이 호출되지 않으므로 직접 갱신합니다. (리슨 서버 호스트 HUD)
+	OnRep_CurrencyUpdated();
 }
 
 void AArenaPlayerState::OnRep_CurrencyUpdated()
 {
 	if (OnCurrencyUpdated.IsBound())
 	{
-		OnCurrencyUpdated.Broadcast(Currency);
+		OnCurrencyUpdated.Broadcast(GetCurrency());
 	}
+
+	ScheduleCurrencyDisplayUpdate();
 }
 
+void AArenaPlayerState::ScheduleCurrencyDisplayUpdate()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	World->GetTimerManager().ClearTimer(CurrencyDisplayTimer);
+
+	// 골드 표시는 로컬 플레이어에게만 필요합니다.
+	const APlayerController* OwningController = GetPlayerController();
+	if (Income.Rate <= 0.f || !OwningController || OwningController->IsLocalController() == false)
+	{
+		return;
+	}
+
+	// 다음 1골드가 쌓이는 시점에 한 번만 갱신합니다.
+	const double Elapsed = FMath::Max(GetServerTime() - Income.Epoch, 0.0);
+	const double NextGoldTime = (FMath::FloorToDouble(Elapsed * Income.Rate) + 1.0) / Income.Rate;
+	const float Delay = FMath::Max(static_cast<float>(NextGoldTime - Elapsed), KINDA_SMALL_NUMBER) + KINDA_SMALL_NUMBER;
+
+	World->GetTimerManager().SetTimer(CurrencyDisplayTimer, this, &AArenaPlayerState::HandleCurrencyDisplayUpdate, Delay, false);
+}
+
+void AArenaPlayerState::HandleCurrencyDisplayUpdate()
+{
+	if (OnCurrencyUpdated.IsBound())
+	{
+		OnCurrencyUpdated.Broadcast(GetCurrency());
+	}
+
+	ScheduleCurrencyDisplayUpdate();
+}
+
+void AArenaPlayerState::SetLoadStage(EPlayerLoadStage NewLoadStage)
+{
+	if (LoadStage == NewLoadStage)
+	{
+		return;
+	}
+
+	LoadStage = NewLoadStage;
+
+	// 서버(리슨 서버 호스트)에서는 OnRep 이 호출되지 않으므로 직접 알립니다.
+	OnRep_LoadStage();
+}
 
-void AArenaPlayerState::ClientInventoryChanged_Implementation(const int32 InventortIndex, const int32 ItemCode, const int32 CurrentStack)
+void AArenaPlayerState::OnRep_LoadStage()
+{
+	if (OnLoadStageChanged.IsBound())
+	{
+		OnLoadStageChanged.Broadcast(this, LoadStage);
+	}
+}
+
+
+/**
+ * 서버 인벤토리 슬롯을 복제용 FastArray 에 반영합니다.
+ * 같은 프레임에 바뀐 슬롯들은 하나의 델타로 전송됩니다.
+ */
+void AArenaPlayerState::SyncInventorySlot(int32 SlotIndex)
+{
+	if (HasAuthority() == false || Inventory.IsValidIndex(SlotIndex) == false)
+	{
+		return;
+	}
+
+	const FItemInstance& Instance = Inventory[SlotIndex];
+	const bool bOccupied = Instance.IsEmpty() == false;
+
+	// 재사용 대기는 ItemCode 단위로 기록되므로 슬롯을 옮기거나 다시 사도 유지됩니다.
+	const FItemEffectState* Effect = bOccupied ? ItemEffects.Find(Instance.ItemCode) : nullptr;
+	InventoryList.SetSlot(SlotIndex, Instance, Effect ? Effect->CooldownEndTime : 0.f);
+
+	// 리슨 서버 호스트는 복제 콜백을 받지 않으므로 직접 알립니다.
+	const APlayerController* OwningController = GetPlayerController();
+	if (OwningController && OwningController->IsLocalController())
+	{
+		HandleInventorySlotReplicated(SlotIndex, bOccupied ? Instance.ItemCode : -1, bOccupied ? Instance.Stack : 0);
+	}
+}
+
+void AArenaPlayerState::SetItemCooldownEnd(int32 ItemCode, float EndTime)
+{
+	FindOrAddItemEffect(ItemCode).CooldownEndTime = EndTime;
+
+	for (int32 SlotIndex = 0; SlotIndex < Inventory.Num(); ++SlotIndex)
+	{
+		if (Inventory[SlotIndex].IsEmpty() == false && Inventory[SlotIndex].ItemCode == ItemCode)
+		{
+			InventoryList.SetCooldownEnd(SlotIndex, EndTime);
+		}
+	}
+}
+
+void AArenaPlayerState::HandleInventorySlotReplicated(int32 SlotIndex, int32 ItemCode, int32 Stack)
 {
 	if (OnInventoryUpdated.IsBound())
 	{
-		OnInventoryUpdated.Broadcast(InventortIndex, ItemCode, CurrentStack);
+		OnInventoryUpdated.Broadcast(SlotIndex, ItemCode, Stack);
 	}
 }
 
@@ -856,7 +1032,8 @@ bool AArenaPlayerState::IsTimerActive(const uint32 UniqueCode) const
  * 아이템 타이머를 설정합니다.
  *
  * 주어진 아이템 ID에 대해 타이머를 설정하고, 타이머가 만료되었을 때 실행할 콜백을 지정합니다.
- * 또한, 주기적으로 남은 시간을 브로드캐스트하는 보조 타이머를 설정합니다.
+ * bBroadcast 가 참이면 설정 / 갱신 시점에 남은 시간과 경과 시간을 클라이언트에 한 번만 알립니다.
+ * 그 사이의 진행은 클라이언트 HUD 가 종료 시각을 기준으로 직접 계산합니다.
  *
  * @param ItemCode 타이머를 설정할 아이템의 ID.
  * @param Duration 타이머의 지속 시간.
@@ -904,13 +1081,13 @@ void AArenaPlayerState::InternalSetTimer(const uint32 UniqueCode, FTimerUnifiedD
 
 	if (bBroadcast)
 	{
-		FTimerHandle& BroadcastTimerHandle = BroadcastTimerHandles.FindOrAdd(UniqueCode);
-		World->GetTimerManager().SetTimer(BroadcastTimerHandle, [this, UniqueCode]()
-			{
-				float RemainingTime = GetTimerRemaining(UniqueCode);
-				float ElapsedTime = GetTimerElapsedTime(UniqueCode);
-				ClientNotifyRemainingTime(UniqueCode, RemainingTime, ElapsedTime);
-			}, 0.05f, true, 0.0f);
+		BroadcastTimerCodes.Add(UniqueCode);
+		ClientNotifyRemainingTime(UniqueCode, GetTimerRemaining(UniqueCode), GetTimerElapsedTime(UniqueCode));
+	}
+	else if (BroadcastTimerCodes.Remove(UniqueCode) > 0)
+	{
+		// 같은 코드가 브로드캐스트 없이 다시 설정되면 클라이언트 표시를 정리합니다.
+		ClientNotifyRemainingTime(UniqueCode, 0.f, 0.f);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("[%s] Timer set successfully. UniqueCode: %u, Rate: %f, Loop: %s, FirstDelay: %f"), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode, InRate, bInLoop ? TEXT("true") : TEXT("false"), InFirstDelay);
@@ -920,7 +1097,7 @@ void AArenaPlayerState::InternalSetTimer(const uint32 UniqueCode, FTimerUnifiedD
 /**
  * 타이머를 제거합니다.
  *
- * 주어진 ID에 대해 활성화된 타이머와 주기적으로 남은 시간을 브로드캐스트하는 타이머를 제거합니다.
+ * 주어진 ID에 대해 활성화된 타이머를 제거하고, 브로드캐스트 중이던 타이머라면 클라이언트에 종료를 알립니다.
  *
  * @param UniqueCode 제거할 타이머의 이름.
  */
@@ -933,12 +1110,9 @@ void AArenaPlayerState::ClearTimer(const uint32 UniqueCode)
 		TimerHandles.Remove(UniqueCode);
 	}
 
-	// 브로드캐스트 타이머도 제거
-	FTimerHandle* BroadcastTimerHandle = BroadcastTimerHandles.Find(UniqueCode);
-	if (BroadcastTimerHandle)
+	if (BroadcastTimerCodes.Remove(UniqueCode) > 0)
 	{
-		GetWorld()->GetTimerManager().ClearTimer(*BroadcastTimerHandle);
-		BroadcastTimerHandles.Remove(UniqueCode);
+		ClientNotifyRemainingTime(UniqueCode, 0.f, 0.f);
 	}
 }
 
@@ -0,0 +1,594 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/ArenaReplicationGraph.h"
+#include "Game/ArenaPlayerState.h"
+#include "Characters/CharacterBase.h"
+#include "Characters/AOSCharacterBase.h"
+#include "Characters/MinionBase.h"
+#include "Props/ArrowBase.h"
+#include "Props/Nexus.h"
+#include "Props/Projectile.h"
+#include "Props/SplineActor.h"
+#include "Engine/LevelScriptActor.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "Net/UnrealNetwork.h"
+#include "UObject/UObjectIterator.h"
+
+
+static TAutoConsoleVariable<int32> CVarArenaRepGraphDisableTeamVision(
+	TEXT("Arena.RepGraph.DisableTeamVision"),
+	0,
+	TEXT("1 이면 팀 시야 필터를 끄고 모든 시야 대상 액터를 모든 연결에 수집합니다."),
+	ECVF_Cheat);
+
+
+/** --------------------------------------------------------------------------------
+ * FArenaVisionGrid
+ */
+
+void FArenaVisionGrid::Initialize(const FVector2D& InOrigin, const FVector2D& InExtent, float InCellSize)
+{
+	CellSize = FMath::Max(InCellSize, 100.f);
+	Origin = InOrigin - InExtent;
+	NumCellsX = FMath::Max(1, FMath::CeilToInt((InExtent.X * 2.f) / CellSize));
+	NumCellsY = FMath::Max(1, FMath::CeilToInt((InExtent.Y * 2.f) / CellSize));
+
+	BlueVisibleCells.Init(false, GetNumCells());
+	RedVisibleCells.Init(false, GetNumCells());
+}
+
+void FArenaVisionGrid::ResetVision()
+{
+	BlueVisibleCells.SetRange(0, BlueVisibleCells.Num(), false);
+	RedVisibleCells.SetRange(0, RedVisibleCells.Num(), false);
+}
+
+void FArenaVisionGrid::RevealCircle(ETeamSide Team, const FVector& Location, float Radius)
+{
+	TBitArray<>* VisibleCells = (Team == ETeamSide::Blue) ? &BlueVisibleCells : (Team == ETeamSide::Red) ? &RedVisibleCells : nullptr;
+	if (!VisibleCells || Radius <= 0.f || GetNumCells() == 0)
+	{
+		return;
+	}
+
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt((Location.X - Radius - Origin.X) / CellSize), 0, NumCellsX - 1);
+	const int32 MaxX = FMath::Clamp(FMath::FloorToInt((Location.X + Radius - Origin.X) / CellSize), 0, NumCellsX - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt((Location.Y - Radius - Origin.Y) / CellSize), 0, NumCellsY - 1);
+	const int32 MaxY = FMath::Clamp(FMath::FloorToInt((Location.Y + Radius - Origin.Y) / CellSize), 0, NumCellsY - 1);
+
+	// 셀의 가장 가까운 점이 반경 안에 있으면 보이는 셀로 처리
+	const float RadiusSquared = Radius * Radius;
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		const float CellMinY = Origin.Y + Y * CellSize;
+		const float ClosestY = FMath::Clamp<float>(Location.Y, CellMinY, CellMinY + CellSize);
+
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const float CellMinX = Origin.X + X * CellSize;
+			const float ClosestX = FMath::Clamp<float>(Location.X, CellMinX, CellMinX + CellSize);
+
+			if (FMath::Square(ClosestX - Location.X) + FMath::Square(ClosestY - Location.Y) <= RadiusSquared)
+			{
+				(*VisibleCells)[Y * NumCellsX + X] = true;
+			}
+		}
+	}
+}
+
+int32 FArenaVisionGrid::GetCellIndex(const FVector& Location) const
+{
+	if (GetNumCells() == 0)
+	{
+		return INDEX_NONE;
+	}
+
+	// 그리드 밖의 위치는 가장자리 셀로 묶습니다.
+	const int32 X = FMath::Clamp(FMath::FloorToInt((Location.X - Origin.X) / CellSize), 0, NumCellsX - 1);
+	const int32 Y = FMath::Clamp(FMath::FloorToInt((Location.Y - Origin.Y) / CellSize), 0, NumCellsY - 1);
+	return Y * NumCellsX + X;
+}
+
+FVector2D FArenaVisionGrid::GetCellCenter(int32 CellIndex) const
+{
+	const int32 X = CellIndex % NumCellsX;
+	const int32 Y = CellIndex / NumCellsX;
+	return FVector2D(Origin.X + (X + 0.5f) * CellSize, Origin.Y + (Y + 0.5f) * CellSize);
+}
+
+bool FArenaVisionGrid::IsCellVisible(ETeamSide Team, int32 CellIndex) const
+{
+	if (CellIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	switch (Team)
+	{
+	case ETeamSide::Blue:
+		return BlueVisibleCells.IsValidIndex(CellIndex) && BlueVisibleCells[CellIndex];
+	case ETeamSide::Red:
+		return RedVisibleCells.IsValidIndex(CellIndex) && RedVisibleCells[CellIndex];
+	default:
+		return true;
+	}
+}
+
+
+/** --------------------------------------------------------------------------------
+ * UArenaReplicationGraphNode_TeamVisionGrid
+ */
+
+UArenaReplicationGraphNode_TeamVisionGrid::UArenaReplicationGraphNode_TeamVisionGrid()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	if (ActorInfo.Actor)
+	{
+		TrackedActors.AddUnique(ActorInfo.Actor);
+	}
+}
+
+bool UArenaReplicationGraphNode_TeamVisionGrid::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	const bool bRemoved = TrackedActors.RemoveSwap(ActorInfo.Actor) > 0;
+	if (!bRemoved && bWarnIfNotFound)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Actor %s was not tracked by the team vision grid."), ANSI_TO_TCHAR(__FUNCTION__), *GetNameSafe(ActorInfo.Actor));
+	}
+
+	// 다음 PrepareForReplication 전까지 제거된 액터가 수집되지 않도록 이미 만들어진 리스트에서도 뺍니다.
+	if (bRemoved)
+	{
+		for (const int32 CellIndex : OccupiedCells)
+		{
+			FVisionCell& Cell = Cells[CellIndex];
+			Cell.BlueActors.RemoveFast(ActorInfo.Actor);
+			Cell.RedActors.RemoveFast(ActorInfo.Actor);
+			Cell.NeutralActors.RemoveFast(ActorInfo.Actor);
+		}
+
+		BlueTeamActors.RemoveFast(ActorInfo.Actor);
+		RedTeamActors.RemoveFast(ActorInfo.Actor);
+		AllActors.RemoveFast(ActorInfo.Actor);
+	}
+
+	return bRemoved;
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::NotifyResetAllNetworkActors()
+{
+	TrackedActors.Reset();
+
+	for (const int32 CellIndex : OccupiedCells)
+	{
+		Cells[CellIndex].Reset();
+	}
+	OccupiedCells.Reset();
+
+	BlueTeamActors.Reset();
+	RedTeamActors.Reset();
+	AllActors.Reset();
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::AddVisionSource(AActor* Actor)
+{
+	if (::IsValid(Actor))
+	{
+		VisionSources.AddUnique(Actor);
+	}
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::RemoveVisionSource(AActor* Actor)
+{
+	VisionSources.RemoveSwap(Actor);
+}
+
+ETeamSide UArenaReplicationGraphNode_TeamVisionGrid::GetActorTeam(const AActor* Actor)
+{
+	// 액터 자신, 또는 소유자 체인에서 팀 정보를 찾습니다. (화살, 스플라인 등은 소유 캐릭터의 팀을 따름)
+	for (const AActor* Current = Actor; Current; Current = Current->GetOwner())
+	{
+		if (const ACharacterBase* Character = Cast<ACharacterBase>(Current))
+		{
+			return Character->TeamSide;
+		}
+
+		if (const AArrowBase* Arrow = Cast<AArrowBase>(Current))
+		{
+			return Arrow->TeamSide;
+		}
+	}
+
+	return ETeamSide::Neutral;
+}
+
+float UArenaReplicationGraphNode_TeamVisionGrid::GetSightRadius(const AActor* Actor) const
+{
+	const ACharacterBase* Character = Cast<ACharacterBase>(Actor);
+	if (!Character || EnumHasAnyFlags(Character->CharacterState, ECharacterState::Death))
+	{
+		return 0.f;
+	}
+
+	switch (Character->ObjectType)
+	{
+	case EObjectType::Player:
+		return ChampionSightRadius;
+	case EObjectType::Minion:
+		return MinionSightRadius;
+	default:
+		return Character->IsA<ANexus>() ? StructureSightRadius : 0.f;
+	}
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::AddToTeamList(FVisionCell& Cell, ETeamSide Team, AActor* Actor)
+{
+	switch (Team)
+	{
+	case ETeamSide::Blue:
+		Cell.BlueActors.Add(Actor);
+		BlueTeamActors.Add(Actor);
+		break;
+	case ETeamSide::Red:
+		Cell.RedActors.Add(Actor);
+		RedTeamActors.Add(Actor);
+		break;
+	default:
+		Cell.NeutralActors.Add(Actor);
+		break;
+	}
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::PrepareForReplication()
+{
+	if (Cells.Num() != VisionGrid.GetNumCells())
+	{
+		Cells.SetNum(VisionGrid.GetNumCells());
+	}
+
+	for (const int32 CellIndex : OccupiedCells)
+	{
+		Cells[CellIndex].Reset();
+	}
+	OccupiedCells.Reset();
+
+	BlueTeamActors.Reset();
+	RedTeamActors.Reset();
+	AllActors.Reset();
+	VisionGrid.ResetVision();
+
+	// 1. 액터를 셀 / 팀별로 분류하고 시야를 밝힙니다. 연결 수와 무관하게 프레임당 한 번만 수행됩니다.
+	for (AActor* Actor : TrackedActors)
+	{
+		if (!::IsValid(Actor))
+		{
+			continue;
+		}
+
+		const FVector Location = Actor->GetActorLocation();
+		const int32 CellIndex = VisionGrid.GetCellIndex(Location);
+		if (!Cells.IsValidIndex(CellIndex))
+		{
+			continue;
+		}
+
+		FVisionCell& Cell = Cells[CellIndex];
+		if (Cell.BlueActors.Num() == 0 && Cell.RedActors.Num() == 0 && Cell.NeutralActors.Num() == 0)
+		{
+			OccupiedCells.Add(CellIndex);
+		}
+
+		const ETeamSide Team = GetActorTeam(Actor);
+		AddToTeamList(Cell, Team, Actor);
+		AllActors.Add(Actor);
+
+		VisionGrid.RevealCircle(Team, Location, GetSightRadius(Actor));
+	}
+
+	// 2. 복제는 다른 노드가 담당하지만 시야를 제공하는 액터 (넥서스 등)
+	for (int32 Index = VisionSources.Num() - 1; Index >= 0; --Index)
+	{
+		AActor* Source = VisionSources[Index].Get();
+		if (!::IsValid(Source))
+		{
+			VisionSources.RemoveAtSwap(Index);
+			continue;
+		}
+
+		VisionGrid.RevealCircle(GetActorTeam(Source), Source->GetActorLocation(), GetSightRadius(Source));
+	}
+}
+
+void UArenaReplicationGraphNode_TeamVisionGrid::GatherForTeam(ETeamSide ViewerTeam, const FVector& ViewLocation, bool bIncludeFarCells, FGatheredReplicationActorLists& OutGatheredLists)
+{
+	const bool bHasTeam = (ViewerTeam == ETeamSide::Blue || ViewerTeam == ETeamSide::Red);
+	if (!bHasTeam || CVarArenaRepGraphDisableTeamVision.GetValueOnGameThread() != 0)
+	{
+		if (AllActors.Num() > 0)
+		{
+			OutGatheredLists.AddReplicationActorList(AllActors);
+		}
+		return;
+	}
+
+	// 아군은 시야와 무관하게 항상 복제
+	FActorRepListRefView& AllyActors = (ViewerTeam == ETeamSide::Blue) ? BlueTeamActors : RedTeamActors;
+	if (AllyActors.Num() > 0)
+	{
+		OutGatheredLists.AddReplicationActorList(AllyActors);
+	}
+
+	const float NearRadiusSquared = FMath::Square(NearCellRadius);
+	const FVector2D ViewLocation2D(ViewLocation.X, ViewLocation.Y);
+
+	// 적 / 중립 액터는 해당 팀이 보고 있는 셀에 있을 때만 복제
+	for (const int32 CellIndex : OccupiedCells)
+	{
+		if (!VisionGrid.IsCellVisible(ViewerTeam, CellIndex))
+		{
+			continue;
+		}
+
+		if (!bIncludeFarCells && FVector2D::DistSquared(VisionGrid.GetCellCenter(CellIndex), ViewLocation2D) > NearRadiusSquared)
+		{
+			continue;
+		}
+
+		FVisionCell& Cell = Cells[CellIndex];
+		FActorRepListRefView& EnemyActors = (ViewerTeam == ETeamSide::Blue) ? Cell.RedActors : Cell.BlueActors;
+
+		if (EnemyActors.Num() > 0)
+		{
+			OutGatheredLists.AddReplicationActorList(EnemyActors);
+		}
+
+		if (Cell.NeutralActors.Num() > 0)
+		{
+			OutGatheredLists.AddReplicationActorList(Cell.NeutralActors);
+		}
+	}
+}
+
+
+/** --------------------------------------------------------------------------------
+ * UArenaReplicationGraphNode_TeamVisionForConnection
+ */
+
+void UArenaReplicationGraphNode_TeamVisionForConnection::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (!VisionGridNode || Params.Viewers.Num() == 0)
+	{
+		return;
+	}
+
+	const FNetViewer& Viewer = Params.Viewers[0];
+
+	ETeamSide ViewerTeam = ETeamSide::None;
+	if (const APlayerController* PlayerController = Cast<APlayerController>(Viewer.InViewer))
+	{
+		if (const AArenaPlayerState* ArenaPlayerState = PlayerController->GetPlayerState<AArenaPlayerState>())
+		{
+			ViewerTeam = ArenaPlayerState->TeamSide;
+		}
+	}
+
+	// 원거리 셀은 연결마다 다른 프레임에 수집해 부하를 분산
+	const bool bIncludeFarCells = FarBucketPeriod <= 1 || ((Params.ReplicationFrameNum + BucketOffset) % FarBucketPeriod) == 0;
+
+	VisionGridNode->GatherForTeam(ViewerTeam, Viewer.ViewLocation, bIncludeFarCells, Params.OutGatheredReplicationLists);
+}
+
+
+/** --------------------------------------------------------------------------------
+ * UArenaReplicationGraph
+ */
+
+UArenaReplicationGraph::UArenaReplicationGraph()
+{
+}
+
+EArenaClassRepNodeMapping UArenaReplicationGraph::GetExplicitMappingPolicy(UClass* Class) const
+{
+	// 순서가 중요합니다. 하위 클래스가 먼저 검사되어야 합니다.
+	if (Class->IsChildOf(APlayerController::StaticClass()))
+	{
+		return EArenaClassRepNodeMapping::NotRouted;
+	}
+
+	if (Class->IsChildOf(AGameStateBase::StaticClass()) || Class->IsChildOf(ANexus::StaticClass()))
+	{
+		return EArenaClassRepNodeMapping::RelevantAllConnections;
+	}
+
+	if (Class->IsChildOf(APlayerState::StaticClass()))
+	{
+		return EArenaClassRepNodeMapping::PlayerState;
+	}
+
+	if (Class->IsChildOf(ACharacterBase::StaticClass()) ||
+		Class->IsChildOf(AArrowBase::StaticClass()) ||
+		Class->IsChildOf(AProjectile::StaticClass()) ||
+		Class->IsChildOf(ASplineActor::StaticClass()))
+	{
+		return EArenaClassRepNodeMapping::TeamVision;
+	}
+
+	return EArenaClassRepNodeMapping::NotRouted;
+}
+
+EArenaClassRepNodeMapping UArenaReplicationGraph::GetMappingPolicy(UClass* Class) const
+{
+	const EArenaClassRepNodeMapping ExplicitPolicy = GetExplicitMappingPolicy(Class);
+	if (ExplicitPolicy != EArenaClassRepNodeMapping::NotRouted || Class->IsChildOf(APlayerController::StaticClass()))
+	{
+		return ExplicitPolicy;
+	}
+
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	if (!ActorCDO || !ActorCDO->GetIsReplicated())
+	{
+		return EArenaClassRepNodeMapping::NotRouted;
+	}
+
+	// 소유자 전용 액터는 연결별 노드가 뷰어 / 뷰 타겟으로 수집합니다.
+	if (ActorCDO->bOnlyRelevantToOwner)
+	{
+		return EArenaClassRepNodeMapping::NotRouted;
+	}
+
+	if (ActorCDO->bAlwaysRelevant)
+	{
+		return EArenaClassRepNodeMapping::RelevantAllConnections;
+	}
+
+	// 그 외 공간상의 액터는 중립으로 취급되어 시야 그리드를 따릅니다.
+	return EArenaClassRepNodeMapping::TeamVision;
+}
+
+void UArenaReplicationGraph::InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, EArenaClassRepNodeMapping Mapping) const
+{
+	const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+	if (!ActorCDO)
+	{
+		return;
+	}
+
+	// 시야 그리드가 관련성을 결정하므로 거리 컬링은 사용하지 않습니다.
+	Info.SetCullDistanceSquared(Mapping == EArenaClassRepNodeMapping::TeamVision ? 0.f : ActorCDO->NetCullDistanceSquared);
+
+	const float ServerMaxTickRate = NetDriver ? static_cast<float>(NetDriver->GetNetServerMaxTickRate()) : 30.f;
+	const float UpdateFrequency = FMath::Max(ActorCDO->NetUpdateFrequency, 1.f);
+	Info.ReplicationPeriodFrame = FMath::Max<uint32>(static_cast<uint32>(FMath::RoundToFloat(ServerMaxTickRate / UpdateFrequency)), 1);
+}
+
+void UArenaReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		const AActor* ActorCDO = Cast<AActor>(Class->GetDefaultObject());
+		if (!ActorCDO || !ActorCDO->GetIsReplicated())
+		{
+			continue;
+		}
+
+		// 블루프린트 컴파일 중 생성되는 임시 클래스 제외
+		const FString ClassName = Class->GetName();
+		if (ClassName.StartsWith(TEXT("SKEL_")) || ClassName.StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const EArenaClassRepNodeMapping Mapping = GetMappingPolicy(Class);
+		ClassRepNodePolicies.Set(Class, Mapping);
+
+		FClassReplicationInfo ClassInfo;
+		InitClassReplicationInfo(ClassInfo, Class, Mapping);
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, ClassInfo);
+	}
+
+	// 로드되지 않은 클래스는 ClassRepNodePolicies 의 상위 클래스 정책을 따릅니다.
+	ClassRepNodePolicies.Set(AActor::StaticClass(), EArenaClassRepNodeMapping::TeamVision);
+	ClassRepNodePolicies.Set(APlayerController::StaticClass(), EArenaClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(ALevelScriptActor::StaticClass(), EArenaClassRepNodeMapping::NotRouted);
+	ClassRepNodePolicies.Set(AGameStateBase::StaticClass(), EArenaClassRepNodeMapping::RelevantAllConnections);
+	ClassRepNodePolicies.Set(APlayerState::StaticClass(), EArenaClassRepNodeMapping::PlayerState);
+}
+
+void UArenaReplicationGraph::InitGlobalGraphNodes()
+{
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_ActorListFrequencyBuckets>();
+	PlayerStateNode->SetNonStreamingCollectionSize(FMath::Max(NumPlayerStateBuckets, 1));
+	AddGlobalGraphNode(PlayerStateNode);
+
+	TeamVisionGridNode = CreateNewNode<UArenaReplicationGraphNode_TeamVisionGrid>();
+	TeamVisionGridNode->VisionGrid.Initialize(GridOrigin, GridExtent, GridCellSize);
+	TeamVisionGridNode->ChampionSightRadius = ChampionSightRadius;
+	TeamVisionGridNode->MinionSightRadius = MinionSightRadius;
+	TeamVisionGridNode->StructureSightRadius = StructureSightRadius;
+	TeamVisionGridNode->NearCellRadius = NearCellRadius;
+	AddGlobalGraphNode(TeamVisionGridNode);
+}
+
+void UArenaReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager)
+{
+	Super::InitConnectionGraphNodes(ConnectionManager);
+
+	// 컨트롤러, 폰, 뷰 타겟
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* AlwaysRelevantForConnectionNode = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(AlwaysRelevantForConnectionNode, ConnectionManager);
+
+	UArenaReplicationGraphNode_TeamVisionForConnection* TeamVisionNode = CreateNewNode<UArenaReplicationGraphNode_TeamVisionForConnection>();
+	TeamVisionNode->VisionGridNode = TeamVisionGridNode;
+	TeamVisionNode->FarBucketPeriod = static_cast<uint32>(FMath::Clamp(FarBucketPeriod, 1, 4));
+	TeamVisionNode->BucketOffset = NextConnectionBucketOffset++;
+	AddConnectionGraphNode(TeamVisionNode, ConnectionManager);
+}
+
+void UArenaReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	const EArenaClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(ActorInfo.Class);
+	const EArenaClassRepNodeMapping Mapping = Policy ? *Policy : GetMappingPolicy(ActorInfo.Class);
+
+	switch (Mapping)
+	{
+	case EArenaClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+
+		// 넥서스처럼 항상 보이지만 주변 시야를 제공하는 구조물
+		if (ActorInfo.Actor && ActorInfo.Actor->IsA<ACharacterBase>())
+		{
+			TeamVisionGridNode->AddVisionSource(ActorInfo.Actor);
+		}
+		break;
+
+	case EArenaClassRepNodeMapping::PlayerState:
+		PlayerStateNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	case EArenaClassRepNodeMapping::TeamVision:
+		TeamVisionGridNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+
+	default:
+		break;
+	}
+}
+
+void UArenaReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	const EArenaClassRepNodeMapping* Policy = ClassRepNodePolicies.Get(ActorInfo.Class);
+	const EArenaClassRepNodeMapping Mapping = Policy ? *Policy : GetMappingPolicy(ActorInfo.Class);
+
+	switch (Mapping)
+	{
+	case EArenaClassRepNodeMapping::RelevantAllConnections:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		TeamVisionGridNode->RemoveVisionSource(ActorInfo.Actor);
+		break;
+
+	case EArenaClassRepNodeMapping::PlayerState:
+		PlayerStateNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	case EArenaClassRepNodeMapping::TeamVision:
+		TeamVisionGridNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+
+	default:
+		break;
+	}
+}
@@ -0,0 +1,274 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/ArenaSignificanceSubsystem.h"
+#include "Characters/CharacterBase.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "DrawDebugHelpers.h"
+
+
+static TAutoConsoleVariable<int32> CVarArenaSignificanceDebug(
+	TEXT("Arena.Significance.Debug"),
+	0,
+	TEXT("1: draw the significance tier above every managed minion / NPC."),
+	ECVF_Cheat);
+
+
+UArenaSignificanceSubsystem::UArenaSignificanceSubsystem()
+{
+	// MaxDistance, ActorTick, AnimTick, URO, Widget, WidgetTick, AIServiceScale
+	Tiers.Add(FSignificanceTierSettings(2000.f, 0.f, 0.f, false, true, 0.f, 1.f));		// High
+	Tiers.Add(FSignificanceTierSettings(4000.f, 0.05f, 0.f, true, true, 0.1f, 1.5f));	// Medium
+	Tiers.Add(FSignificanceTierSettings(7000.f, 0.1f, 0.1f, true, false, 0.25f, 2.f));	// Low
+	Tiers.Add(FSignificanceTierSettings(0.f, 0.25f, 0.25f, true, false, 0.5f, 3.f));		// Dormant
+
+	UpdateInterval = 0.25f;
+	HysteresisRatio = 0.1f;
+	NotRenderedTolerance = 0.5f;
+
+	NextEvaluateIndex = 0;
+	EvaluateAccumulator = 0.f;
+}
+
+bool UArenaSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UArenaSignificanceSubsystem::Deinitialize()
+{
+	ManagedCharacters.Empty();
+	ViewLocations.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UArenaSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UArenaSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+bool UArenaSignificanceSubsystem::IsManagedCharacter(const ACharacterBase* Character)
+{
+	if (::IsValid(Character) == false)
+	{
+		return false;
+	}
+
+	return Character->ObjectType == EObjectType::Minion
+		|| Character->ObjectType == EObjectType::Monster
+		|| Character->ObjectType == EObjectType::EpicMonster;
+}
+
+void UArenaSignificanceSubsystem::RegisterCharacter(ACharacterBase* Character)
+{
+	if (IsManagedCharacter(Character) == false)
+	{
+		return;
+	}
+
+	for (const FManagedCharacter& Managed : ManagedCharacters)
+	{
+		if (Managed.Character.Get() == Character)
+		{
+			return;
+		}
+	}
+
+	// 등록 즉시 한 번 평가해서 스폰 직후부터 알맞은 단계로 갱신되도록 합니다.
+	GatherViewLocations();
+
+	FManagedCharacter& NewEntry = ManagedCharacters.AddDefaulted_GetRef();
+	NewEntry.Character = Character;
+	NewEntry.Tier = EvaluateTier(Character, ESignificanceTier::High);
+
+	Character->ApplySignificance(NewEntry.Tier, GetTierSettings(NewEntry.Tier));
+}
+
+void UArenaSignificanceSubsystem::UnregisterCharacter(ACharacterBase* Character)
+{
+	for (int32 Index = 0; Index < ManagedCharacters.Num(); ++Index)
+	{
+		if (ManagedCharacters[Index].Character.Get() == Character)
+		{
+			ManagedCharacters.RemoveAtSwap(Index);
+			return;
+		}
+	}
+}
+
+const FSignificanceTierSettings& UArenaSignificanceSubsystem::GetTierSettings(ESignificanceTier Tier) const
+{
+	static const FSignificanceTierSettings DefaultSettings;
+
+	const int32 TierIndex = static_cast<int32>(Tier);
+	return Tiers.IsValidIndex(TierIndex) ? Tiers[TierIndex] : DefaultSettings;
+}
+
+void UArenaSignificanceSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (ManagedCharacters.Num() == 0)
+	{
+		return;
+	}
+
+	GatherViewLocations();
+
+	// UpdateInterval 동안 전체를 한 바퀴 평가하도록 이번 프레임의 평가 수를 계산합니다.
+	EvaluateAccumulator += ManagedCharacters.Num() * DeltaTime / FMath::Max(UpdateInterval, KINDA_SMALL_NUMBER);
+	const int32 NumToEvaluate = FMath::Min(FMath::FloorToInt(EvaluateAccumulator), ManagedCharacters.Num());
+	EvaluateAccumulator = FMath::Min(EvaluateAccumulator - NumToEvaluate, 1.f);
+
+	for (int32 Count = 0; Count < NumToEvaluate && ManagedCharacters.Num() > 0; ++Count)
+	{
+		if (NextEvaluateIndex >= ManagedCharacters.Num())
+		{
+			NextEvaluateIndex = 0;
+		}
+
+		FManagedCharacter& Managed = ManagedCharacters[NextEvaluateIndex];
+		ACharacterBase* Character = Managed.Character.Get();
+		if (::IsValid(Character) == false)
+		{
+			ManagedCharacters.RemoveAtSwap(NextEvaluateIndex);
+			continue;
+		}
+
+		++NextEvaluateIndex;
+
+		const ESignificanceTier NewTier = EvaluateTier(Character, Managed.Tier);
+		if (NewTier != Managed.Tier)
+		{
+			Managed.Tier = NewTier;
+			Character->ApplySignificance(NewTier, GetTierSettings(NewTier));
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	if (CVarArenaSignificanceDebug.GetValueOnGameThread() != 0)
+	{
+		DrawDebugSignificance();
+	}
+#endif
+}
+
+void UArenaSignificanceSubsystem::GatherViewLocations()
+{
+	ViewLocations.Reset();
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 클라이언트는 로컬 플레이어만, 서버는 모든 플레이어를 기준으로 평가합니다.
+	const bool bIsClient = World->GetNetMode() == NM_Client;
+
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		APlayerController* PlayerController = Iterator->Get();
+		if (::IsValid(PlayerController) == false)
+		{
+			continue;
+		}
+
+		if (bIsClient && PlayerController->IsLocalController() == false)
+		{
+			continue;
+		}
+
+		if (APawn* Pawn = PlayerController->GetPawn())
+		{
+			ViewLocations.Add(Pawn->GetActorLocation());
+		}
+		else
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+}
+
+ESignificanceTier UArenaSignificanceSubsystem::EvaluateTier(const ACharacterBase* Character, ESignificanceTier CurrentTier) const
+{
+	const int32 LastTierIndex = FMath::Min(Tiers.Num(), static_cast<int32>(ESignificanceTier::MAX)) - 1;
+	if (LastTierIndex <= 0 || ViewLocations.Num() == 0)
+	{
+		return ESignificanceTier::Dormant;
+	}
+
+	const FVector CharacterLocation = Character->GetActorLocation();
+
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, static_cast<float>(FVector::DistSquared2D(CharacterLocation, ViewLocation)));
+	}
+
+	const float Distance = FMath::Sqrt(MinDistanceSquared);
+	const int32 CurrentTierIndex = static_cast<int32>(CurrentTier);
+
+	int32 TierIndex = LastTierIndex;
+	for (int32 Index = 0; Index < LastTierIndex; ++Index)
+	{
+		// 현재 단계를 유지하거나 강등될 때는 임계값을 늘려 경계에서 흔들리지 않게 합니다.
+		const float Threshold = Tiers[Index].MaxDistance * (Index >= CurrentTierIndex ? 1.f + HysteresisRatio : 1.f);
+		if (Distance <= Threshold)
+		{
+			TierIndex = Index;
+			break;
+		}
+	}
+
+	// 클라이언트에서는 화면에 그려지지 않는 캐릭터를 한 단계 강등합니다.
+	// 서버(리슨 서버 포함)는 다른 플레이어의 시야를 알 수 없으므로 거리만 사용합니다.
+	if (GetWorld()->GetNetMode() == NM_Client && Character->WasRecentlyRendered(NotRenderedTolerance) == false)
+	{
+		TierIndex = FMath::Min(TierIndex + 1, LastTierIndex);
+	}
+
+	return static_cast<ESignificanceTier>(TierIndex);
+}
+
+#if !UE_BUILD_SHIPPING
+void UArenaSignificanceSubsystem::DrawDebugSignificance() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	static const TCHAR* TierNames[] = { TEXT("High"), TEXT("Medium"), TEXT("Low"), TEXT("Dormant") };
+	static const FColor TierColors[] = { FColor::Green, FColor::Yellow, FColor::Orange, FColor::Red };
+	static_assert(UE_ARRAY_COUNT(TierNames) == static_cast<int32>(ESignificanceTier::MAX), "TierNames must match ESignificanceTier");
+
+	int32 TierCounts[static_cast<int32>(ESignificanceTier::MAX)] = {};
+
+	for (const FManagedCharacter& Managed : ManagedCharacters)
+	{
+		const ACharacterBase* Character = Managed.Character.Get();
+		if (::IsValid(Character) == false)
+		{
+			continue;
+		}
+
+		const int32 TierIndex = static_cast<int32>(Managed.Tier);
+		++TierCounts[TierIndex];
+
+		DrawDebugString(World, Character->GetActorLocation() + FVector(0.f, 0.f, 160.f), TierNames[TierIndex], nullptr, TierColors[TierIndex], 0.f, true);
+	}
+
+	if (GEngine)
+	{
+		GEngine->AddOnScreenDebugMessage(static_cast<uint64>(reinterpret_cast<UPTRINT>(this)), 0.f, FColor::Cyan,
+			FString::Printf(TEXT("Significance: High %d / Medium %d / Low %d / Dormant %d"), TierCounts[0], TierCounts[1], TierCounts[2], TierCounts[3]));
+	}
+}
+#endif
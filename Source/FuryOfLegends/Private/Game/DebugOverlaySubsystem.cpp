@@ -0,0 +1,206 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/DebugOverlaySubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+
+#if ARENA_DEBUG_OVERLAY
+static TAutoConsoleVariable<int32> CVarArenaDebugCharacterState(
+	TEXT("Arena.Debug.CharacterState"),
+	0,
+	TEXT("1: show the active ECharacterState flags of every player character."),
+	ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarArenaDebugCombat(
+	TEXT("Arena.Debug.Combat"),
+	0,
+	TEXT("1: show ability overlap and hit messages."),
+	ECVF_Cheat);
+
+static TAutoConsoleVariable<int32> CVarArenaDebugTerrain(
+	TEXT("Arena.Debug.Terrain"),
+	0,
+	TEXT("1: draw terrain path analysis such as Aurora's dash segments."),
+	ECVF_Cheat);
+
+namespace
+{
+	TAutoConsoleVariable<int32>* const CategoryVariables[] = { &CVarArenaDebugCharacterState, &CVarArenaDebugCombat, &CVarArenaDebugTerrain };
+	const TCHAR* const CategoryNames[] = { TEXT("CharacterState"), TEXT("Combat"), TEXT("Terrain") };
+	const FColor CategoryColors[] = { FColor::Green, FColor::Red, FColor::Cyan };
+
+	static_assert(UE_ARRAY_COUNT(CategoryVariables) == static_cast<int32>(EDebugOverlayCategory::MAX), "CategoryVariables must match EDebugOverlayCategory");
+	static_assert(UE_ARRAY_COUNT(CategoryNames) == static_cast<int32>(EDebugOverlayCategory::MAX), "CategoryNames must match EDebugOverlayCategory");
+	static_assert(UE_ARRAY_COUNT(CategoryColors) == static_cast<int32>(EDebugOverlayCategory::MAX), "CategoryColors must match EDebugOverlayCategory");
+
+	constexpr int32 SphereSegments = 16;
+}
+#endif
+
+
+UDebugOverlaySubsystem* UDebugOverlaySubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UDebugOverlaySubsystem>() : nullptr;
+}
+
+bool UDebugOverlaySubsystem::IsCategoryEnabled(EDebugOverlayCategory Category)
+{
+#if ARENA_DEBUG_OVERLAY
+	const int32 Index = static_cast<int32>(Category);
+	return Index < UE_ARRAY_COUNT(CategoryVariables) && CategoryVariables[Index]->GetValueOnGameThread() != 0;
+#else
+	return false;
+#endif
+}
+
+FString UDebugOverlaySubsystem::DescribeFlags(const UEnum* Enum, int64 Flags)
+{
+	FString Result;
+
+#if ARENA_DEBUG_OVERLAY
+	if (!Enum)
+	{
+		return Result;
+	}
+
+	// 마지막 항목은 _MAX 입니다.
+	for (int32 Index = 0; Index < Enum->NumEnums() - 1; ++Index)
+	{
+		const int64 Value = Enum->GetValueByIndex(Index);
+		if (Value == 0 || (Flags & Value) != Value)
+		{
+			continue;
+		}
+
+		if (Result.IsEmpty() == false)
+		{
+			Result += TEXT(", ");
+		}
+		Result += Enum->GetNameStringByIndex(Index);
+	}
+#endif
+
+	return Result;
+}
+
+bool UDebugOverlaySubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if ARENA_DEBUG_OVERLAY
+	return IsRunningDedicatedServer() == false && Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+bool UDebugOverlaySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UDebugOverlaySubsystem::Deinitialize()
+{
+	TextLines.Empty();
+	PendingLines.Empty();
+	PendingPersistentLines.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UDebugOverlaySubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UDebugOverlaySubsystem, STATGROUP_Tickables);
+}
+
+void UDebugOverlaySubsystem::AddText(EDebugOverlayCategory Category, FString&& Text, float Duration)
+{
+	const UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	TextLines.Add({ Category, MoveTemp(Text), Now + FMath::Max(0.f, Duration) });
+}
+
+void UDebugOverlaySubsystem::AddSphere(const FVector& Center, float Radius, const FColor& Color, float LifeTime)
+{
+#if ARENA_DEBUG_OVERLAY
+	// DrawDebugLine 과 같이 수명이 있거나 영구인 선은 매 프레임 비워지지 않는 PersistentLineBatcher 로 보냅니다.
+	const bool bPersistent = LifeTime < 0.f;
+	TArray<FBatchedLine>& Lines = (bPersistent || LifeTime > 0.f) ? PendingPersistentLines : PendingLines;
+	const float LineLifeTime = bPersistent ? -1.f : LifeTime;
+
+	// XY, XZ, YZ 평면의 원 세 개로 그립니다.
+	const FVector Axes[3][2] = { { FVector::ForwardVector, FVector::RightVector }, { FVector::ForwardVector, FVector::UpVector }, { FVector::RightVector, FVector::UpVector } };
+	for (const FVector (&Axis)[2] : Axes)
+	{
+		FVector Previous = Center + Axis[0] * Radius;
+		for (int32 Segment = 1; Segment <= SphereSegments; ++Segment)
+		{
+			float Sin, Cos;
+			FMath::SinCos(&Sin, &Cos, 2.f * PI * Segment / SphereSegments);
+
+			const FVector Current = Center + (Axis[0] * Cos + Axis[1] * Sin) * Radius;
+			Lines.Emplace(Previous, Current, FLinearColor(Color), LineLifeTime, 2.f, SDPG_World);
+			Previous = Current;
+		}
+	}
+#endif
+}
+
+void UDebugOverlaySubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+#if ARENA_DEBUG_OVERLAY
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	if (PendingLines.Num() > 0 && World->LineBatcher)
+	{
+		World->LineBatcher->DrawLines(PendingLines);
+	}
+
+	if (PendingPersistentLines.Num() > 0 && World->PersistentLineBatcher)
+	{
+		World->PersistentLineBatcher->DrawLines(PendingPersistentLines);
+	}
+
+	PendingLines.Reset();
+	PendingPersistentLines.Reset();
+
+	if (TextLines.Num() == 0 || !GEngine)
+	{
+		return;
+	}
+
+	// 분류별로 한 메시지로 합칩니다. 키를 고정해 두어 이전 프레임의 메시지를 덮어씁니다.
+	FString Messages[static_cast<int32>(EDebugOverlayCategory::MAX)];
+	for (const FTextLine& Line : TextLines)
+	{
+		FString& Message = Messages[static_cast<int32>(Line.Category)];
+		if (Message.IsEmpty())
+		{
+			Message = FString::Printf(TEXT("[%s]"), CategoryNames[static_cast<int32>(Line.Category)]);
+		}
+
+		Message += TEXT("\n");
+		Message += Line.Text;
+	}
+
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Messages); ++Index)
+	{
+		if (Messages[Index].IsEmpty() == false)
+		{
+			const uint64 Key = static_cast<uint64>(reinterpret_cast<UPTRINT>(this)) + Index;
+			GEngine->AddOnScreenDebugMessage(Key, 0.f, CategoryColors[Index], Messages[Index]);
+		}
+	}
+
+	const double Now = World->GetTimeSeconds();
+	TextLines.RemoveAll([Now](const FTextLine& Line) { return Line.ExpireTime <= Now; });
+#endif
+}
@@ -0,0 +1,211 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/MatchStartBarrier.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+
+UMatchStartBarrier::UMatchStartBarrier()
+{
+	ExpectedPlayers = 0;
+	PlayerTimeout = 30.f;
+	NumReady = 0;
+	NumTimedOut = 0;
+	bReleased = false;
+}
+
+void UMatchStartBarrier::Initialize(int32 InExpectedPlayers, float InPlayerTimeout)
+{
+	Reset();
+
+	ExpectedPlayers = FMath::Max(InExpectedPlayers, 0);
+	PlayerTimeout = InPlayerTimeout;
+}
+
+void UMatchStartBarrier::Reset()
+{
+	if (UWorld* World = GetWorld())
+	{
+		for (TPair<int32, FTimerHandle>& Pair : TimeoutHandles)
+		{
+			World->GetTimerManager().ClearTimer(Pair.Value);
+		}
+	}
+
+	TimeoutHandles.Empty();
+	PlayerStages.Empty();
+	NumReady = 0;
+	NumTimedOut = 0;
+	bReleased = false;
+}
+
+void UMatchStartBarrier::RegisterPlayer(int32 PlayerIndex)
+{
+	if (PlayerStages.Contains(PlayerIndex))
+	{
+		return;
+	}
+
+	PlayerStages.Add(PlayerIndex, EPlayerLoadStage::None);
+	SetStage(PlayerIndex, EPlayerLoadStage::Connected);
+
+	UWorld* World = GetWorld();
+	if (bReleased == false && PlayerTimeout > 0.f && World)
+	{
+		FTimerHandle& Handle = TimeoutHandles.Add(PlayerIndex);
+		World->GetTimerManager().SetTimer(Handle, FTimerDelegate::CreateUObject(this, &UMatchStartBarrier::HandlePlayerTimeout, PlayerIndex), PlayerTimeout, false);
+	}
+}
+
+void UMatchStartBarrier::RemovePlayer(int32 PlayerIndex)
+{
+	const EPlayerLoadStage* Stage = PlayerStages.Find(PlayerIndex);
+	if (!Stage)
+	{
+		return;
+	}
+
+	if (*Stage == EPlayerLoadStage::Ready)
+	{
+		--NumReady;
+	}
+	else if (*Stage == EPlayerLoadStage::TimedOut)
+	{
+		--NumTimedOut;
+	}
+
+	ClearPlayerTimer(PlayerIndex);
+	PlayerStages.Remove(PlayerIndex);
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] Player %d left before the match started."), ANSI_TO_TCHAR(__FUNCTION__), PlayerIndex);
+
+	// 나간 플레이어를 더 기다리지 않도록 기대 인원에서도 뺍니다.
+	if (bReleased == false && ExpectedPlayers > 0)
+	{
+		--ExpectedPlayers;
+	}
+
+	TryRelease();
+}
+
+void UMatchStartBarrier::AdvanceStage(int32 PlayerIndex, EPlayerLoadStage NewStage)
+{
+	EPlayerLoadStage* Stage = PlayerStages.Find(PlayerIndex);
+	if (!Stage)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Player %d is not registered."), ANSI_TO_TCHAR(__FUNCTION__), PlayerIndex);
+		return;
+	}
+
+	const EPlayerLoadStage OldStage = *Stage;
+	if (OldStage != EPlayerLoadStage::TimedOut && NewStage <= OldStage)
+	{
+		return;
+	}
+
+	// 시간 초과된 플레이어는 준비가 끝날 때까지 TimedOut 으로 남겨 둡니다.
+	// 중간 단계로 되돌리면 타임아웃 타이머 없이 다시 멈춰 해제를 영원히 막을 수 있습니다.
+	if (OldStage == EPlayerLoadStage::TimedOut)
+	{
+		if (NewStage != EPlayerLoadStage::Ready)
+		{
+			return;
+		}
+
+		--NumTimedOut;
+	}
+
+	SetStage(PlayerIndex, NewStage);
+
+	if (NewStage != EPlayerLoadStage::Ready)
+	{
+		return;
+	}
+
+	++NumReady;
+	ClearPlayerTimer(PlayerIndex);
+
+	if (bReleased)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[%s] Late player %d is ready."), ANSI_TO_TCHAR(__FUNCTION__), PlayerIndex);
+		OnLatePlayerReady.Broadcast(PlayerIndex);
+		return;
+	}
+
+	TryRelease();
+}
+
+EPlayerLoadStage UMatchStartBarrier::GetPlayerStage(int32 PlayerIndex) const
+{
+	const EPlayerLoadStage* Stage = PlayerStages.Find(PlayerIndex);
+	return Stage ? *Stage : EPlayerLoadStage::None;
+}
+
+void UMatchStartBarrier::SetStage(int32 PlayerIndex, EPlayerLoadStage NewStage)
+{
+	PlayerStages[PlayerIndex] = NewStage;
+	OnPlayerLoadStageChanged.Broadcast(PlayerIndex, NewStage);
+}
+
+void UMatchStartBarrier::HandlePlayerTimeout(int32 PlayerIndex)
+{
+	TimeoutHandles.Remove(PlayerIndex);
+
+	const EPlayerLoadStage* Stage = PlayerStages.Find(PlayerIndex);
+	if (!Stage || *Stage == EPlayerLoadStage::Ready || bReleased)
+	{
+		return;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("[%s] Player %d did not finish loading within %.1f seconds (stage: %s)."),
+		ANSI_TO_TCHAR(__FUNCTION__), PlayerIndex, PlayerTimeout, *UEnum::GetValueAsString(*Stage));
+
+	++NumTimedOut;
+	SetStage(PlayerIndex, EPlayerLoadStage::TimedOut);
+
+	TryRelease();
+}
+
+void UMatchStartBarrier::TryRelease()
+{
+	if (bReleased)
+	{
+		return;
+	}
+
+	const int32 RequiredPlayers = ExpectedPlayers > 0 ? ExpectedPlayers : PlayerStages.Num();
+	if (RequiredPlayers <= 0 || NumReady <= 0 || NumReady + NumTimedOut < RequiredPlayers)
+	{
+		return;
+	}
+
+	bReleased = true;
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] Match start barrier released. Ready: %d, Timed out: %d, Expected: %d"),
+		ANSI_TO_TCHAR(__FUNCTION__), NumReady, NumTimedOut, RequiredPlayers);
+
+	// 남은 타이머는 더 이상 필요 없습니다.
+	if (UWorld* World = GetWorld())
+	{
+		for (TPair<int32, FTimerHandle>& Pair : TimeoutHandles)
+		{
+			World->GetTimerManager().ClearTimer(Pair.Value);
+		}
+	}
+	TimeoutHandles.Empty();
+
+	OnReleased.Broadcast();
+}
+
+void UMatchStartBarrier::ClearPlayerTimer(int32 PlayerIndex)
+{
+	FTimerHandle Handle;
+	if (TimeoutHandles.RemoveAndCopyValue(PlayerIndex, Handle))
+	{
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().ClearTimer(Handle);
+		}
+	}
+}
@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Game/MinionWaveSpawner.h"
+#include "Engine/World.h"
+#include "Algo/StableSort.h"
+
+
+UMinionWaveSpawner::UMinionWaveSpawner()
+{
+	FrameBudgetMs = 2.f;
+	NextRequestIndex = 0;
+}
+
+void UMinionWaveSpawner::Initialize(float InFrameBudgetMs)
+{
+	FrameBudgetMs = FMath::Max(InFrameBudgetMs, 0.f);
+	Clear();
+}
+
+void UMinionWaveSpawner::EnqueueWave(int32 Wave, TArray<FMinionSpawnRequest>&& Requests)
+{
+	if (Requests.Num() == 0)
+	{
+		return;
+	}
+
+	// 처리된 요청을 정리한 뒤 새 웨이브를 뒤에 붙입니다.
+	if (NextRequestIndex > 0)
+	{
+		PendingRequests.RemoveAt(0, NextRequestIndex, EAllowShrinking::No);
+		NextRequestIndex = 0;
+	}
+
+	// 이전 웨이브가 아직 남아 있다면 ReadyTime 순서가 유지되도록 정렬합니다.
+	const bool bNeedsSort = PendingRequests.Num() > 0 && PendingRequests.Last().ReadyTime > Requests[0].ReadyTime;
+
+	FWaveSpawnStats& Stats = WaveStats.FindOrAdd(Wave);
+	Stats.NumRequested += Requests.Num();
+
+	PendingRequests.Append(MoveTemp(Requests));
+
+	if (bNeedsSort)
+	{
+		Algo::StableSortBy(PendingRequests, &FMinionSpawnRequest::ReadyTime);
+	}
+}
+
+void UMinionWaveSpawner::Clear()
+{
+	PendingRequests.Empty();
+	NextRequestIndex = 0;
+	WaveStats.Empty();
+}
+
+bool UMinionWaveSpawner::IsTickable() const
+{
+	return HasAnyFlags(RF_ClassDefaultObject) == false && GetNumPendingRequests() > 0;
+}
+
+TStatId UMinionWaveSpawner::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMinionWaveSpawner, STATGROUP_Tickables);
+}
+
+void UMinionWaveSpawner::Tick(float DeltaTime)
+{
+	UWorld* World = GetWorld();
+	if (!World || OnExecuteSpawn.IsBound() == false)
+	{
+		return;
+	}
+
+	const double WorldTime = World->GetTimeSeconds();
+	const double FrameStartTime = FPlatformTime::Seconds();
+	int32 NumProcessed = 0;
+
+	while (NextRequestIndex < PendingRequests.Num())
+	{
+		const FMinionSpawnRequest& Request = PendingRequests[NextRequestIndex];
+		if (Request.ReadyTime > WorldTime)
+		{
+			break;
+		}
+
+		// 한 건은 항상 처리하고, 그 이후로는 예산을 넘으면 다음 프레임으로 넘깁니다.
+		const double ElapsedMs = (FPlatformTime::Seconds() - FrameStartTime) * 1000.0;
+		if (NumProcessed > 0 && ElapsedMs >= FrameBudgetMs)
+		{
+			break;
+		}
+
+		const FMinionSpawnRequest RequestCopy = Request;
+		++NextRequestIndex;
+		++NumProcessed;
+
+		const double SpawnStartTime = FPlatformTime::Seconds();
+		OnExecuteSpawn.Execute(RequestCopy);
+		const double SpawnMs = (FPlatformTime::Seconds() - SpawnStartTime) * 1000.0;
+
+		RecordSpawn(RequestCopy.Wave, SpawnMs, WorldTime - RequestCopy.ReadyTime);
+	}
+
+	if (NextRequestIndex >= PendingRequests.Num())
+	{
+		PendingRequests.Reset();
+		NextRequestIndex = 0;
+	}
+}
+
+void UMinionWaveSpawner::RecordSpawn(int32 Wave, double CostMs, double Delay)
+{
+	FWaveSpawnStats* Stats = WaveStats.Find(Wave);
+	if (!Stats)
+	{
+		return;
+	}
+
+	if (Stats->LastFrameNumber != GFrameCounter)
+	{
+		Stats->LastFrameNumber = GFrameCounter;
+		Stats->CurrentFrameMs = 0.0;
+		++Stats->NumFrames;
+	}
+
+	++Stats->NumSpawned;
+	Stats->TotalMs += CostMs;
+	Stats->CurrentFrameMs += CostMs;
+	Stats->WorstFrameMs = FMath::Max(Stats->WorstFrameMs, Stats->CurrentFrameMs);
+	Stats->MaxDelay = FMath::Max(Stats->MaxDelay, Delay);
+
+	if (Stats->NumSpawned >= Stats->NumRequested)
+	{
+		ReportWave(Wave, *Stats);
+		WaveStats.Remove(Wave);
+	}
+}
+
+void UMinionWaveSpawner::ReportWave(int32 Wave, const FWaveSpawnStats& Stats) const
+{
+	UE_LOG(LogTemp, Log, TEXT("[%s] Wave %d: %d minions over %d frames, total %.2f ms, worst frame %.2f ms (budget %.2f ms), max delay %.3f s"),
+		ANSI_TO_TCHAR(__FUNCTION__), Wave, Stats.NumSpawned, Stats.NumFrames, Stats.TotalMs, Stats.WorstFrameMs, FrameBudgetMs, Stats.MaxDelay);
+
+	if (Stats.WorstFrameMs > FrameBudgetMs * 2.f)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Wave %d: one frame ran well over the spawn budget (%.2f ms > %.2f ms)."),
+			ANSI_TO_TCHAR(__FUNCTION__), Wave, Stats.WorstFrameMs, FrameBudgetMs);
+	}
+}
@@ -2,6 +2,8 @@
 
 
 #include "Item/GuardianAngel.h"
+#include "Item/ItemRegistry.h"
+#include "Item/ItemInstance.h"
 #include "Game/ArenaPlayerState.h"
 #include "Characters/AOSCharacterBase.h"
 #include "Components/StatComponent.h"
@@ -16,47 +18,32 @@ AGuardianAngel::AGuardianAngel()
 {
 	ParticleSystem = CreateDefaultSubobject<UParticleSystemComponent>(TEXT("ParticleSystem"));
 
-	CooldownTime = 0.f;
+	CooldownTime = 280.f;
+	ReviveDuration = 2.f;
 }
 
-void AGuardianAngel::Initialize()
+void AGuardianAngel::OnPreDeath(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, bool& bDeath) const
 {
-    Super::Initialize();
-
-	CooldownTime = UniqueAttributes.Contains("CooldownTime") ? UniqueAttributes["CooldownTime"] : 280.f;
-
-    UE_LOG(LogTemp, Log, TEXT("[%s] Initialized - CooldownTime: %.2f"), *GetName(), CooldownTime);
-}
-
-void AGuardianAngel::Use(AArenaPlayerState* PlayerState)
-{
-	Super::Use(PlayerState);
-
-}
-
-void AGuardianAngel::BindToPlayer(AAOSCharacterBase* Character)
-{
-	Super::BindToPlayer(Character);
-
-	if (::IsValid(Character) == false)
-	{
-		return;
-	}
-
-	Character->OnPreDeathEvent.AddDynamic(this, &ThisClass::ReviveCharacter);
-}
+    if (bDeath == false || ::IsValid(PlayerState) == false)
+    {
+        return;
+    }
 
-void AGuardianAngel::ReviveCharacter(bool& bDeath)
-{
-    if (!OwnerCharacter.IsValid() || !::IsValid(OwnerCharacter->GetPlayerState<AArenaPlayerState>()))
+    AAOSCharacterBase* OwnerCharacter = PlayerState->GetPawn<AAOSCharacterBase>();
+    if (::IsValid(OwnerCharacter) == false)
     {
         return;
     }
 
-    AArenaPlayerState* PlayerState = OwnerCharacter->GetPlayerState<AArenaPlayerState>();
+    // 재사용 대기 중이면 부활하지 않습니다.
+    const int32 ItemCode = Definition.Row.ItemCode;
+    FItemEffectState& Effect = PlayerState->FindOrAddItemEffect(ItemCode);
+    if (Effect.ActivationState == EItemActivationState::Active)
+    {
+        return;
+    }
 
     // 부활 처리
-    OwnerCharacter->OnPreDeathEvent.RemoveDynamic(this, &ThisClass::ReviveCharacter);
     bDeath = false;
 
     UCapsuleComponent* CapsuleComponent = OwnerCharacter->GetCapsuleComponent();
@@ -70,7 +57,13 @@ void AGuardianAngel::ReviveCharacter(bool& bDeath)
     OwnerCharacter->SetActorHiddenInGame(true);
     OwnerCharacter->GetCharacterMovement()->SetMovementMode(EMovementMode::MOVE_None);
 
-    SpawnReviveEffect();
+    FTransform SpawnTransform = Transform;
+    SpawnTransform.SetRotation(FRotator(1).Quaternion());
+    SpawnTransform.SetLocation(OwnerCharacter->GetActorLocation() - FVector(0, 0, 95.f));
+
+    SpawnReviveEffect(OwnerCharacter, SpawnTransform);
+
+    const float Cooldown = Definition.GetAttribute(TEXT("CooldownTime"), CooldownTime);
 
     uint32 UniqueCode = UUniqueCodeGenerator::GenerateUniqueCode(
         OwnerCharacter->ObjectType,
@@ -80,25 +73,39 @@ void AGuardianAngel::ReviveCharacter(bool& bDeath)
         static_cast<uint8>(ItemCode)
     );
 
-
-    auto Callback = [this, UniqueCode, WeakPlayerState = TWeakObjectPtr<AArenaPlayerState>(PlayerState)]()
+    auto Callback = [ItemCode, WeakPlayerState = TWeakObjectPtr<AArenaPlayerState>(PlayerState)]()
         {
-            if (OwnerCharacter.IsValid())
+            if (FItemEffectState* State = WeakPlayerState.IsValid() ? WeakPlayerState->FindItemEffect(ItemCode) : nullptr)
             {
-                OwnerCharacter->OnPreDeathEvent.AddDynamic(this, &ThisClass::ReviveCharacter);
+                State->ActivationState = EItemActivationState::Expired;
             }
+        };
+
+    Effect.ActivationState = EItemActivationState::Active;
+    PlayerState->SetTimer(UniqueCode, Callback, Cooldown, false, Cooldown, true);
+    PlayerState->SetItemCooldownEnd(ItemCode, PlayerState->GetServerTime() + Cooldown);
 
-            ActivationState = EItemActivationState::Expired;
+    // 부활 이펙트가 끝나면 리스폰합니다.
+    uint32 ReviveCode = UUniqueCodeGenerator::GenerateUniqueCode(
+        OwnerCharacter->ObjectType,
+        static_cast<uint8>(PlayerState->GetPlayerIndex()),
+        ETimerCategory::Item,
+        static_cast<uint8>(ETimerType::None),
+        static_cast<uint8>(ItemCode)
+    );
+
+    auto ReviveCallback = [this, WeakCharacter = TWeakObjectPtr<AAOSCharacterBase>(OwnerCharacter), SpawnTransform]()
+        {
+            FinishRevive(WeakCharacter.Get(), SpawnTransform);
         };
 
- 
-    ActivationState = EItemActivationState::Active;
-    PlayerState->SetTimer(UniqueCode, Callback, CooldownTime, false, CooldownTime, true);
+    const float Duration = FMath::Max(Definition.GetAttribute(TEXT("ReviveDuration"), ReviveDuration), KINDA_SMALL_NUMBER);
+    PlayerState->SetTimer(ReviveCode, ReviveCallback, Duration, false, Duration);
 }
 
 
 
-void AGuardianAngel::SpawnReviveEffect()
+void AGuardianAngel::SpawnReviveEffect(AAOSCharacterBase* Character, const FTransform& SpawnTransform) const
 {
     if (!::IsValid(ReviveParticle) || !ReviveParticle->IsValidLowLevelFast())
     {
@@ -106,78 +113,44 @@ void AGuardianAngel::SpawnReviveEffect()
         return;
     }
 
-    if (!OwnerCharacter.IsValid())
+    if (!::IsValid(Character))
     {
         UE_LOG(LogTemp, Warning, TEXT("[%s] SpawnReviveEffect failed: OwnerCharacter is invalid!"), *GetName());
         return;
     }
 
-    UWorld* World = GetWorld();
-    if (!World)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("[%s] SpawnReviveEffect failed: GetWorld() returned nullptr!"), *GetName());
-        return;
-    }
-
-
-    FVector SpawnLocation = OwnerCharacter->GetActorLocation() - FVector(0, 0, 95.f);
-    Transform.SetRotation(FRotator(1).Quaternion());
-    Transform.SetLocation(SpawnLocation);
-
-    UParticleSystemComponent* PSC = OwnerCharacter->SpawnEmitterAtLocation(ReviveParticle, Transform);
-    if (!PSC)
-    {
-        UE_LOG(LogTemp, Warning, TEXT("[%s] Failed to spawn ReviveParticle!"), *GetName());
-        return;
-    }
-
-    PSC->OnSystemFinished.AddDynamic(this, &AGuardianAngel::OnParticleSystemFinished);
-    PSC->Activate();
+    // 데디케이티드 서버에서는 반환되는 컴포넌트가 없으므로 결과를 확인하지 않습니다.
+    Character->SpawnEmitterAtLocation(ReviveParticle, SpawnTransform);
 }
 
 
 
 
-void AGuardianAngel::OnParticleSystemFinished(UParticleSystemComponent* PSystem)
+void AGuardianAngel::FinishRevive(AAOSCharacterBase* Character, const FTransform& SpawnTransform) const
 {
-    if (!PSystem)
+    if (!::IsValid(Character))
     {
-        UE_LOG(LogTemp, Error, TEXT("OnParticleSystemFinished: ParticleSystemComponent is null!"));
+        UE_LOG(LogTemp, Error, TEXT("FinishRevive: OwnerCharacter is not valid!"));
         return;
     }
 
-    if (PSystem->Template == ReviveParticle)
+    // ReviveEndedParticle이 설정된 경우에만 종료 이펙트 재생
+    if (ReviveEndedParticle)
     {
-        PSystem->OnSystemFinished.RemoveDynamic(this, &AGuardianAngel::OnParticleSystemFinished);
+        Character->SpawnEmitterAtLocation(ReviveEndedParticle, SpawnTransform);
     }
-
-    // ReviveEndedParticle이 설정되지 않은 경우
-    if (!ReviveEndedParticle)
+    else
     {
-        UE_LOG(LogTemp, Error, TEXT("OnParticleSystemFinished: ReviveEndedParticle is not set!"));
-        return;
+        UE_LOG(LogTemp, Error, TEXT("FinishRevive: ReviveEndedParticle is not set!"));
     }
 
-    // ReviveEndedParticle로 변경
-    OwnerCharacter->SpawnEmitterAtLocation(ReviveEndedParticle, Transform);
-    OwnerCharacter->ServerModifyCharacterState(ECharacterStateOperation::Remove, ECharacterState::Invulnerability);
+    Character->ServerModifyCharacterState(ECharacterStateOperation::Remove, ECharacterState::Invulnerability);
 
-    UCapsuleComponent* CapsuleComponent = OwnerCharacter->GetCapsuleComponent();
+    UCapsuleComponent* CapsuleComponent = Character->GetCapsuleComponent();
     if (CapsuleComponent)
     {
         CapsuleComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     }
 
-    // OwnerCharacter가 유효한 경우 리스폰
-    if (OwnerCharacter.IsValid())
-    {
-        OwnerCharacter->Respawn(0.5f);
-    }
-    else
-    {
-        UE_LOG(LogTemp, Error, TEXT("OnParticleSystemFinished: OwnerCharacter is not valid!"));
-    }
+    Character->Respawn(0.5f);
 }
-
-
-
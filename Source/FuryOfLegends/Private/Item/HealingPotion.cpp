@@ -1,38 +1,15 @@
 #include "Item/HealingPotion.h"
+#include "Item/ItemRegistry.h"
+#include "Item/ItemInstance.h"
 #include "Game/ArenaPlayerState.h"
 #include "Characters/AOSCharacterBase.h"
-#include "Components/StatComponent.h"
+#include "Components/PeriodicEffectComponent.h"
 #include "Plugins/UniqueCodeGenerator.h"
 
-AHealingPotion::AHealingPotion()
-{
-	HealingAmount = 150.f;
-	HealingDuration = 15.f;
-	AccumulatedHealing = 0.f;
-
-	ElapsedTime = 0.f;
-	TotalElapsedTime = 0.f;
-	RemainingTime = 0.f;
-}
-
-
-void AHealingPotion::Initialize()
-{
-	Super::Initialize();
 
-	HealingAmount = UniqueAttributes.Contains("HealingAmount") ? UniqueAttributes["HealingAmount"] : 0.f;
-	HealingDuration = UniqueAttributes.Contains("HealingDuration") ? UniqueAttributes["HealingDuration"] : 0.f;
-	RemainingTime = HealingDuration;
-
-	UE_LOG(LogTemp, Log, TEXT("[%s] Initialized - HealingAmount: %.2f, HealingDuration: %.2f, RemainingTime: %.2f"),
-		*GetName(), HealingAmount, HealingDuration, RemainingTime);
-}
-
-
-
-void AHealingPotion::Use(AArenaPlayerState* PlayerState)
+void AHealingPotion::Use(const FItemDefinition& Definition, FItemInstance& Instance, AArenaPlayerState* PlayerState) const
 {
-	Super::Use(PlayerState);
+	Super::Use(Definition, Instance, PlayerState);
 
 	if (::IsValid(PlayerState) == false)
 	{
@@ -50,16 +27,15 @@ void AHealingPotion::Use(AArenaPlayerState* PlayerState)
 		return;
 	}
 
-	UStatComponent* PlayerStatComponent = PlayerCharacter->GetStatComponent();
-	if (::IsValid(PlayerStatComponent) == false)
+	UPeriodicEffectComponent* EffectComponent = PlayerCharacter->GetPeriodicEffectComponent();
+	if (::IsValid(EffectComponent) == false)
 	{
 		return;
 	}
 
-	if (ConcurrentUses >= MaxConcurrentUses)
-	{
-		return;
-	}
+	const int32 ItemCode = Definition.Row.ItemCode;
+	const float HealingAmount = Definition.GetAttribute(TEXT("HealingAmount"), 0.f);
+	const float HealingDuration = Definition.GetAttribute(TEXT("HealingDuration"), 0.f);
 
 	EObjectType ObjectType = PlayerCharacter->ObjectType;
 	int32 PlayerIndex = PlayerState->GetPlayerIndex();
@@ -67,65 +43,22 @@ void AHealingPotion::Use(AArenaPlayerState* PlayerState)
 	uint8 TimerType = static_cast<uint8>(ETimerType::BuffList);
 	uint8 ItemType = static_cast<uint8>(ItemCode);
 
-	uint32 UniqueCode = UUniqueCodeGenerator::GenerateUniqueCode(ObjectType, PlayerIndex, TimerCategory, TimerType, ItemType);
-
 	//   ȸ ü 
 	const float TickInterval = 0.5f;
-	const int RepeatCount = FMath::CeilToInt(HealingDuration / TickInterval);
-	const float IncrementAmount = HealingAmount / RepeatCount;
-
-	// ȸ Ÿ̸ ݹ: ü  ð  ȸ
-	auto HealthRegenCallback = [this, WeakStatComponent = TWeakObjectPtr<UStatComponent>(PlayerStatComponent), WeakPlayerState = TWeakObjectPtr<AArenaPlayerState>(PlayerState), TickInterval, IncrementAmount, UniqueCode]()
-		{
-			if (!WeakStatComponent.IsValid() || !WeakPlayerState.IsValid())
-			{
-				return;
-			}
-
-			ElapsedTime += 0.1f;
-			TotalElapsedTime += 0.1f;
-			RemainingTime = FMath::Max(0.f, HealingDuration - TotalElapsedTime);
-			WeakPlayerState->ClientNotifyRemainingTime(UniqueCode, RemainingTime, TotalElapsedTime);
-
-			if (ElapsedTime >= TickInterval)
-			{
-				ElapsedTime = 0.f;
-				WeakStatComponent->ModifyCurrentHP(IncrementAmount);
-				AccumulatedHealing += IncrementAmount;
-			}
-	
-			// ȸ Ϸ ó
-			if (TotalElapsedTime >= HealingDuration)
-			{
-				--ConcurrentUses;
-				WeakPlayerState->ClientNotifyTimerUpdated(UniqueCode, ConcurrentUses);
-
-				if (ConcurrentUses <= 0)
-				{
-					WeakPlayerState->ClearTimer(UniqueCode);
-					WeakPlayerState->ClientNotifyRemainingTime(UniqueCode, 0, 0);
-					ActivationState = EItemActivationState::Expired;
-				}
-				else
-				{
-					ElapsedTime = 0.f;
-					TotalElapsedTime = 0.f;
-					AccumulatedHealing = 0.f;
-				}
-			}
-		};
-
-	ConcurrentUses++;
-	CurrentStackPerSlot--;
-
-	//  Ÿ̸Ӱ  ο Ÿ̸ 
-	if (!PlayerState->IsTimerActive(UniqueCode))
-	{
-		ActivationState = EItemActivationState::Active;
-		PlayerState->SetTimer(UniqueCode, HealthRegenCallback, 0.1f, true, 0.1f);
-	}
-	else
+	const int RepeatCount = FMath::Max(FMath::CeilToInt(HealingDuration / TickInterval), 1);
+
+	//    ø  ȸ   ̾ ˴ϴ.
+	FPeriodicEffectSpec Spec;
+	Spec.SourceCode = UUniqueCodeGenerator::GenerateUniqueCode(ObjectType, PlayerIndex, TimerCategory, TimerType, ItemType);
+	Spec.Type = EPeriodicEffectType::Heal;
+	Spec.Stacking = EPeriodicEffectStacking::Queue;
+	Spec.AmountPerTick = HealingAmount / RepeatCount;
+	Spec.TickInterval = TickInterval;
+	Spec.Duration = HealingDuration;
+	Spec.MaxStacks = Definition.Row.MaxConcurrentUses;
+
+	if (EffectComponent->AddEffect(Spec))
 	{
-		PlayerState->ClientNotifyTimerUpdated(UniqueCode, ConcurrentUses);
+		Instance.Stack--;
 	}
 }
@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Item/InventoryList.h"
+#include "Item/ItemInstance.h"
+#include "Game/ArenaPlayerState.h"
+
+
+void FInventoryEntry::PreReplicatedRemove(const FInventoryList& InArraySerializer)
+{
+	if (::IsValid(InArraySerializer.OwnerPlayerState))
+	{
+		InArraySerializer.OwnerPlayerState->HandleInventorySlotReplicated(SlotIndex, -1, 0);
+	}
+}
+
+void FInventoryEntry::PostReplicatedAdd(const FInventoryList& InArraySerializer)
+{
+	if (::IsValid(InArraySerializer.OwnerPlayerState))
+	{
+		InArraySerializer.OwnerPlayerState->HandleInventorySlotReplicated(SlotIndex, ItemCode, Stack);
+	}
+}
+
+void FInventoryEntry::PostReplicatedChange(const FInventoryList& InArraySerializer)
+{
+	if (::IsValid(InArraySerializer.OwnerPlayerState))
+	{
+		InArraySerializer.OwnerPlayerState->HandleInventorySlotReplicated(SlotIndex, ItemCode, Stack);
+	}
+}
+
+
+void FInventoryList::SetSlot(int32 SlotIndex, const FItemInstance& Instance, float CooldownEndTime)
+{
+	const bool bOccupied = Instance.IsEmpty() == false;
+
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		FInventoryEntry& Entry = Entries[Index];
+		if (Entry.SlotIndex != SlotIndex)
+		{
+			continue;
+		}
+
+		if (bOccupied == false)
+		{
+			Entries.RemoveAtSwap(Index);
+			MarkArrayDirty();
+			return;
+		}
+
+		if (Entry.InstanceId == Instance.InstanceId && Entry.ItemCode == Instance.ItemCode && Entry.Stack == Instance.Stack && Entry.CooldownEndTime == CooldownEndTime)
+		{
+			return;
+		}
+
+		Entry.InstanceId = Instance.InstanceId;
+		Entry.ItemCode = Instance.ItemCode;
+		Entry.Stack = Instance.Stack;
+		Entry.CooldownEndTime = CooldownEndTime;
+		MarkItemDirty(Entry);
+		return;
+	}
+
+	if (bOccupied == false)
+	{
+		return;
+	}
+
+	FInventoryEntry& NewEntry = Entries.AddDefaulted_GetRef();
+	NewEntry.SlotIndex = SlotIndex;
+	NewEntry.ItemCode = Instance.ItemCode;
+	NewEntry.Stack = Instance.Stack;
+	NewEntry.InstanceId = Instance.InstanceId;
+	NewEntry.CooldownEndTime = CooldownEndTime;
+	MarkItemDirty(NewEntry);
+}
+
+void FInventoryList::SetCooldownEnd(int32 SlotIndex, float EndTime)
+{
+	FInventoryEntry* Entry = FindSlotMutable(SlotIndex);
+	if (Entry && Entry->CooldownEndTime != EndTime)
+	{
+		Entry->CooldownEndTime = EndTime;
+		MarkItemDirty(*Entry);
+	}
+}
+
+const FInventoryEntry* FInventoryList::FindSlot(int32 SlotIndex) const
+{
+	return Entries.FindByPredicate([SlotIndex](const FInventoryEntry& Entry) { return Entry.SlotIndex == SlotIndex; });
+}
+
+FInventoryEntry* FInventoryList::FindSlotMutable(int32 SlotIndex)
+{
+	return Entries.FindByPredicate([SlotIndex](const FInventoryEntry& Entry) { return Entry.SlotIndex == SlotIndex; });
+}
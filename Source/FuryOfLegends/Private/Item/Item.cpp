@@ -1,4 +1,6 @@
 ﻿#include "Item/Item.h"
+#include "Item/ItemRegistry.h"
+#include "Item/ItemInstance.h"
 #include "Game/ArenaPlayerState.h"
 #include "Characters/AOSCharacterBase.h"
 #include "Components/StatComponent.h"
@@ -21,23 +23,8 @@ AItem::AItem()
     FunctionMap.Add(ECharacterStat::MovementSpeed, &AItem::ModifyMovementSpeed);
 }
 
-void AItem::Initialize()
-{
-
-}
-
-void AItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
-{
-    Super::EndPlay(EndPlayReason);
-
-    RemoveAbilitiesFromCharacter();
 
-    FunctionMap.Empty();
-    StatModifiers.Empty();
-}
-
-
-void AItem::Use(AArenaPlayerState* PlayerState)
+void AItem::Use(const FItemDefinition& Definition, FItemInstance& Instance, AArenaPlayerState* PlayerState) const
 {
     if (::IsValid(PlayerState) == false)
     {
@@ -45,139 +32,103 @@ void AItem::Use(AArenaPlayerState* PlayerState)
     }
 }
 
-void AItem::BindToPlayer(AAOSCharacterBase* Character)
-{
-    if (::IsValid(Character))
-    {
-        OwnerCharacter = Character;
-
-        if (Character->OnHitEventTriggered.IsAlreadyBound(this, &AItem::OnHit) == false)
-        {
-            Character->OnHitEventTriggered.AddDynamic(this, &AItem::OnHit);
-        }
-
-        if (Character->OnAttackEventTriggered.IsAlreadyBound(this, &AItem::OnAttack) == false)
-        {
-            Character->OnAttackEventTriggered.AddDynamic(this, &AItem::OnAttack);
-        }
-
-        if (Character->OnAbilityEffectsEventTriggered.IsAlreadyBound(this, &AItem::OnAbilityEffects) == false)
-        {
-            Character->OnAbilityEffectsEventTriggered.AddDynamic(this, &AItem::OnAbilityEffects);
-        }
-
-        if (Character->OnReceiveDamageEnteredEvent.IsAlreadyBound(this, &AItem::OnReceiveDamageEntered) == false)
-        {
-            Character->OnReceiveDamageEnteredEvent.AddDynamic(this, &AItem::OnReceiveDamageEntered);
-        }
-
-        ApplyAbilitiesToCharacter();
-    }
-}
-
 
-
-void AItem::OnHit(FDamageInformation& DamageInformation)
+void AItem::OnHit(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, FDamageInformation& DamageInformation) const
 {
     // Implement functionality for when character is hit
 }
 
-void AItem::OnAttack(FDamageInformation& DamageInformation)
+void AItem::OnAttack(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, FDamageInformation& DamageInformation) const
 {
     // Implement functionality for when character attacks
 }
 
-void AItem::OnAbilityEffects(FDamageInformation& DamageInformation)
+void AItem::OnAbilityEffects(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, FDamageInformation& DamageInformation) const
 {
     // Implement functionality for ability effects
 }
 
-void AItem::OnReceiveDamageEntered(bool& bResult)
+void AItem::OnReceiveDamageEntered(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, bool& bResult) const
 {
     // Implement functionality for when character receives damage
 }
 
-void AItem::ApplyAbilitiesToCharacter()
+void AItem::OnPreDeath(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, bool& bDeath) const
+{
+    // Implement functionality for when character is about to die
+}
+
+void AItem::ApplyStats(const FItemDefinition& Definition, FItemInstance& Instance, AAOSCharacterBase* Character) const
 {
-    if (!OwnerCharacter.IsValid())
+    if (::IsValid(Character) == false)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Invalid OwnerCharacter in ApplyAbilitiesToCharacter."));
+        UE_LOG(LogTemp, Warning, TEXT("Invalid Character in ApplyStats."));
         return;
     }
 
-    RemoveAbilitiesFromCharacter();
+    RemoveStats(Instance, Character);
 
-    for (const FItemStatModifier& Stat : StatModifiers)
+    for (const FItemStatModifier& Stat : Definition.Row.StatModifiers)
     {
-        // ItemAbility.Key는 ECharacterStat, ItemAbility.Value는 int32
-        if (!FunctionMap.Contains(Stat.Key))
+        // FunctionMap에서 해당 키의 함수를 가져옴
+        const ModifierFunction* Function = FunctionMap.Find(Stat.Key);
+        if (!Function || *Function == nullptr)
         {
             UE_LOG(LogTemp, Warning, TEXT("Ability type %d not found in FunctionMap"), static_cast<int32>(Stat.Key));
             continue;
         }
 
-        // FunctionMap에서 해당 키의 함수를 가져옴
-        ModifierFunction Function = FunctionMap[Stat.Key];
-        if (Function != nullptr)
+        const int32 ModifierValue = static_cast<int32>(Instance.Stack * Stat.Value);
+
+        // 능력치 적용
+        (this->**Function)(Character, ModifierValue);
+
+        // 적용된 수치 기록 (같은 스탯이 여러 번 나오면 누적)
+        TPair<ECharacterStat, int32>* Applied = Instance.AppliedStats.FindByPredicate([&Stat](const TPair<ECharacterStat, int32>& Pair) { return Pair.Key == Stat.Key; });
+        if (Applied)
+        {
+            Applied->Value += ModifierValue;
+        }
+        else
         {
-            int32 ModifierValue = CurrentStackPerSlot * Stat.Value;
-
-            // 능력치 적용
-            (this->*Function)(OwnerCharacter.Get(), ModifierValue);
-
-            // 적용된 수치 기록 (기존 값이 있으면 누적)
-            if (ModifiedStats.Contains(Stat.Key))
-            {
-                ModifiedStats[Stat.Key] += ModifierValue;
-            }
-            else
-            {
-                ModifiedStats.Add(Stat.Key, ModifierValue);
-            }
+            Instance.AppliedStats.Emplace(Stat.Key, ModifierValue);
         }
     }
 }
 
 
-void AItem::RemoveAbilitiesFromCharacter()
+void AItem::RemoveStats(FItemInstance& Instance, AAOSCharacterBase* Character) const
 {
-    if (!OwnerCharacter.IsValid())
+    if (Instance.AppliedStats.Num() == 0)
     {
-        UE_LOG(LogTemp, Warning, TEXT("Invalid OwnerCharacter in RemoveAbilitiesFromCharacter."));
         return;
     }
 
-    for (const FItemStatModifier& Stat : StatModifiers)
+    if (::IsValid(Character) == false)
     {
-        if (!FunctionMap.Contains(Stat.Key))
-        {
-            UE_LOG(LogTemp, Warning, TEXT("CharacterStat %s not found in FunctionMap"), *StaticEnum<ECharacterStat>()->GetNameStringByValue(static_cast<int64>(Stat.Key)));
-            continue;
-        }
+        UE_LOG(LogTemp, Warning, TEXT("Invalid Character in RemoveStats."));
+        Instance.AppliedStats.Reset();
+        return;
+    }
 
-        // StatModifiers에서 능력치 확인
-        if (!ModifiedStats.Contains(Stat.Key))
+    for (const TPair<ECharacterStat, int32>& Applied : Instance.AppliedStats)
+    {
+        const ModifierFunction* Function = FunctionMap.Find(Applied.Key);
+        if (!Function || *Function == nullptr)
         {
-            UE_LOG(LogTemp, Warning, TEXT("No modifier found for CharacterStat %d in ModifiedStats."), *StaticEnum<ECharacterStat>()->GetNameStringByValue(static_cast<int64>(Stat.Key)));
+            UE_LOG(LogTemp, Warning, TEXT("CharacterStat %s not found in FunctionMap"), *StaticEnum<ECharacterStat>()->GetNameStringByValue(static_cast<int64>(Applied.Key)));
             continue;
         }
 
-        ModifierFunction Function = FunctionMap[Stat.Key];
-        if (Function != nullptr)
-        {
-            int32 ModifierValue = ModifiedStats[Stat.Key];
-
-            (this->*Function)(OwnerCharacter.Get(), -ModifierValue);
-            ModifiedStats.Remove(Stat.Key);
-
-            UE_LOG(LogTemp, Log, TEXT("CharacterStat %s removed from ModifiedStats."), *StaticEnum<ECharacterStat>()->GetNameStringByValue(static_cast<int64>(Stat.Key)));
-        }
+        (this->**Function)(Character, -Applied.Value);
     }
+
+    Instance.AppliedStats.Reset();
 }
 
 
 template <typename T>
-void AItem::ModifyStat(AAOSCharacterBase* Character, T(UStatComponent::* Getter)() const, void (UStatComponent::* Setter)(T), int32 Value)
+void AItem::ModifyStat(AAOSCharacterBase* Character, T(UStatComponent::* Getter)() const, void (UStatComponent::* Setter)(T), int32 Value) const
 {
     if (!::IsValid(Character))
     {
@@ -194,64 +145,64 @@ void AItem::ModifyStat(AAOSCharacterBase* Character, T(UStatComponent::* Getter)
     (PlayerStatComponent->*Setter)(Value);
 }
 
-void AItem::ModifyMaxHealthPoints(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyMaxHealthPoints(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetMaxHP, &UStatComponent::ModifyAccumulatedFlatMaxHP, Value);
     ModifyStat(Character, &UStatComponent::GetCurrentHP, &UStatComponent::ModifyCurrentHP, Value);
 }
 
-void AItem::ModifyMaxManaPoints(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyMaxManaPoints(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetMaxMP, &UStatComponent::ModifyAccumulatedFlatMaxMP, Value);
     ModifyStat(Character, &UStatComponent::GetCurrentMP, &UStatComponent::ModifyCurrentMP, Value);
 }
 
-void AItem::ModifyHealthRegeneration(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyHealthRegeneration(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetHealthRegeneration, &UStatComponent::ModifyAccumulatedFlatHealthRegeneration, Value);
 }
 
-void AItem::ModifyManaRegeneration(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyManaRegeneration(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetManaRegeneration, &UStatComponent::ModifyAccumulatedFlatManaRegeneration, Value);
 }
 
-void AItem::ModifyAttackDamage(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyAttackDamage(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetAttackDamage, &UStatComponent::ModifyAccumulatedFlatAttackDamage, Value);
 }
 
-void AItem::ModifyAbilityPower(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyAbilityPower(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetAbilityPower, &UStatComponent::ModifyAccumulatedFlatAbilityPower, Value);
 }
 
-void AItem::ModifyDefensePower(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyDefensePower(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetDefensePower, &UStatComponent::ModifyAccumulatedFlatDefensePower, Value);
 }
 
-void AItem::ModifyMagicResistance(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyMagicResistance(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetMagicResistance, &UStatComponent::ModifyAccumulatedFlatMagicResistance, Value);
 }
 
-void AItem::ModifyAttackSpeed(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyAttackSpeed(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetAttackSpeed, &UStatComponent::ModifyAccumulatedPercentAttackSpeed, Value);
 }
 
-void AItem::ModifyAbilityHaste(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyAbilityHaste(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetAbilityHaste, &UStatComponent::ModifyAccumulatedFlatAbilityHaste, Value);
 }
 
-void AItem::ModifyCriticalChance(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyCriticalChance(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetCriticalChance, &UStatComponent::ModifyAccumulatedFlatCriticalChance, Value);
 }
 
-void AItem::ModifyMovementSpeed(AAOSCharacterBase* Character, int32 Value)
+void AItem::ModifyMovementSpeed(AAOSCharacterBase* Character, int32 Value) const
 {
     ModifyStat(Character, &UStatComponent::GetMovementSpeed, &UStatComponent::ModifyAccumulatedPercentMovementSpeed, Value);
 }
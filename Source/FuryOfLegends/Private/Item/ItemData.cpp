@@ -3,7 +3,7 @@
 
 #include "Item/ItemData.h"
 #include "Components/StatComponent.h"
-#include "Plugins/ExpressionEvaluator.h"
+#include "Item/ItemDescriptionTemplate.h"
 
 
 
@@ -22,25 +22,6 @@ FItemTableRow::FItemTableRow()
 	, UniqueAttributes(TMap<FName, int32>())
 	, ItemClass(nullptr)
 {
-	StatGetters = {
-		{ ECharacterStat::MaxHealthPoints, [](const UStatComponent& StatComponent) { return StatComponent.GetMaxHP(); } },
-		{ ECharacterStat::CurrentHealth, [](const UStatComponent& StatComponent) { return StatComponent.GetCurrentHP(); }},
-		{ ECharacterStat::MaxManaPoints, [](const UStatComponent& StatComponent) { return StatComponent.GetMaxMP(); }},
-		{ ECharacterStat::CurrentMana, [](const UStatComponent& StatComponent) { return StatComponent.GetCurrentMP(); }},
-		{ ECharacterStat::HealthRegeneration, [](const UStatComponent& StatComponent) { return StatComponent.GetHealthRegeneration(); }},
-		{ ECharacterStat::ManaRegeneration, [](const UStatComponent& StatComponent) { return StatComponent.GetManaRegeneration(); }},
-		{ ECharacterStat::AttackDamage, [](const UStatComponent& StatComponent) { return StatComponent.GetAttackDamage(); }},
-		{ ECharacterStat::AbilityPower, [](const UStatComponent& StatComponent) { return StatComponent.GetAbilityPower(); }},
-		{ ECharacterStat::DefensePower, [](const UStatComponent& StatComponent) { return StatComponent.GetDefensePower(); }},
-		{ ECharacterStat::MagicResistance, [](const UStatComponent& StatComponent) { return StatComponent.GetMagicResistance(); }},
-		{ ECharacterStat::AttackSpeed, [](const UStatComponent& StatComponent) { return StatComponent.GetAttackSpeed(); }},
-		{ ECharacterStat::MovementSpeed, [](const UStatComponent& StatComponent) { return StatComponent.GetMovementSpeed(); }},
-	};
-
-	StatGettersInt = {
-		{ ECharacterStat::AbilityHaste, [](const UStatComponent& StatComponent) { return StatComponent.GetAbilityHaste(); }},
-		{ ECharacterStat::CriticalChance, [](const UStatComponent& StatComponent) { return StatComponent.GetCriticalChance(); }},
-	};
 }
 
 
@@ -92,232 +73,11 @@ FString FItemTableRow::ConvertCharacterStatToString(ECharacterStat StatToConvert
 
 FString FItemTableRow::ConvertToRichText(UStatComponent* StatComponent) const
 {
-	FString Result = Description;
-
 	if (!StatComponent)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("[ConvertToRichText] Invalid StatComponent."));
-		return Result;
-	}
-
-	//  ± ȯ
-	Result = ReplaceCharacterStatTags(Result, StatComponent);
-	Result = ReplaceItemStatTags(Result);
-	Result = ReplaceItemAttributeTags(Result);
-
-	//  ± ȯ
-	Result = ReplaceCalcTags(Result, StatComponent);
-
-	// ٹٲ ± ȯ
-	Result = ReplaceLineBreakTags(Result);
-
-	return Result;
-}
-
-
-
-
-FString FItemTableRow::ReplaceLineBreakTags(const FString& Text) const
-{
-	return Text.Replace(TEXT("<br>"), TEXT("\n"));
-}
-
-
-
-
-/**
- * ----------------     ----------------
- * ApplyColorTags Լ ־ ؽƮ  ڸ ã
- * HTML ±  üմϴ.
- *
- * @param Text: Է ؽƮԴϴ.
- * @return  ±װ  ؽƮԴϴ.
-
-FString FItemTableRow::ApplyColorTags(const FString& Text) const
-{
-	FString Result = Text;
-	Result = Result.Replace(TEXT("{color=red}"), TEXT("<red>"));
-	Result = Result.Replace(TEXT("{color=green}"), TEXT("<green>"));
-	Result = Result.Replace(TEXT("{color=blue}"), TEXT("<blue>"));
-	Result = Result.Replace(TEXT("{/color}"), TEXT("</>"));
-	return Result;
-}
- */
-
-
-FString FItemTableRow::ReplaceItemAttributeTags(const FString& Text) const
-{
-	FString Result = Text;
-
-	for (const auto& Pair : UniqueAttributes)
-	{
-		FString Tag = FString::Printf(TEXT("<ItemAttribute=%s>"), *Pair.Key.ToString());
-		UE_LOG(LogTemp, Warning, TEXT("ItemAttribute Tag: %s"), *Tag);
-
-		Result = Result.Replace(*Tag, *FString::FromInt(Pair.Value));
-	}
-
-	return Result;
-}
-
-
-/**
- * ReplaceItemStatTags Լ ־ ؽƮ {ItemStat=...}   ڸ ã
- * ش ڸ StatModifiers  üմϴ.
- *
- * @param Text: Է ؽƮԴϴ.
- * @return ȯ ؽƮԴϴ.
- */
-FString FItemTableRow::ReplaceItemStatTags(const FString& Text) const
-{
-	const UEnum* EnumPtr = StaticEnum<ECharacterStat>();
-	FString Result = Text;
-
-	for (const FItemStatModifier& Modifier : StatModifiers)
-	{
-		if (!EnumPtr || !EnumPtr->IsValidEnumValue(static_cast<int64>(Modifier.Key))) {
-			UE_LOG(LogTemp, Error, TEXT("InitializeActions: EnumPtr is None."));
-			continue;
-		}
-
-		FString Tag = FString::Printf(TEXT("<ItemStat=%s>"), *EnumPtr->GetNameStringByValue(static_cast<int64>(Modifier.Key)));
-		UE_LOG(LogTemp, Warning, TEXT("ItemStat Tag: %s"), *Tag);
-
-		Result = Result.Replace(*Tag, *FString::SanitizeFloat(Modifier.Value));
+		return Description;
 	}
 
-	return Result;
+	return FItemDescriptionTemplate::Parse(*this).Render(*StatComponent);
 }
-	
-
-
-/**
- * ReplaceStatTags Լ ־ ؽƮ {stat=...}   ڸ ã
- * ش ڸ StatComponent  üմϴ.
- *
- * @param Text: Է ؽƮԴϴ.
- * @param StatComponent:   ϴ ƮԴϴ.
- * @return ȯ ؽƮԴϴ.
- *
- * ֿ ۾:
- * 1. StatComponent ȿ Ȯմϴ.
- * 2. StatGetters  ȸϿ   ڸ StatComponent  üմϴ.
- * 3. StatGettersInt  ȸϿ   ڸ StatComponent   üմϴ.
- */
-FString FItemTableRow::ReplaceCharacterStatTags(const FString& Text, UStatComponent* StatComponent) const
-{
-	if (!StatComponent)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[ReplaceCharacterStatTags] Invalid StatComponent."));
-		return Text;
-	}
-
-	FString Result = Text;
-	const UEnum* EnumPtr = StaticEnum<ECharacterStat>();
-
-	// Խ  <CharacterStat=StatName> ã
-	const FRegexPattern StatPattern(TEXT("<CharacterStat=([A-Za-z0-9_]+)>"));
-	FRegexMatcher Matcher(StatPattern, Text);
-
-	// ȯ ±   (  óϱ )
-	TArray<FString> TagsToReplace;
-	TArray<FString> Replacements;
-
-	while (Matcher.FindNext())
-	{
-		FString StatName = Matcher.GetCaptureGroup(1);  // : "MaxHealthPoints"
-
-		ECharacterStat StatEnum = (ECharacterStat)EnumPtr->GetValueByNameString(StatName);
-
-		if (StatEnum == ECharacterStat::None)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[ReplaceCharacterStatTags] Invalid stat name: %s"), *StatName);
-			continue;  // ȯ   ŵ
-		}
-
-		// Ǽ(float)  ȯ
-		if (const TFunction<float(const UStatComponent&)>* StatFunc = StatGetters.Find(StatEnum))
-		{
-			float Value = (*StatFunc)(*StatComponent);
-			TagsToReplace.Add(Matcher.GetCaptureGroup(0)); // <CharacterStat=MaxHealthPoints>
-			Replacements.Add(FString::Printf(TEXT("%.2f"), Value)); // 100.00  
-		}
-		// (int)  ȯ
-		else if (const TFunction<int32(const UStatComponent&)>* StatFuncInt = StatGettersInt.Find(StatEnum))
-		{
-			int32 Value = (*StatFuncInt)(*StatComponent);
-			TagsToReplace.Add(Matcher.GetCaptureGroup(0)); // <CharacterStat=AbilityHaste>
-			Replacements.Add(FString::Printf(TEXT("%d"), Value)); // 10  
-		}
-		else
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[ReplaceCharacterStatTags] Stat not found: %s"), *StatName);
-		}
-	}
-
-	//   ±׸ ġȯϿ Խ 浹 
-	for (int32 i = 0; i < TagsToReplace.Num(); i++)
-	{
-		Result = Result.Replace(*TagsToReplace[i], *Replacements[i]);
-	}
-
-	return Result;
-}
-
-
-
-/**
- * ReplaceCalcTags Լ ־ ؽƮ {calc=...}   ڸ ã 򰡵  üմϴ.
- * - Text: Է ؽƮԴϴ.
- * - StatComponent:   ϴ ƮԴϴ.
- *
- * ֿ ۾:
- * 1.  ڸ ã մϴ.
- * 2. 򰡵   ڸ üմϴ.
- * 3. StatComponent     ʿ ߰մϴ.
- */
-FString FItemTableRow::ReplaceCalcTags(const FString& Text, UStatComponent* StatComponent) const
-{
-	if (!StatComponent)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("[ReplaceCalcTags] Invalid StatComponent."));
-		return Text;
-	}
-
-	FString Result = Text;
-	int32 StartIndex = 0;
-
-	while ((StartIndex = Result.Find(TEXT("<calc="), ESearchCase::IgnoreCase, ESearchDir::FromStart, StartIndex)) != INDEX_NONE)
-	{
-		//   ã
-		int32 EndIndex = Result.Find(TEXT(">"), ESearchCase::IgnoreCase, ESearchDir::FromStart, StartIndex);
-		if (EndIndex == INDEX_NONE || EndIndex <= StartIndex)
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[ReplaceCalcTags] Invalid or mismatched braces in CalcTag."));
-			break;
-		}
-
-		// {calc=...} ± ó
-		FString CalcTag = Result.Mid(StartIndex + 6, EndIndex - StartIndex - 6);
-
-		//  򰡸  ڿ 
-		std::string CalcStr = TCHAR_TO_UTF8(*CalcTag);
-
-		//  	
-		double CalcResult = 0.0;
-		if (ExpressionEvaluator().Evaluate(CalcStr, CalcResult))
-		{
-			// 򰡵   ±׿ ü
-			Result = Result.Replace(*FString::Printf(TEXT("<calc=%s>"), *CalcTag), *FString::SanitizeFloat(CalcResult));
-		}
-		else
-		{
-			UE_LOG(LogTemp, Error, TEXT("[ReplaceCalcTags] Failed to evaluate expression: %s"), *CalcTag);
-		}
-
-		StartIndex = EndIndex + 1;
-	}
-	
-
-	return Result;
-}
\ No newline at end of file
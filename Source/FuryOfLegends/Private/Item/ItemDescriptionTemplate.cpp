@@ -0,0 +1,278 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Item/ItemDescriptionTemplate.h"
+#include "Item/ItemData.h"
+#include "Components/StatComponent.h"
+#include "Plugins/ExpressionEvaluator.h"
+
+
+namespace
+{
+	const FString CharacterStatPrefix(TEXT("<CharacterStat="));
+	const FString CalcPrefix(TEXT("<calc="));
+
+	/** Index 위치의 <CharacterStat=Name> 태그를 읽습니다. 알 수 없는 스탯이면 태그로 보지 않습니다. */
+	bool MatchCharacterStatTag(const FString& Text, int32 Index, ECharacterStat& OutStat, int32& OutEndIndex)
+	{
+		if (FCString::Strncmp(*Text + Index, *CharacterStatPrefix, CharacterStatPrefix.Len()) != 0)
+		{
+			return false;
+		}
+
+		int32 Cursor = Index + CharacterStatPrefix.Len();
+		const int32 NameStart = Cursor;
+		while (Cursor < Text.Len() && (FChar::IsAlnum(Text[Cursor]) || Text[Cursor] == TEXT('_')))
+		{
+			++Cursor;
+		}
+
+		if (Cursor == NameStart || Cursor >= Text.Len() || Text[Cursor] != TEXT('>'))
+		{
+			return false;
+		}
+
+		const int64 Value = StaticEnum<ECharacterStat>()->GetValueByNameString(Text.Mid(NameStart, Cursor - NameStart));
+		if (Value == INDEX_NONE || Value == static_cast<int64>(ECharacterStat::None))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid stat name: %s"), ANSI_TO_TCHAR(__FUNCTION__), *Text.Mid(NameStart, Cursor - NameStart));
+			return false;
+		}
+
+		OutStat = static_cast<ECharacterStat>(Value);
+		OutEndIndex = Cursor + 1;
+		return true;
+	}
+}
+
+
+FItemDescriptionTemplate FItemDescriptionTemplate::Parse(const FItemTableRow& Item)
+{
+	FItemDescriptionTemplate Template;
+	FString Text = Item.Description;
+
+	// 아이템 데이터만으로 정해지는 값은 지금 확정합니다.
+	const UEnum* EnumPtr = StaticEnum<ECharacterStat>();
+	for (const FItemStatModifier& Modifier : Item.StatModifiers)
+	{
+		if (!EnumPtr || !EnumPtr->IsValidEnumValue(static_cast<int64>(Modifier.Key)))
+		{
+			continue;
+		}
+
+		const FString Tag = FString::Printf(TEXT("<ItemStat=%s>"), *EnumPtr->GetNameStringByValue(static_cast<int64>(Modifier.Key)));
+		Text.ReplaceInline(*Tag, *FString::SanitizeFloat(Modifier.Value));
+	}
+
+	for (const TPair<FName, int32>& Pair : Item.UniqueAttributes)
+	{
+		const FString Tag = FString::Printf(TEXT("<ItemAttribute=%s>"), *Pair.Key.ToString());
+		Text.ReplaceInline(*Tag, *FString::FromInt(Pair.Value));
+	}
+
+	FString Pending;
+	int32 Index = 0;
+	while (Index < Text.Len())
+	{
+		ECharacterStat Stat = ECharacterStat::None;
+		int32 TagEnd = INDEX_NONE;
+
+		if (MatchCharacterStatTag(Text, Index, Stat, TagEnd))
+		{
+			Template.AddLiteral(Template.Runs, Pending);
+			Pending.Reset();
+			Template.AddStat(Template.Runs, Stat);
+			Index = TagEnd;
+			continue;
+		}
+
+		if (Text.Mid(Index, CalcPrefix.Len()).Equals(CalcPrefix, ESearchCase::IgnoreCase))
+		{
+			// 수식은 다음 '>' 까지입니다. 안에 있는 <CharacterStat=...> 은 수식의 일부가 됩니다.
+			FItemDescriptionRun CalcRun;
+			CalcRun.Type = EItemDescriptionRunType::Calc;
+
+			FString ExpressionPending;
+			int32 Cursor = Index + CalcPrefix.Len();
+			bool bClosed = false;
+
+			while (Cursor < Text.Len())
+			{
+				if (MatchCharacterStatTag(Text, Cursor, Stat, TagEnd))
+				{
+					Template.AddLiteral(CalcRun.Expression, ExpressionPending);
+					ExpressionPending.Reset();
+					Template.AddStat(CalcRun.Expression, Stat);
+					Cursor = TagEnd;
+					continue;
+				}
+
+				if (Text[Cursor] == TEXT('>'))
+				{
+					bClosed = true;
+					break;
+				}
+
+				ExpressionPending.AppendChar(Text[Cursor++]);
+			}
+
+			// 닫히지 않은 수식은 그대로 출력합니다.
+			if (bClosed == false)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid or mismatched braces in CalcTag."), ANSI_TO_TCHAR(__FUNCTION__));
+				Pending += Text.Mid(Index, CalcPrefix.Len());
+				Index += CalcPrefix.Len();
+				continue;
+			}
+
+			Template.AddLiteral(CalcRun.Expression, ExpressionPending);
+			Template.AddLiteral(Template.Runs, Pending);
+			Pending.Reset();
+			Template.Runs.Add(MoveTemp(CalcRun));
+			Index = Cursor + 1;
+			continue;
+		}
+
+		Pending.AppendChar(Text[Index++]);
+	}
+
+	Template.AddLiteral(Template.Runs, Pending);
+	return Template;
+}
+
+void FItemDescriptionTemplate::AddLiteral(TArray<FItemDescriptionRun>& OutRuns, const FString& Text)
+{
+	if (Text.IsEmpty())
+	{
+		return;
+	}
+
+	const FString Converted = Text.Replace(TEXT("<br>"), TEXT("\n"));
+	if (OutRuns.Num() > 0 && OutRuns.Last().Type == EItemDescriptionRunType::Literal)
+	{
+		OutRuns.Last().Literal += Converted;
+		return;
+	}
+
+	FItemDescriptionRun& Run = OutRuns.AddDefaulted_GetRef();
+	Run.Type = EItemDescriptionRunType::Literal;
+	Run.Literal = Converted;
+}
+
+void FItemDescriptionTemplate::AddStat(TArray<FItemDescriptionRun>& OutRuns, ECharacterStat Stat)
+{
+	FItemDescriptionRun& Run = OutRuns.AddDefaulted_GetRef();
+	Run.Type = EItemDescriptionRunType::CharacterStat;
+	Run.Stat = Stat;
+
+	Dependencies.AddUnique(Stat);
+}
+
+FString FItemDescriptionTemplate::Render(const UStatComponent& StatComponent) const
+{
+	FString Result;
+	RenderRuns(Runs, StatComponent, Result);
+	return Result;
+}
+
+void FItemDescriptionTemplate::RenderRuns(const TArray<FItemDescriptionRun>& InRuns, const UStatComponent& StatComponent, FString& Out)
+{
+	for (const FItemDescriptionRun& Run : InRuns)
+	{
+		switch (Run.Type)
+		{
+		case EItemDescriptionRunType::Literal:
+			Out += Run.Literal;
+			break;
+
+		case EItemDescriptionRunType::CharacterStat:
+			if (IsIntegerStat(Run.Stat))
+			{
+				Out += FString::Printf(TEXT("%d"), FMath::RoundToInt(ReadStat(StatComponent, Run.Stat)));
+			}
+			else
+			{
+				Out += FString::Printf(TEXT("%.2f"), ReadStat(StatComponent, Run.Stat));
+			}
+			break;
+
+		case EItemDescriptionRunType::Calc:
+		{
+			FString Expression;
+			RenderRuns(Run.Expression, StatComponent, Expression);
+
+			double CalcResult = 0.0;
+			if (ExpressionEvaluator().Evaluate(TCHAR_TO_UTF8(*Expression), CalcResult))
+			{
+				Out += FString::SanitizeFloat(CalcResult);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("[%s] Failed to evaluate expression: %s"), ANSI_TO_TCHAR(__FUNCTION__), *Expression);
+				Out += FString::Printf(TEXT("<calc=%s>"), *Expression);
+			}
+			break;
+		}
+		}
+	}
+}
+
+float FItemDescriptionTemplate::ReadStat(const UStatComponent& StatComponent, ECharacterStat Stat)
+{
+	switch (Stat)
+	{
+	case ECharacterStat::MaxHealthPoints:		return StatComponent.GetMaxHP();
+	case ECharacterStat::CurrentHealth:			return StatComponent.GetCurrentHP();
+	case ECharacterStat::MaxManaPoints:			return StatComponent.GetMaxMP();
+	case ECharacterStat::CurrentMana:			return StatComponent.GetCurrentMP();
+	case ECharacterStat::HealthRegeneration:	return StatComponent.GetHealthRegeneration();
+	case ECharacterStat::ManaRegeneration:		return StatComponent.GetManaRegeneration();
+	case ECharacterStat::AttackDamage:			return StatComponent.GetAttackDamage();
+	case ECharacterStat::AbilityPower:			return StatComponent.GetAbilityPower();
+	case ECharacterStat::DefensePower:			return StatComponent.GetDefensePower();
+	case ECharacterStat::MagicResistance:		return StatComponent.GetMagicResistance();
+	case ECharacterStat::AttackSpeed:			return StatComponent.GetAttackSpeed();
+	case ECharacterStat::MovementSpeed:			return StatComponent.GetMovementSpeed();
+	case ECharacterStat::AbilityHaste:			return static_cast<float>(StatComponent.GetAbilityHaste());
+	case ECharacterStat::CriticalChance:		return static_cast<float>(StatComponent.GetCriticalChance());
+	default:									return 0.f;
+	}
+}
+
+bool FItemDescriptionTemplate::IsIntegerStat(ECharacterStat Stat)
+{
+	return Stat == ECharacterStat::AbilityHaste || Stat == ECharacterStat::CriticalChance;
+}
+
+
+const FString& FItemDescriptionCache::GetRichText(const FItemTableRow& Item, const UStatComponent& StatComponent)
+{
+	FEntry* Entry = Entries.Find(Item.ItemCode);
+	if (!Entry)
+	{
+		Entry = &Entries.Add(Item.ItemCode);
+		Entry->Template = FItemDescriptionTemplate::Parse(Item);
+	}
+
+	const TArray<ECharacterStat>& Dependencies = Entry->Template.GetDependencies();
+	Entry->DependencyValues.SetNum(Dependencies.Num());
+
+	bool bDirty = Entry->bRendered == false;
+	for (int32 Index = 0; Index < Dependencies.Num(); ++Index)
+	{
+		const float Value = FItemDescriptionTemplate::ReadStat(StatComponent, Dependencies[Index]);
+		if (Value != Entry->DependencyValues[Index])
+		{
+			Entry->DependencyValues[Index] = Value;
+			bDirty = true;
+		}
+	}
+
+	if (bDirty)
+	{
+		Entry->Text = Entry->Template.Render(StatComponent);
+		Entry->bRendered = true;
+	}
+
+	return Entry->Text;
+}
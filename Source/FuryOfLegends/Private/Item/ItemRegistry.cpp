@@ -0,0 +1,106 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Item/ItemRegistry.h"
+#include "Item/Item.h"
+#include "Engine/DataTable.h"
+
+
+void UItemRegistry::Build(UDataTable* ItemTable)
+{
+	Reset();
+
+	if (!ItemTable)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed: ItemTable is not initialized."), ANSI_TO_TCHAR(__FUNCTION__));
+		return;
+	}
+
+	TArray<FItemTableRow*> Items;
+	ItemTable->GetAllRows<FItemTableRow>(TEXT("GENERAL"), Items);
+
+	if (Items.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] No items found in ItemDataTable."), ANSI_TO_TCHAR(__FUNCTION__));
+		return;
+	}
+
+	Definitions.Reserve(Items.Num());
+
+	for (const FItemTableRow* ItemRow : Items)
+	{
+		if (!ItemRow)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid ItemRow."), ANSI_TO_TCHAR(__FUNCTION__));
+			continue;
+		}
+
+		if (!ItemRow->ItemClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid ItemClass for ItemCode: %d"), ANSI_TO_TCHAR(__FUNCTION__), ItemRow->ItemCode);
+			continue;
+		}
+
+		if (Definitions.Contains(ItemRow->ItemCode))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Duplicate ItemCode found: %d"), ANSI_TO_TCHAR(__FUNCTION__), ItemRow->ItemCode);
+			continue;
+		}
+
+		// 같은 클래스를 쓰는 행들은 하나의 CDO 를 공유합니다. 행별 수치는 Row 에서 읽습니다.
+		const AItem* Behavior = ItemRow->ItemClass->GetDefaultObject<AItem>();
+		if (!Behavior)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[%s] Failed to resolve behavior for ItemCode: %d, Class: %s"), ANSI_TO_TCHAR(__FUNCTION__), ItemRow->ItemCode, *ItemRow->ItemClass->GetName());
+			continue;
+		}
+
+		FItemDefinition& Definition = Definitions.Add(ItemRow->ItemCode);
+		Definition.Row = *ItemRow;
+		Definition.Behavior = Behavior;
+
+		UE_LOG(LogTemp, Log, TEXT("Loaded Item: %d, %s, %d, %s"),
+			ItemRow->ItemCode,
+			*ItemRow->Name,
+			ItemRow->Price,
+			*ItemRow->Description);
+	}
+
+	// 모든 정의가 등록된 뒤에 하위 아이템을 펼쳐야 테이블 행 순서와 무관하게 결과가 같습니다.
+	for (const auto& DefinitionPair : Definitions)
+	{
+		GenerateSubItems(DefinitionPair.Key);
+	}
+}
+
+void UItemRegistry::Reset()
+{
+	Definitions.Empty();
+	RequiredSubItems.Empty();
+}
+
+void UItemRegistry::GenerateSubItems(int32 ItemCode)
+{
+	TMap<int32, int32>& SubItemMap = RequiredSubItems.FindOrAdd(ItemCode);
+	TFunction<void(int32)> FindSubItemsRecursive = [this, &FindSubItemsRecursive, &SubItemMap](int32 CurrentItemCode)
+		{
+			const FItemDefinition* Definition = Definitions.Find(CurrentItemCode);
+			if (!Definition)
+			{
+				return;
+			}
+
+			// 현재 아이템의 하위 아이템 가져오기
+			for (int32 SubItemCode : Definition->Row.RequiredItems)
+			{
+				// 하위 아이템이 이미 존재하면 개수를 증가, 없으면 추가
+				SubItemMap.FindOrAdd(SubItemCode)++;
+
+				// 재귀적으로 처리
+				FindSubItemsRecursive(SubItemCode);
+			}
+		};
+
+	// 재귀 탐색 시작
+	FindSubItemsRecursive(ItemCode);
+}
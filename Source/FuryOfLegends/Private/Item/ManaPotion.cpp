@@ -2,32 +2,15 @@
 
 
 #include "Item/ManaPotion.h"
+#include "Item/ItemRegistry.h"
+#include "Item/ItemInstance.h"
 #include "Game/ArenaPlayerState.h"
 #include "Characters/AOSCharacterBase.h"
-#include "Components/StatComponent.h"
+#include "Components/PeriodicEffectComponent.h"
 #include "Plugins/UniqueCodeGenerator.h"
 
-AManaPotion::AManaPotion()
-{
-    HealingAmount = 150.f;
-    HealingDuration = 15.f;
-    AccumulatedHealing = 0.f;
-
-    ElapsedTime = 0.f;
-    TotalElapsedTime = 0.f;
-    RemainingTime = 0.f;
-}
-
-
-void AManaPotion::Initialize()
-{
-    HealingAmount = UniqueAttributes.Contains("HealingAmount") ? UniqueAttributes["HealingAmount"] : 0.f;
-    HealingDuration = UniqueAttributes.Contains("HealingDuration") ? UniqueAttributes["HealingDuration"] : 0.f;
-    RemainingTime = HealingDuration;
-}
-
 
-void AManaPotion::Use(AArenaPlayerState* PlayerState)
+void AManaPotion::Use(const FItemDefinition& Definition, FItemInstance& Instance, AArenaPlayerState* PlayerState) const
 {
     if (!::IsValid(PlayerState))
     {
@@ -51,78 +34,38 @@ void AManaPotion::Use(AArenaPlayerState* PlayerState)
         return;
     }
 
-    UStatComponent* PlayerStatComponent = PlayerCharacter->GetStatComponent();
-    if (!::IsValid(PlayerStatComponent))
+    UPeriodicEffectComponent* EffectComponent = PlayerCharacter->GetPeriodicEffectComponent();
+    if (!::IsValid(EffectComponent))
     {
         return;
     }
 
+    const int32 ItemCode = Definition.Row.ItemCode;
+    const float HealingAmount = Definition.GetAttribute(TEXT("HealingAmount"), 0.f);
+    const float HealingDuration = Definition.GetAttribute(TEXT("HealingDuration"), 0.f);
+
     EObjectType ObjectType = PlayerCharacter->ObjectType;
     int32 PlayerIndex = PlayerState->GetPlayerIndex();
     ETimerCategory TimerCategory = ETimerCategory::Item;
     uint8 TimerType = static_cast<uint8>(ETimerType::BuffList);
     uint8 ItemType = static_cast<uint8>(ItemCode);
 
-    uint32 UniqueCode = UUniqueCodeGenerator::GenerateUniqueCode(ObjectType, PlayerIndex, TimerCategory, TimerType, ItemType);
-
-    //   ȸ ü 
+    //   ȸ  
     const float TickInterval = 0.5f;
-    const int RepeatCount = FMath::CeilToInt(HealingDuration / TickInterval);
-    const float IncrementAmount = HealingAmount / RepeatCount;
-
-    // ȸ Ÿ̸ ݹ: ü  ð  ȸ
-    auto HealthRegenCallback = [this, WeakStatComponent = TWeakObjectPtr<UStatComponent>(PlayerStatComponent), WeakPlayerState = TWeakObjectPtr<AArenaPlayerState>(PlayerState), TickInterval, IncrementAmount, UniqueCode]()
-        {
-            if (!WeakStatComponent.IsValid() || !WeakPlayerState.IsValid())
-            {
-                return;
-            }
-
-            ElapsedTime += 0.1f;
-            TotalElapsedTime += 0.1f;
-            RemainingTime = FMath::Max(0.f, HealingDuration - TotalElapsedTime);
-            WeakPlayerState->ClientNotifyRemainingTime(UniqueCode, RemainingTime, TotalElapsedTime);
-
-            if (ElapsedTime >= TickInterval)
-            {
-                ElapsedTime = 0.f;
-                WeakStatComponent->ModifyCurrentMP(IncrementAmount);
-                AccumulatedHealing += IncrementAmount;
-            }
-
-            // ȸ Ϸ ó
-            if (TotalElapsedTime >= HealingDuration)
-            {
-                --ConcurrentUses;
-                WeakPlayerState->ClientNotifyTimerUpdated(UniqueCode, ConcurrentUses);
-                
-                if (ConcurrentUses <= 0)
-                {
-                    WeakPlayerState->ClearTimer(UniqueCode);
-                    WeakPlayerState->ClientNotifyRemainingTime(UniqueCode, 0, 0);
-                    ActivationState = EItemActivationState::Expired;
-                }
-                else
-                {
-                    ElapsedTime = 0.f;
-                    TotalElapsedTime = 0.f;
-                    RemainingTime = 0.f;
-                    AccumulatedHealing = 0.f;
-                }
-            }
-        };
-
-    ConcurrentUses++;
-    CurrentStackPerSlot--;
-
-    //  Ÿ̸Ӱ  ο Ÿ̸ 
-    if (!PlayerState->IsTimerActive(UniqueCode))
-    {
-        ActivationState = EItemActivationState::Active;
-        PlayerState->SetTimer(UniqueCode, HealthRegenCallback, 0.1f, true, 0.1f);
-    }
-    else
+    const int RepeatCount = FMath::Max(FMath::CeilToInt(HealingDuration / TickInterval), 1);
+
+    //   ø   ʷ ̾ ȸմϴ.
+    FPeriodicEffectSpec Spec;
+    Spec.SourceCode = UUniqueCodeGenerator::GenerateUniqueCode(ObjectType, PlayerIndex, TimerCategory, TimerType, ItemType);
+    Spec.Type = EPeriodicEffectType::Mana;
+    Spec.Stacking = EPeriodicEffectStacking::Queue;
+    Spec.AmountPerTick = HealingAmount / RepeatCount;
+    Spec.TickInterval = TickInterval;
+    Spec.Duration = HealingDuration;
+    Spec.MaxStacks = MAX_int32;
+
+    if (EffectComponent->AddEffect(Spec))
     {
-        PlayerState->ClientNotifyTimerUpdated(UniqueCode, ConcurrentUses);
+        Instance.Stack--;
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,126 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Plugins/CosmeticDispatcher.h"
+#include "Components/StaticMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Particles/ParticleSystem.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+
+int32 UCosmeticDispatcher::SuppressedCount = 0;
+int32 UCosmeticDispatcher::DedicatedServerSpawnCount = 0;
+
+
+bool UCosmeticDispatcher::CanSpawnCosmetics(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World)
+	{
+		return false;
+	}
+
+	if (World->GetNetMode() == NM_DedicatedServer)
+	{
+		++SuppressedCount;
+		return false;
+	}
+
+	return true;
+}
+
+void UCosmeticDispatcher::NotifySpawned(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (World && World->GetNetMode() == NM_DedicatedServer)
+	{
+		++DedicatedServerSpawnCount;
+		UE_LOG(LogTemp, Warning, TEXT("[%s] Cosmetic component created on a dedicated server."), ANSI_TO_TCHAR(__FUNCTION__));
+	}
+}
+
+UParticleSystemComponent* UCosmeticDispatcher::SpawnEmitterAtLocation(const UObject* WorldContextObject, UParticleSystem* Particle, const FTransform& Transform, bool bAutoDestroy, EPSCPoolMethod PoolingMethod, bool bAutoActivate)
+{
+	if (::IsValid(Particle) == false || CanSpawnCosmetics(WorldContextObject) == false)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemComponent* ParticleSystemComponent = UGameplayStatics::SpawnEmitterAtLocation(
+		WorldContextObject, Particle, Transform.GetLocation(), Transform.GetRotation().Rotator(), Transform.GetScale3D(), bAutoDestroy, PoolingMethod, bAutoActivate);
+
+	NotifySpawned(WorldContextObject);
+	return ParticleSystemComponent;
+}
+
+UParticleSystemComponent* UCosmeticDispatcher::SpawnEmitterAttached(UParticleSystem* Particle, USceneComponent* AttachToComponent, const FTransform& Transform, EAttachLocation::Type LocationType)
+{
+	if (::IsValid(Particle) == false || ::IsValid(AttachToComponent) == false || CanSpawnCosmetics(AttachToComponent) == false)
+	{
+		return nullptr;
+	}
+
+	UParticleSystemComponent* ParticleSystemComponent = UGameplayStatics::SpawnEmitterAttached(
+		Particle, AttachToComponent, NAME_None, Transform.GetLocation(), Transform.GetRotation().Rotator(), Transform.GetScale3D(), LocationType, true, EPSCPoolMethod::AutoRelease, true);
+
+	NotifySpawned(AttachToComponent);
+	return ParticleSystemComponent;
+}
+
+UStaticMeshComponent* UCosmeticDispatcher::SpawnMeshAttached(AActor* Owner, UStaticMesh* Mesh, USceneComponent* AttachToComponent, float Duration)
+{
+	if (::IsValid(Owner) == false || ::IsValid(Mesh) == false || CanSpawnCosmetics(Owner) == false)
+	{
+		return nullptr;
+	}
+
+	UStaticMeshComponent* NewMeshComponent = NewObject<UStaticMeshComponent>(Owner, UStaticMeshComponent::StaticClass());
+	if (::IsValid(NewMeshComponent) == false)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create new mesh component."), ANSI_TO_TCHAR(__FUNCTION__));
+		return nullptr;
+	}
+
+	FAttachmentTransformRules AttachmentRules(EAttachmentRule::KeepRelative, false);
+
+	NewMeshComponent->CreationMethod = EComponentCreationMethod::Instance;
+	NewMeshComponent->AttachToComponent(AttachToComponent != nullptr ? AttachToComponent : Owner->GetRootComponent(), AttachmentRules);
+	NewMeshComponent->SetStaticMesh(Mesh);
+	NewMeshComponent->SetCollisionProfileName("CharacterMesh");
+	NewMeshComponent->RegisterComponent();
+
+	NotifySpawned(Owner);
+
+	FTimerHandle NewTimerHandle;
+	Owner->GetWorldTimerManager().SetTimer(NewTimerHandle, [WeakMeshComponent = TWeakObjectPtr<UStaticMeshComponent>(NewMeshComponent)]()
+		{
+			if (WeakMeshComponent.IsValid())
+			{
+				WeakMeshComponent->DestroyComponent();
+			}
+		},
+		Duration,
+		false
+	);
+
+	return NewMeshComponent;
+}
+
+
+/** --------------------------------------------------------------------------------
+ * Arena.Cosmetic.Report
+ * 데디케이티드 서버에서 막은 장식 요청 수와 실제로 만들어진 장식 컴포넌트 수를 출력합니다.
+ */
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommand CosmeticReportCommand(
+	TEXT("Arena.Cosmetic.Report"),
+	TEXT("Logs how many cosmetic requests were suppressed on the dedicated server and how many cosmetic components were created there (expected 0)."),
+	FConsoleCommandDelegate::CreateLambda([]()
+		{
+			UE_LOG(LogTemp, Log, TEXT("[Cosmetic] suppressed on dedicated server: %d, created on dedicated server: %d"),
+				UCosmeticDispatcher::GetSuppressedCount(), UCosmeticDispatcher::GetDedicatedServerSpawnCount());
+		}));
+#endif
@@ -6,6 +6,29 @@
 #include <initializer_list>
 #include <cstdarg>
 
+
+DEFINE_LOG_CATEGORY(LogArena);
+DEFINE_LOG_CATEGORY(LogArenaCombat);
+
+
+bool FGameLogThrottle::ShouldLog(float IntervalSeconds, int32& OutSuppressedCount)
+{
+	const uint64 Now = FPlatformTime::Cycles64();
+	uint64 NextAllowed = NextAllowedCycles.load(std::memory_order_relaxed);
+
+	//    尡   常 մϴ.
+	const uint64 IntervalCycles = static_cast<uint64>(FMath::Max(0.f, IntervalSeconds) / FPlatformTime::GetSecondsPerCycle64());
+	if (Now < NextAllowed || NextAllowedCycles.compare_exchange_strong(NextAllowed, Now + IntervalCycles, std::memory_order_relaxed) == false)
+	{
+		SuppressedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	OutSuppressedCount = SuppressedCount.exchange(0, std::memory_order_relaxed);
+	return true;
+}
+
+
 GameLogger::GameLogger()
 {
 }
@@ -17,6 +40,11 @@ GameLogger::~GameLogger()
 
 void GameLogger::Log(const FString& FunctionName, const ACharacter* Character, const TCHAR* Format, ...)
 {
+    if (UE_LOG_ACTIVE(LogArena, Log) == false)
+    {
+        return;
+    }
+
     //    ó
     va_list Args;
     va_start(Args, Format);
@@ -35,12 +63,12 @@ void GameLogger::Log(const FString& FunctionName, const ACharacter* Character, c
     // α ޽ 
     if (Character)
     {
-        UE_LOG(LogTemp, Log, TEXT("[%s] [Character: %s] - %s"),
+        UE_LOG(LogArena, Log, TEXT("[%s] [Character: %s] - %s"),
             *FunctionName, *Character->GetName(), *FormattedMessage);
     }
     else
     {
-        UE_LOG(LogTemp, Log, TEXT("[%s] [Character: None] - %s"),
+        UE_LOG(LogArena, Log, TEXT("[%s] [Character: None] - %s"),
             *FunctionName, *FormattedMessage);
     }
 }
\ No newline at end of file
@@ -0,0 +1,337 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Plugins/GameplayQuery.h"
+#include "Characters/CharacterBase.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+
+
+namespace
+{
+	// 게임 스레드 전용 오버랩 버퍼
+	TArray<FOverlapResult> ScratchOverlaps;
+
+	float GetSphereVolume(float Radius)
+	{
+		return (4.f / 3.f) * PI * Radius * Radius * Radius;
+	}
+
+	/** 오버랩 결과를 질의 조건으로 걸러 OutCharacters 에 중복 없이 추가합니다. */
+	int32 CollectCharacters(const FGameplayQuery& Query, const TArray<FOverlapResult>& Overlaps, TArray<ACharacterBase*>& OutCharacters)
+	{
+		const int32 PrevNum = OutCharacters.Num();
+		for (const FOverlapResult& Overlap : Overlaps)
+		{
+			ACharacterBase* Character = Cast<ACharacterBase>(Overlap.GetActor());
+			if (::IsValid(Character) == false || Query.PassesFilter(Character) == false)
+			{
+				continue;
+			}
+
+			OutCharacters.AddUnique(Character);
+		}
+
+		return OutCharacters.Num() - PrevNum;
+	}
+}
+
+
+FGameplayQuery FGameplayQuery::Sphere(const FVector& InLocation, float Radius, ECollisionChannel InChannel)
+{
+	FGameplayQuery Query;
+	Query.Location = InLocation;
+	Query.Shape = FCollisionShape::MakeSphere(Radius);
+	Query.Channel = InChannel;
+	return Query;
+}
+
+FGameplayQuery FGameplayQuery::Box(const FVector& InLocation, const FVector& HalfExtent, const FQuat& InRotation, ECollisionChannel InChannel)
+{
+	FGameplayQuery Query;
+	Query.Location = InLocation;
+	Query.Rotation = InRotation;
+	Query.Shape = FCollisionShape::MakeBox(HalfExtent);
+	Query.Channel = InChannel;
+	return Query;
+}
+
+FGameplayQuery FGameplayQuery::Capsule(const FVector& InLocation, float Radius, float HalfHeight, const FQuat& InRotation, ECollisionChannel InChannel)
+{
+	FGameplayQuery Query;
+	Query.Location = InLocation;
+	Query.Rotation = InRotation;
+	Query.Shape = FCollisionShape::MakeCapsule(Radius, HalfHeight);
+	Query.Channel = InChannel;
+	return Query;
+}
+
+FGameplayQuery FGameplayQuery::Cone(const FVector& Apex, const FVector& Direction, float Length, float HalfAngleDegrees, ECollisionChannel InChannel)
+{
+	FGameplayQuery Query = Sphere(Apex, Length, InChannel);
+	Query.ConeDirection = Direction.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+	Query.ConeCosHalfAngle = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(HalfAngleDegrees, 0.f, 180.f)));
+	return Query;
+}
+
+FSphere FGameplayQuery::GetBoundingSphere() const
+{
+	switch (Shape.ShapeType)
+	{
+	case ECollisionShape::Sphere:	return FSphere(Location, Shape.GetSphereRadius());
+	case ECollisionShape::Box:		return FSphere(Location, Shape.GetBox().Size());
+	case ECollisionShape::Capsule:	return FSphere(Location, Shape.GetCapsuleHalfHeight());
+	default:						return FSphere(Location, 0.f);
+	}
+}
+
+bool FGameplayQuery::PassesFilter(const ACharacterBase* Character) const
+{
+	if (IgnoredActors.Contains(Character))
+	{
+		return false;
+	}
+
+	if (TeamFilter == EQueryTeamFilter::Enemies && Character->TeamSide == TeamSide)
+	{
+		return false;
+	}
+
+	if (TeamFilter == EQueryTeamFilter::Allies && Character->TeamSide != TeamSide)
+	{
+		return false;
+	}
+
+	if (ObjectType != EObjectType::None && Character->ObjectType != ObjectType)
+	{
+		return false;
+	}
+
+	if (ConeCosHalfAngle > -1.f)
+	{
+		const FVector ToCharacter = Character->GetActorLocation() - Location;
+		if (ToCharacter.IsNearlyZero() == false && FVector::DotProduct(ToCharacter.GetUnsafeNormal(), ConeDirection) < ConeCosHalfAngle)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+int32 GameplayQuery::Overlap(const UWorld* World, const FGameplayQuery& Query, TArray<ACharacterBase*>& OutCharacters)
+{
+	check(IsInGameThread());
+
+	if (!World)
+	{
+		return 0;
+	}
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GameplayQuery), false);
+	for (const AActor* IgnoredActor : Query.IgnoredActors)
+	{
+		Params.AddIgnoredActor(IgnoredActor);
+	}
+
+	ScratchOverlaps.Reset();
+	if (World->OverlapMultiByChannel(ScratchOverlaps, Query.Location, Query.Rotation, Query.Channel, Query.Shape, Params) == false)
+	{
+		return 0;
+	}
+
+	return CollectCharacters(Query, ScratchOverlaps, OutCharacters);
+}
+
+
+int32 FGameplayQueryBatch::Add(const FGameplayQuery& Query)
+{
+	return Queries.Add(Query);
+}
+
+void FGameplayQueryBatch::Reset()
+{
+	Queries.Reset();
+	for (TArray<ACharacterBase*>& QueryResults : Results)
+	{
+		QueryResults.Reset();
+	}
+}
+
+TConstArrayView<ACharacterBase*> FGameplayQueryBatch::GetResults(int32 QueryIndex) const
+{
+	return Results.IsValidIndex(QueryIndex) ? TConstArrayView<ACharacterBase*>(Results[QueryIndex]) : TConstArrayView<ACharacterBase*>();
+}
+
+void FGameplayQueryBatch::Execute(const UWorld* World)
+{
+	check(IsInGameThread());
+
+	SceneQueryCount = 0;
+	if (Results.Num() < Queries.Num())
+	{
+		Results.SetNum(Queries.Num());
+	}
+
+	for (int32 Index = 0; Index < Queries.Num(); ++Index)
+	{
+		Results[Index].Reset();
+	}
+
+	if (!World)
+	{
+		return;
+	}
+
+	// 채널이 같은 질의끼리 묶습니다. 배치 하나에 채널이 여러 개 섞이는 일은 드물어 선형 탐색으로 충분합니다.
+	TArray<ECollisionChannel, TInlineAllocator<4>> Channels;
+	for (const FGameplayQuery& Query : Queries)
+	{
+		Channels.AddUnique(Query.Channel);
+	}
+
+	for (const ECollisionChannel Channel : Channels)
+	{
+		GroupIndices.Reset();
+
+		FSphere Bounds(ForceInit);
+		float VolumeSum = 0.f;
+		for (int32 Index = 0; Index < Queries.Num(); ++Index)
+		{
+			if (Queries[Index].Channel != Channel)
+			{
+				continue;
+			}
+
+			const FSphere QueryBounds = Queries[Index].GetBoundingSphere();
+			Bounds += QueryBounds;
+			VolumeSum += GetSphereVolume(QueryBounds.W);
+			GroupIndices.Add(Index);
+		}
+
+		if (GroupIndices.Num() > 1 && GetSphereVolume(Bounds.W) <= VolumeSum * MergeVolumeRatio)
+		{
+			ExecuteMerged(World, Channel, Bounds, GroupIndices);
+			continue;
+		}
+
+		for (const int32 Index : GroupIndices)
+		{
+			GameplayQuery::Overlap(World, Queries[Index], Results[Index]);
+			++SceneQueryCount;
+		}
+	}
+}
+
+void FGameplayQueryBatch::ExecuteMerged(const UWorld* World, ECollisionChannel Channel, const FSphere& Bounds, TConstArrayView<int32> QueryIndices)
+{
+	OverlapBuffer.Reset();
+	++SceneQueryCount;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(GameplayQueryBatch), false);
+	if (World->OverlapMultiByChannel(OverlapBuffer, Bounds.Center, FQuat::Identity, Channel, FCollisionShape::MakeSphere(Bounds.W), Params) == false)
+	{
+		return;
+	}
+
+	// 후보 컴포넌트가 각 질의의 모양과 실제로 겹치는지는 컴포넌트 단위로 확인합니다.
+	for (const FOverlapResult& Overlap : OverlapBuffer)
+	{
+		UPrimitiveComponent* Component = Overlap.GetComponent();
+		ACharacterBase* Character = Cast<ACharacterBase>(Overlap.GetActor());
+		if (::IsValid(Component) == false || ::IsValid(Character) == false)
+		{
+			continue;
+		}
+
+		for (const int32 Index : QueryIndices)
+		{
+			const FGameplayQuery& Query = Queries[Index];
+			if (Query.PassesFilter(Character) == false || Results[Index].Contains(Character))
+			{
+				continue;
+			}
+
+			if (Component->OverlapComponent(Query.Location, Query.Rotation, Query.Shape))
+			{
+				Results[Index].Add(Character);
+			}
+		}
+	}
+}
+
+
+/** --------------------------------------------------------------------------------
+ * Arena.Query.Benchmark [Count] [Radius] [Spread]
+ * 첫 번째 플레이어 주변의 무작위 위치에 Count 개의 폭발 질의를 만들어 개별 오버랩과 배치 처리의 시간을 비교합니다.
+ */
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorldAndArgs GameplayQueryBenchmarkCommand(
+	TEXT("Arena.Query.Benchmark"),
+	TEXT("Runs Count simultaneous sphere queries around the first player and logs per-query overlap versus batched timing. Args: [Count=32] [Radius=300] [Spread=1500]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World)
+			{
+				return;
+			}
+
+			const int32 Count = Args.IsValidIndex(0) ? FMath::Max(1, FCString::Atoi(*Args[0])) : 32;
+			const float Radius = Args.IsValidIndex(1) ? FMath::Max(1.f, FCString::Atof(*Args[1])) : 300.f;
+			const float Spread = Args.IsValidIndex(2) ? FMath::Max(0.f, FCString::Atof(*Args[2])) : 1500.f;
+			constexpr int32 Iterations = 20;
+
+			const APawn* Pawn = UGameplayStatics::GetPlayerPawn(World, 0);
+			const FVector Origin = Pawn ? Pawn->GetActorLocation() : FVector::ZeroVector;
+
+			FRandomStream Stream(Count);
+			TArray<FGameplayQuery> Queries;
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				const FVector Offset(Stream.FRandRange(-Spread, Spread), Stream.FRandRange(-Spread, Spread), 0.f);
+				Queries.Add(FGameplayQuery::Sphere(Origin + Offset, Radius, ECC_GameTraceChannel5));
+			}
+
+			TArray<ACharacterBase*> Characters;
+			int32 SingleHits = 0;
+			const double SingleStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				SingleHits = 0;
+				for (const FGameplayQuery& Query : Queries)
+				{
+					Characters.Reset();
+					SingleHits += GameplayQuery::Overlap(World, Query, Characters);
+				}
+			}
+			const double SingleMs = (FPlatformTime::Seconds() - SingleStart) * 1000.0 / Iterations;
+
+			FGameplayQueryBatch Batch;
+			int32 BatchHits = 0;
+			const double BatchStart = FPlatformTime::Seconds();
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				Batch.Reset();
+				for (const FGameplayQuery& Query : Queries)
+				{
+					Batch.Add(Query);
+				}
+
+				Batch.Execute(World);
+
+				BatchHits = 0;
+				for (int32 Index = 0; Index < Batch.Num(); ++Index)
+				{
+					BatchHits += Batch.GetResults(Index).Num();
+				}
+			}
+			const double BatchMs = (FPlatformTime::Seconds() - BatchStart) * 1000.0 / Iterations;
+
+			UE_LOG(LogTemp, Log, TEXT("[GameplayQuery] %d queries (radius %.0f, spread %.0f): single %.3f ms / %d hits, batched %.3f ms / %d hits / %d scene queries"),
+				Count, Radius, Spread, SingleMs, SingleHits, BatchMs, BatchHits, Batch.GetSceneQueryCount());
+		}));
+#endif
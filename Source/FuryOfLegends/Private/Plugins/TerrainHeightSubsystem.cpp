@@ -0,0 +1,288 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Plugins/TerrainHeightSubsystem.h"
+#include "Components/PrimitiveComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+
+UTerrainHeightSubsystem* UTerrainHeightSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UTerrainHeightSubsystem>() : nullptr;
+}
+
+bool UTerrainHeightSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTerrainHeightSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	Bake(InWorld);
+}
+
+void UTerrainHeightSubsystem::Deinitialize()
+{
+	Heights.Empty();
+	UsableSamples.Empty();
+	NumX = NumY = UsableSampleCount = 0;
+
+	Super::Deinitialize();
+}
+
+FBox UTerrainHeightSubsystem::GatherStaticBounds(UWorld& InWorld, TArray<FBox>& OutDynamicBounds) const
+{
+	FBox StaticBounds(ForceInit);
+
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		const AActor* Actor = *It;
+
+		// 캐릭터는 지형이 아닙니다.
+		if (::IsValid(Actor) == false || Actor->IsA<APawn>())
+		{
+			continue;
+		}
+
+		Actor->ForEachComponent<UPrimitiveComponent>(false, [&StaticBounds, &OutDynamicBounds](const UPrimitiveComponent* Component)
+			{
+				if (Component->IsCollisionEnabled() == false || Component->GetCollisionResponseToChannel(ECC_WorldStatic) != ECR_Block)
+				{
+					return;
+				}
+
+				if (Component->Mobility == EComponentMobility::Movable)
+				{
+					OutDynamicBounds.Add(Component->Bounds.GetBox());
+				}
+				else if (Component->GetCollisionObjectType() == ECC_WorldStatic)
+				{
+					StaticBounds += Component->Bounds.GetBox();
+				}
+			});
+	}
+
+	return StaticBounds;
+}
+
+void UTerrainHeightSubsystem::Bake(UWorld& InWorld)
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FBox> DynamicBounds;
+	const FBox Bounds = GatherStaticBounds(InWorld, DynamicBounds);
+	if (Bounds.IsValid == false)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[%s] No static geometry found. Every query will fall back to traces."), ANSI_TO_TCHAR(__FUNCTION__));
+		return;
+	}
+
+	const FVector Size = Bounds.GetSize();
+	CellSize = FMath::Max(CellSize, static_cast<float>(FMath::Max(Size.X, Size.Y)) / (MaxCellsPerAxis - 1));
+
+	Origin = FVector2D(Bounds.Min.X, Bounds.Min.Y);
+	NumX = FMath::CeilToInt(Size.X / CellSize) + 1;
+	NumY = FMath::CeilToInt(Size.Y / CellSize) + 1;
+
+	Heights.SetNumZeroed(NumX * NumY);
+	UsableSamples.Init(false, NumX * NumY);
+	UsableSampleCount = 0;
+
+	// 움직이는 액터에 막히지 않도록 WorldStatic 오브젝트만 봅니다.
+	const FCollisionObjectQueryParams ObjectParams(ECC_WorldStatic);
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(TerrainHeightBake), false);
+	const float TraceStartZ = Bounds.Max.Z + 100.f;
+	const float TraceEndZ = Bounds.Min.Z - 100.f;
+
+	FHitResult HitResult;
+	for (int32 Y = 0; Y < NumY; ++Y)
+	{
+		for (int32 X = 0; X < NumX; ++X)
+		{
+			const FVector2D Position = Origin + FVector2D(X, Y) * CellSize;
+			if (InWorld.LineTraceSingleByObjectType(HitResult, FVector(Position, TraceStartZ), FVector(Position, TraceEndZ), ObjectParams, Params) == false)
+			{
+				continue;
+			}
+
+			const int32 Index = GetIndex(X, Y);
+			Heights[Index] = HitResult.Location.Z;
+			UsableSamples[Index] = true;
+			++UsableSampleCount;
+		}
+	}
+
+	for (const FBox& DynamicBox : DynamicBounds)
+	{
+		InvalidateRegion(DynamicBox);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[%s] Baked %d x %d height samples (cell %.0f, %d usable, %d dynamic regions) in %.1f ms."),
+		ANSI_TO_TCHAR(__FUNCTION__), NumX, NumY, CellSize, UsableSampleCount, DynamicBounds.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void UTerrainHeightSubsystem::InvalidateRegion(const FBox& Box)
+{
+	if (IsBaked() == false || Box.IsValid == false)
+	{
+		return;
+	}
+
+	// 경계에 걸친 칸의 보간도 막기 위해 한 칸씩 넓혀 무효화합니다.
+	const int32 MinX = FMath::Clamp(FMath::FloorToInt((Box.Min.X - Origin.X) / CellSize), 0, NumX - 1);
+	const int32 MinY = FMath::Clamp(FMath::FloorToInt((Box.Min.Y - Origin.Y) / CellSize), 0, NumY - 1);
+	const int32 MaxX = FMath::Clamp(FMath::CeilToInt((Box.Max.X - Origin.X) / CellSize), 0, NumX - 1);
+	const int32 MaxY = FMath::Clamp(FMath::CeilToInt((Box.Max.Y - Origin.Y) / CellSize), 0, NumY - 1);
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const int32 Index = GetIndex(X, Y);
+			if (UsableSamples[Index])
+			{
+				UsableSamples[Index] = false;
+				--UsableSampleCount;
+			}
+		}
+	}
+}
+
+bool UTerrainHeightSubsystem::IsUsable(int32 X, int32 Y) const
+{
+	return X >= 0 && Y >= 0 && X < NumX && Y < NumY && UsableSamples[GetIndex(X, Y)];
+}
+
+bool UTerrainHeightSubsystem::SampleGrid(const FVector2D& Position, float& OutHeight, FVector* OutNormal) const
+{
+	if (IsBaked() == false)
+	{
+		return false;
+	}
+
+	const FVector2D Local = (Position - Origin) / CellSize;
+	const int32 X = FMath::FloorToInt(Local.X);
+	const int32 Y = FMath::FloorToInt(Local.Y);
+
+	if (IsUsable(X, Y) == false || IsUsable(X + 1, Y) == false || IsUsable(X, Y + 1) == false || IsUsable(X + 1, Y + 1) == false)
+	{
+		return false;
+	}
+
+	const float H00 = Heights[GetIndex(X, Y)];
+	const float H10 = Heights[GetIndex(X + 1, Y)];
+	const float H01 = Heights[GetIndex(X, Y + 1)];
+	const float H11 = Heights[GetIndex(X + 1, Y + 1)];
+
+	// 절벽이나 벽 가장자리는 보간하면 경사로처럼 보이므로 트레이스에 맡깁니다.
+	const float MinHeight = FMath::Min(FMath::Min(H00, H10), FMath::Min(H01, H11));
+	const float MaxHeight = FMath::Max(FMath::Max(H00, H10), FMath::Max(H01, H11));
+	if (MaxHeight - MinHeight > MaxInterpolationDelta)
+	{
+		return false;
+	}
+
+	const float AlphaX = Local.X - X;
+	const float AlphaY = Local.Y - Y;
+	OutHeight = FMath::BiLerp(H00, H10, H01, H11, AlphaX, AlphaY);
+
+	if (OutNormal)
+	{
+		const float SlopeX = FMath::Lerp(H10 - H00, H11 - H01, AlphaY) / CellSize;
+		const float SlopeY = FMath::Lerp(H01 - H00, H11 - H10, AlphaX) / CellSize;
+		*OutNormal = FVector(-SlopeX, -SlopeY, 1.f).GetSafeNormal();
+	}
+
+	return true;
+}
+
+bool UTerrainHeightSubsystem::TraceHeight(const FVector& Location, float& OutHeight, FVector* OutNormal, const AActor* IgnoredActor) const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	FHitResult HitResult;
+	const FCollisionQueryParams Params(SCENE_QUERY_STAT(TerrainHeightTrace), false, IgnoredActor);
+	const FVector Offset(0.f, 0.f, FallbackTraceHalfHeight);
+
+	if (World->LineTraceSingleByChannel(HitResult, Location + Offset, Location - Offset, ECC_WorldStatic, Params) == false)
+	{
+		return false;
+	}
+
+	OutHeight = HitResult.Location.Z;
+	if (OutNormal)
+	{
+		*OutNormal = HitResult.ImpactNormal;
+	}
+
+	return true;
+}
+
+bool UTerrainHeightSubsystem::SampleHeight(const FVector& Location, float& OutHeight, FVector* OutNormal, const AActor* IgnoredActor) const
+{
+	if (SampleGrid(FVector2D(Location), OutHeight, OutNormal))
+	{
+		++GridSampleCount;
+		return true;
+	}
+
+	++FallbackTraceCount;
+	return TraceHeight(Location, OutHeight, OutNormal, IgnoredActor);
+}
+
+bool UTerrainHeightSubsystem::ProjectToGround(const FVector& Location, FVector& OutGroundLocation, const AActor* IgnoredActor) const
+{
+	float Height = 0.f;
+	if (SampleHeight(Location, Height, nullptr, IgnoredActor) == false)
+	{
+		return false;
+	}
+
+	OutGroundLocation = FVector(Location.X, Location.Y, Height);
+	return true;
+}
+
+bool UTerrainHeightSubsystem::SampleSlopeDegrees(const FVector& Location, float& OutSlopeDegrees, const AActor* IgnoredActor) const
+{
+	float Height = 0.f;
+	FVector Normal = FVector::UpVector;
+	if (SampleHeight(Location, Height, &Normal, IgnoredActor) == false)
+	{
+		return false;
+	}
+
+	OutSlopeDegrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(Normal.Z, -1.f, 1.f)));
+	return true;
+}
+
+
+/** --------------------------------------------------------------------------------
+ * Arena.Terrain.Report
+ * 격자로 답한 높이 질의 수와 트레이스로 대신한 수를 출력합니다.
+ */
+
+#if !UE_BUILD_SHIPPING
+static FAutoConsoleCommandWithWorld TerrainReportCommand(
+	TEXT("Arena.Terrain.Report"),
+	TEXT("Logs how many terrain height queries were answered from the baked grid and how many fell back to traces."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+		{
+			const UTerrainHeightSubsystem* Terrain = World ? World->GetSubsystem<UTerrainHeightSubsystem>() : nullptr;
+			if (!Terrain)
+			{
+				return;
+			}
+
+			UE_LOG(LogTemp, Log, TEXT("[Terrain] baked: %s, grid samples: %d, fallback traces: %d"),
+				Terrain->IsBaked() ? TEXT("true") : TEXT("false"), Terrain->GetGridSampleCount(), Terrain->GetFallbackTraceCount());
+		}));
+#endif
@@ -7,6 +7,7 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Plugins/CosmeticDispatcher.h"
 #include "Structs/SessionInfomation.h"
 
 AArrow::AArrow()
@@ -129,7 +130,7 @@ void AArrow::MulticastPlayImpactEffects_Implementation(ECollisionChannel Collisi
 	{
 		FRotator SpawnRotation = GetActorRotation();
 		SpawnRotation.Pitch += -180.f;
-		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), SelectedParticleSystem, FTransform(SpawnRotation, HitLocation, FVector(1)), true, EPSCPoolMethod::AutoRelease, true);
+		UCosmeticDispatcher::SpawnEmitterAtLocation(this, SelectedParticleSystem, FTransform(SpawnRotation, HitLocation, FVector(1)));
 	}
 }
 
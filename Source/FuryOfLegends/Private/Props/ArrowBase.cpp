@@ -9,7 +9,7 @@
 #include "Characters/AOSCharacterBase.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/Engine.h"
-#include "Engine/OverlapResult.h"
+#include "Plugins/GameplayQuery.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Game/ArenaGameState.h"
 
@@ -387,27 +387,15 @@ void AArrowBase::AttachToClosestBone(AActor* InTargetActor)
 TArray<AActor*> AArrowBase::DetectActorsInExplosionRadius()
 {
 	TArray<AActor*> AffectedActors;
-	TArray<FOverlapResult> OverlapResults;
-	FCollisionShape ExplosionSphere = FCollisionShape::MakeSphere(ArrowProperties.ExplosionRadius);
-	FCollisionQueryParams QueryParams;
-	QueryParams.AddIgnoredActor(this);
-
-	if (GetWorld()->OverlapMultiByChannel(OverlapResults, GetActorLocation(), FQuat::Identity, ECC_GameTraceChannel5, ExplosionSphere, QueryParams))
+	if (OwnerCharacter.IsValid() == false)
 	{
-		for (const FOverlapResult& Result : OverlapResults)
-		{
-			AActor* OverlappedActor = Result.GetActor();
-			if (OverlappedActor && OverlappedActor != GetOwner())
-			{
-				ACharacterBase* Character = Cast<ACharacterBase>(OverlappedActor);
-				if (Character && OwnerCharacter.IsValid() && OwnerCharacter->TeamSide != Character->TeamSide)
-				{
-					AffectedActors.Add(OverlappedActor);
-				}
-			}
-		}
+		return AffectedActors;
 	}
 
+	TArray<ACharacterBase*> Characters;
+	GameplayQuery::Overlap(GetWorld(), FGameplayQuery::Sphere(GetActorLocation(), ArrowProperties.ExplosionRadius, ECC_GameTraceChannel5).EnemiesOf(OwnerCharacter->TeamSide).Ignore(this).Ignore(GetOwner()), Characters);
+
+	AffectedActors.Append(Characters);
 	return AffectedActors;
 }
 
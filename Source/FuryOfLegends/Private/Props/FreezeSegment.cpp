@@ -6,6 +6,8 @@
 #include "Characters/AOSCharacterBase.h"
 #include "Components/BoxComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Plugins/CosmeticDispatcher.h"
+#include "Game/DebugOverlaySubsystem.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/Engine.h"
@@ -188,7 +190,7 @@ void AFreezeSegment::MulticastPlayParticles_Implementation(const TArray<FVector>
 				return;
 			}
 
-			UParticleSystemComponent* PSC = UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), FreezeSegment, SpawnLocations[Iterator], SpawnRotations[Iterator], FVector(Scale), true, EPSCPoolMethod::AutoRelease, false);
+			UParticleSystemComponent* PSC = UCosmeticDispatcher::SpawnEmitterAtLocation(this, FreezeSegment, FTransform(SpawnRotations[Iterator], SpawnLocations[Iterator], FVector(Scale)), true, EPSCPoolMethod::AutoRelease, false);
 			if (PSC)
 			{
 				PSC->SetFloatParameter(FName("AbilityDuration"), (NumParicles - Iterator - 1) * Rate + Lifetime);
@@ -218,7 +220,7 @@ void AFreezeSegment::OnBeginOverlap(UPrimitiveComponent* OverlappedComponent, AA
 		return;
 	}
 
-	UKismetSystemLibrary::PrintString(GetWorld(), FString::Printf(TEXT("AFreezeSegment OnBeginOverlap: %s"), *OtherActor->GetName()), true, true, FLinearColor::Red, 2.0f);
+	ARENA_DEBUG_TEXT(this, EDebugOverlayCategory::Combat, 2.f, TEXT("AFreezeSegment OnBeginOverlap: %s"), *GetNameSafe(OtherActor));
 
 	if (ProcessedActors.Contains(OtherActor))
 	{
@@ -11,6 +11,8 @@
 #include "Components/CapsuleComponent.h"
 #include "Components/StatComponent.h"
 #include "Components/ActionStatComponent.h"
+#include "Components/StructureTargetingComponent.h"
+#include "Components/CosmeticAnimationComponent.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/PointLightComponent.h"
 #include "Camera/CameraComponent.h"
@@ -32,7 +34,7 @@
 ANexus::ANexus()
 {
 	bReplicates = true;
-	PrimaryActorTick.bCanEverTick = true;;
+	PrimaryActorTick.bCanEverTick = false;
 
 	DefaultRootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("DefaultRootComponent"));
 	RootComponent = DefaultRootComponent;
@@ -112,6 +114,9 @@ ANexus::ANexus()
 	DetectionBox->SetBoxExtent(FVector(1000, 1000, 1000));
 	DetectionBox->SetCollisionProfileName(FName(TEXT("NoCollision")));
 
+	TargetingComponent = CreateDefaultSubobject<UStructureTargetingComponent>(TEXT("TargetingComponent"));
+	CosmeticComponent = CreateDefaultSubobject<UCosmeticAnimationComponent>(TEXT("CosmeticComponent"));
+
 	UCapsuleComponent* CapsuleCollision = GetCapsuleComponent();
 	if (CapsuleCollision)
 	{
@@ -159,9 +164,6 @@ ANexus::ANexus()
 	PrimaryRotation = FRotator(66, 0, 48);
 	SecondaryRotation = FRotator(30, 8, -66);
 
-	EnemiesInRange.Empty();
-	AlliesInRange.Empty();
-
 	CoreEmissionColor = FLinearColor(187.f / 255.f, 43.f / 255.f, 7.f / 255.f);
 	CorePrimartColor = FLinearColor(209.f / 255.f, 50.f / 255.f, 35.f / 255.f);
 	CoreSecondaryColor = FLinearColor(255.f / 255.f, 118.f / 255.f, 19.f / 255.f);
@@ -294,30 +296,6 @@ void ANexus::SetAssetsFromResource()
 }
 
 
-void ANexus::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (Ring_A)
-	{
-		//Ring_A->AddLocalRotation(RotationSpeed * DeltaTime);
-		ApplyDynamicRotation(DeltaTime);
-	}
-
-	if (::IsValid(TargetCharacter))
-	{
-		FVector TargetLocation = TargetCharacter->GetActorLocation();
-		TargetBeamParticleSystem->SetVectorParameter(FName("BeamEnd"), TargetLocation);
-	}
-}
-
-void ANexus::ApplyDynamicRotation(float DeltaTime)
-{
-	Ring_A->AddLocalRotation(PrimaryRotation * DeltaTime);
-	Ring_B->AddLocalRotation(SecondaryRotation * DeltaTime);
-}
-
-
 void ANexus::PostInitializeComponents()	
 {
 	Super::PostInitializeComponents();
@@ -385,12 +363,21 @@ void ANexus::BeginPlay()
 		CapsuleCollision->SetGenerateOverlapEvents(true);
 	}
 
+	// 링 회전과 빔 끝점은 화면에만 보이는 연출이므로 서버 틱 대신 클라이언트 전용 컴포넌트가 처리합니다.
+	if (GetNetMode() != NM_DedicatedServer)
+	{
+		CosmeticComponent->AddRotator(Ring_A, PrimaryRotation);
+		CosmeticComponent->AddRotator(Ring_B, SecondaryRotation);
+		CosmeticComponent->AddParticleTracker(TargetBeamParticleSystem, FName("BeamEnd"), [this]() -> AActor* { return TargetCharacter; });
+	}
+
 	if (HasAuthority())
 	{
 		DetectionBox->SetCollisionProfileName(FName("Trigger"));
 		DetectionBox->SetGenerateOverlapEvents(true);
 		DetectionBox->OnComponentBeginOverlap.AddDynamic(this, &ANexus::OnCharacterEnterRange);
 		DetectionBox->OnComponentEndOverlap.AddDynamic(this, &ANexus::OnCharacterExitRange);
+		TargetingComponent->OnAggroTargetRequested.AddUObject(this, &ANexus::OnAggroTargetRequested);
 
 		const FNexusDataRow* NexusDataRow = NexusDataTable->FindRow<FNexusDataRow>(FName(TEXT("1")), TEXT(""));
 		if (!NexusDataRow)
@@ -413,8 +400,7 @@ void ANexus::BeginPlay()
 
 /**
  * ANexus::OnCharacterEnterRange - 사거리 내에 캐릭터가 진입했을 때 호출되는 함수입니다.
- * - 캐릭터가 아군인지 적군인지 확인하고, 각각 AlliesInRange 또는 EnemiesInRange 목록에 추가합니다.
- * - 아군이 플레이어일 경우, 공격받았을 때 타워가 반응하도록 OnPostReceiveDamageEvent 델리게이트를 바인딩합니다.
+ * - 캐릭터를 TargetingComponent 에 등록합니다. 적은 우선순위 버킷에, 아군 플레이어는 피격 감시 목록에 들어갑니다.
  * - 첫 번째 적군이 범위에 진입했을 때 LMB 공격을 시작하여 타겟팅 효과를 활성화합니다.
  *
  *  주요 기능:
@@ -445,26 +431,16 @@ void ANexus::OnCharacterEnterRange(UPrimitiveComponent* OverlappedComponent, AAc
 		return;
 	}
 
-	if (Character->TeamSide == TeamSide)
+	if (TargetingComponent->AddCharacter(Character) == false)
 	{
-		AlliesInRange.Add(Character);
-
-		if (EnumHasAnyFlags(Character->ObjectType, EObjectType::Player))
-		{
-			Character->OnPostReceiveDamageEvent.AddDynamic(this, &ANexus::OnAllyAttacked);
-		}
 		return;
 	}
-	else
-	{
-		EnemiesInRange.Add(Character);
-	}
 
 	BindNexusInfoToHUD(Character);
 
-	if (EnemiesInRange.Num() == 1)
+	if (::IsValid(TargetCharacter) == false)
 	{
-		TargetCharacter = Character;
+		TargetCharacter = SelectPriorityTarget();
 		LMB_Started();
 	}
 }
@@ -473,8 +449,8 @@ void ANexus::OnCharacterEnterRange(UPrimitiveComponent* OverlappedComponent, AAc
 
 /**
  * ANexus::OnCharacterExitRange - 사거리에서 캐릭터가 벗어났을 때 호출되는 함수입니다.
- * - 벗어난 캐릭터가 아군인지 적군인지 확인하여 AlliesInRange 또는 EnemiesInRange 목록에서 제거합니다.
- * - 아군 플레이어인 경우 데미지 이벤트 바인딩을 해제하고, 타겟 캐릭터가 범위를 벗어났을 경우 새로운 타겟을 설정합니다.
+ * - 벗어난 캐릭터를 TargetingComponent 에서 제거합니다. 아군 플레이어의 피격 감시도 함께 해제됩니다.
+ * - 타겟 캐릭터가 범위를 벗어났을 경우 새로운 타겟을 설정합니다.
  * - 타겟 캐릭터가 사거리 밖으로 나가면 타겟팅 효과를 비활성화하고 타이머를 정지합니다.
  *
  *  주요 기능:
@@ -504,17 +480,10 @@ void ANexus::OnCharacterExitRange(UPrimitiveComponent* OverlappedComp, AActor* O
 	//UKismetSystemLibrary::PrintString(GetWorld(), FString::Printf(TEXT("Character Exited: %s"), *Character->GetName()), true, true, FLinearColor::Red, 2.0f);
 
 	// 범위를 벗어난 캐릭터 제거
-	AlliesInRange.Remove(Character);
-	EnemiesInRange.Remove(Character);
+	TargetingComponent->RemoveCharacter(Character);
 
-	// 플레이어의 데미지 이벤트 제거
 	if (EnumHasAnyFlags(Character->ObjectType, EObjectType::Player))
 	{
-		if (Character->TeamSide == TeamSide)
-		{
-			Character->OnPostReceiveDamageEvent.RemoveDynamic(this, &ANexus::OnAllyAttacked);
-		}
-
 		RmoveBindNexusInfoToHUD(Character);
 	}
 
@@ -533,7 +502,7 @@ void ANexus::OnCharacterExitRange(UPrimitiveComponent* OverlappedComp, AActor* O
 	}
 
 	// 새로운 타겟 캐릭터를 선택
-	if (!TargetCharacter && EnemiesInRange.Num() > 0)
+	if (!TargetCharacter && TargetingComponent->GetNumEnemies() > 0)
 	{
 		TargetCharacter = SelectPriorityTarget();
 		LMB_Started();
@@ -710,9 +679,9 @@ void ANexus::LMB_Executed()
 	AProjectile* Projectile = Cast<AProjectile>(UGameplayStatics::BeginDeferredActorSpawnFromClass(GetWorld(), ProjectileClass, Transform, ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn, this));
 	if (Projectile != nullptr)
 	{
-		const float HomingAcceleration = GetUniqueAttribute(EActionSlot::LMB, TEXT("HomingAcceleration"), 0.0f);
-		const float InitialSpeed = GetUniqueAttribute(EActionSlot::LMB, TEXT("InitialSpeed"), 2000.f);
-		const float MaxSpeed = GetUniqueAttribute(EActionSlot::LMB, TEXT("MaxSpeed"), 0.0f);
+		const float HomingAcceleration = GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::HomingAcceleration, 0.0f);
+		const float InitialSpeed = GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::InitialSpeed, 2000.f);
+		const float MaxSpeed = GetUniqueAttribute(EActionSlot::LMB, EUniqueAttribute::MaxSpeed, 0.0f);
 
 		// 투사체의 타겟 및 이동 속성 설정
 		Projectile->TargetActor = TargetCharacter;
@@ -750,7 +719,7 @@ void ANexus::OnCooldownTimeChanged(EActionSlot SlotID, float CurrentCooldownTime
 	{
 		EnumRemoveFlags(CharacterState, ECharacterState::LMB);
 
-		if (EnemiesInRange.Find(TargetCharacter) != INDEX_NONE)
+		if (TargetingComponent->IsEnemyInRange(TargetCharacter))
 		{
 			Count++;
 			LMB_Started();
@@ -768,60 +737,28 @@ void ANexus::OnCooldownTimeChanged(EActionSlot SlotID, float CurrentCooldownTime
 
 
 /**
- * ANexus::OnAllyAttacked - 아군이 공격받았을 때 호출되는 함수입니다.
- * - 공격받은 아군과 공격한 적이 범위 내에 존재하는지 확인 후, 조건이 맞으면 해당 적을 새로운 타겟으로 설정합니다.
- * - 타겟팅 타이머가 비활성화 상태일 경우, 새로운 타겟에 대한 공격을 시작합니다.
- *
- * 주요 기능:
- * 1. 공격받은 아군 및 공격자 유효성 검사 및 캐스팅
- * 2. 아군과 적이 범위 내에 있는지 확인
- * 3. 조건에 맞으면 타겟팅을 갱신하고 공격 시작
+ * ANexus::OnAggroTargetRequested - 사거리 내 아군 챔피언을 사거리 내 적 챔피언이 공격했을 때 TargetingComponent 가 호출합니다.
+ * - 진행 중인 타겟팅 타이머를 정리하고, 공격자를 새로운 타겟으로 설정해 공격을 시작합니다.
  *
- * @param DamageReceiver 공격을 받은 캐릭터 (아군)
- * @param DamageCauser 공격을 가한 캐릭터 (적군)
- * @param InstigatorActor 공격을 유발한 컨트롤러
- * @param DamageInformation 데미지 정보
+ * @param Attacker 아군을 공격한 적 챔피언
  */
-void ANexus::OnAllyAttacked(AActor* DamageReceiver, AActor* DamageCauser, AController* InstigatorActor, FDamageInformation& DamageInformation)
+void ANexus::OnAggroTargetRequested(ACharacterBase* Attacker)
 {
 	UWorld* World = GetWorld();
-	if (!World)
+	if (!World || ::IsValid(Attacker) == false)
 	{
 		return;
 	}
 
-	ACharacterBase* Ally = Cast<ACharacterBase>(DamageReceiver);
-	if (!Ally)
-	{
-		return;
-	}
-
-	ACharacterBase* Enemy = Cast<ACharacterBase>(DamageCauser);
-	if (!Enemy)
-	{
-		return;
-	}
-
-	// 아군 및 적군이 사거리 내에 존재하는지 확인
-	if (AlliesInRange.Find(Ally) == INDEX_NONE || EnemiesInRange.Find(Enemy) == INDEX_NONE)
+	// 타겟팅 타이머 활성화 상태 확인
+	if (World->GetTimerManager().IsTimerActive(TargetingTimerHandle))
 	{
-		return;
+		World->GetTimerManager().ClearTimer(TargetingTimerHandle);
 	}
 
-	// 아군과 적군이 모두 플레이어일 경우 타겟팅 설정
-	if (Ally->ObjectType == EObjectType::Player && Enemy->ObjectType == EObjectType::Player)
-	{
-		// 타겟팅 타이머 활성화 상태 확인
-		bool IsTimerActive = World->GetTimerManager().IsTimerActive(TargetingTimerHandle);
-		if (IsTimerActive)
-		{
-			World->GetTimerManager().ClearTimer(TargetingTimerHandle);
-		}
-
-		// 새로운 타겟 설정
-		MulticastSetTargetCharacter(Enemy);
-		LMB_Started();
-	}
+	// 새로운 타겟 설정
+	MulticastSetTargetCharacter(Attacker);
+	LMB_Started();
 }
 
 
@@ -869,78 +806,14 @@ void ANexus::MulticastActivateTargetEffect_Implementation(bool bActivation)
 
 /**
  * ANexus::SelectPriorityTarget - 사거리 내에서 우선순위에 따라 타겟을 선택하는 함수입니다.
- * - Super 미니언 > Melee 미니언 > Ranged 미니언 > 플레이어 순으로 우선순위를 두고 타겟을 설정합니다.
- * - 각 우선순위 카테고리 내에서 랜덤으로 타겟을 선택하여 타워의 공격을 목표로 삼습니다.
- *
- * 주요 기능:
- * 1. EnemiesInRange 배열을 순회하여 적을 분류 (Super, Melee, Ranged Minions 및 Players)
- * 2. 우선순위에 따라 첫 번째로 등장한 적군을 선택
- * 3. 우선순위별 카테고리 내에서 랜덤으로 적군 선택
+ * - Super 미니언 > Melee 미니언 > Ranged 미니언 > 플레이어 순으로 우선순위를 둡니다.
+ * - 같은 우선순위 안에서는 먼저 사거리에 들어온 가까운 적부터 선택합니다. 분류와 정렬은 TargetingComponent 가 진입 시점에 끝내 둡니다.
  *
  * @return 선택된 ACharacterBase* 타겟
  */
 ACharacterBase* ANexus::SelectPriorityTarget()
 {
-	ACharacterBase* SelectedTarget = nullptr;
-	TArray<ACharacterBase*> SuperMinions;
-	TArray<ACharacterBase*> MeleeMinions;
-	TArray<ACharacterBase*> RangedMinions;
-	TArray<ACharacterBase*> Players;
-
-	// 사거리 내 적을 순회하여 각 카테고리에 추가
-	for (ACharacterBase* Enemy : EnemiesInRange)
-	{
-		if (!::IsValid(Enemy))
-		{
-			continue;
-		}
-
-		// 미니언 타입 분류: Super, Melee, Ranged
-		if (EnumHasAnyFlags(Enemy->ObjectType, EObjectType::Minion))
-		{
-			AMinionBase* Minion = Cast<AMinionBase>(Enemy);
-			if (Minion)
-			{
-				if (Minion->GetCharacterName().IsEqual(TEXT("Super")))
-				{
-					SuperMinions.Add(Minion);
-				}
-				else if (Minion->GetCharacterName().IsEqual(TEXT("Melee")))
-				{
-					MeleeMinions.Add(Minion);
-				}
-				else if (Minion->GetCharacterName().IsEqual(TEXT("Ranged")))
-				{
-					RangedMinions.Add(Minion);
-				}
-			}
-		}
-		// 플레이어 캐릭터 분류
-		else if (EnumHasAnyFlags(Enemy->ObjectType, EObjectType::Player))
-		{
-			Players.Add(Enemy);
-		}
-	}
-
-	// 우선순위에 따라 타겟 설정
-	if (SuperMinions.Num() > 0)
-	{
-		SelectedTarget = SuperMinions[FMath::RandRange(0, SuperMinions.Num() - 1)];
-	}
-	else if (MeleeMinions.Num() > 0)
-	{
-		SelectedTarget = MeleeMinions[FMath::RandRange(0, MeleeMinions.Num() - 1)];
-	}
-	else if (RangedMinions.Num() > 0)
-	{
-		SelectedTarget = RangedMinions[FMath::RandRange(0, RangedMinions.Num() - 1)];
-	}
-	else if (Players.Num() > 0)
-	{
-		SelectedTarget = Players[FMath::RandRange(0, Players.Num() - 1)];
-	}
-
-	return SelectedTarget;
+	return TargetingComponent->SelectTarget();
 }
 
 
@@ -970,6 +843,7 @@ void ANexus::OnCharacterDeath()
 	}
 
 	EnumAddFlags(CharacterState, ECharacterState::Death);
+	TargetingComponent->Reset();
 
 	UCapsuleComponent* CapsuleCollision = GetCapsuleComponent();
 	if (CapsuleCollision)
@@ -979,7 +853,7 @@ void ANexus::OnCharacterDeath()
 	
 	DetectionBox->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-	SetActorTickEnabled(false);
+	CosmeticComponent->StopAll();
 	if (World->GetTimerManager().IsTimerActive(TargetingTimerHandle))
 	{
 		World->GetTimerManager().ClearTimer(TargetingTimerHandle);
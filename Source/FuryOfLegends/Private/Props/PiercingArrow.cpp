@@ -8,6 +8,7 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Plugins/CosmeticDispatcher.h"
 #include "Structs/SessionInfomation.h"
 
 APiercingArrow::APiercingArrow()
@@ -130,7 +131,7 @@ void APiercingArrow::MulticastPlayImpactEffects_Implementation(ECollisionChannel
 	{
 		FRotator SpawnRotation = GetActorRotation();
 		SpawnRotation.Pitch += -180.f;
-		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), SelectedParticleSystem, FTransform(SpawnRotation, HitLocation, FVector(1)), true, EPSCPoolMethod::AutoRelease, true);
+		UCosmeticDispatcher::SpawnEmitterAtLocation(this, SelectedParticleSystem, FTransform(SpawnRotation, HitLocation, FVector(1)));
 	}
 }
 
@@ -11,7 +11,8 @@
 
 ASplineActor::ASplineActor()
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// 펼쳐지는 과정은 SplineUpdateTimer 가 처리하므로 액터 틱이 필요 없습니다.
+	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 	bAlwaysRelevant = true;
 	bNetLoadOnClient = true;
@@ -216,78 +217,6 @@ void ASplineActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 }
 
 
-void ASplineActor::Tick(float DeltaSeconds)
-{
-	Super::Tick(DeltaSeconds);
-
-
-	/*
-	if (!bIsBeginState || !bIsInitialized)
-	{
-		return;
-	}
-	
-	if (SplineLength <= 0.f || SegmentLength <= 0.f)
-	{
-		bIsBeginState = false;
-		return;
-	}
-
-	// 시간 업데이트
-	ElapsedTime += DeltaSeconds;
-
-	if (ElapsedTime >= Duration)
-	{
-		ElapsedTime = Duration;
-		DistanceAlongSpline = SplineLength;
-		GetWorld()->GetTimerManager().ClearTimer(SplineUpdateTimer);
-	}
-	else
-	{
-		const float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-		DistanceAlongSpline = FMath::Lerp(0.0f, SplineLength, Alpha);
-	}
-
-	// 현재 활성화해야 하는 메시 개수 계산
-	int32 ActiveMeshCount = FMath::Clamp(FMath::CeilToInt(DistanceAlongSpline / SegmentLength), 0, SplineMeshes.Num());
-
-	// 활성화된 메시 개수만큼만 업데이트하여 점진적으로 생성
-	for (int32 i = 0; i < ActiveMeshCount; ++i)
-	{
-		if (!SplineMeshes.IsValidIndex(i))
-		{
-			UE_LOG(LogTemp, Warning, TEXT("[%s] Invalid Mesh Index: %d. Max: %d"), ANSI_TO_TCHAR(__FUNCTION__), i, SplineMeshes.Num());
-			continue;
-		}
-
-		USplineMeshComponent* SplineMeshComponent = SplineMeshes[i];
-		if (!::IsValid(SplineMeshComponent))
-		{
-			UE_LOG(LogTemp, Error, TEXT("[%s] SplineMeshComponent is null at index %d."), ANSI_TO_TCHAR(__FUNCTION__), i);
-			continue;
-		}
-
-		// 시작 및 끝 위치 설정
-		FVector StartLocation = SplineComponent->GetLocationAtDistanceAlongSpline(i * SegmentLength, ESplineCoordinateSpace::Local);
-		FVector StartTangent = SplineComponent->GetTangentAtDistanceAlongSpline(i * SegmentLength, ESplineCoordinateSpace::Local);
-		FVector EndLocation = SplineComponent->GetLocationAtDistanceAlongSpline((i + 1) * SegmentLength, ESplineCoordinateSpace::Local);
-		FVector EndTangent = SplineComponent->GetTangentAtDistanceAlongSpline((i + 1) * SegmentLength, ESplineCoordinateSpace::Local);
-
-		// 스플라인 메시 업데이트
-		SplineMeshComponent->SetStartAndEnd(StartLocation, StartTangent, EndLocation, EndTangent, true);
-
-		// 메시 활성화 (처음 활성화될 때만)
-		if (!SplineMeshComponent->IsVisible())
-		{
-			SplineMeshComponent->SetCollisionProfileName("BlockAllDynamic");
-			SplineMeshComponent->SetVisibility(true);
-			SplineMeshComponent->UpdateOverlaps();
-		}
-	}*/
-}
-
-
-
 void ASplineActor::ExpandSpline()
 {
 	if (!bIsInitialized || !bIsBeginState)
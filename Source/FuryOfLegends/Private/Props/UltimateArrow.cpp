@@ -8,9 +8,10 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Structs/CharacterData.h"
 #include "GameFramework/ProjectileMovementComponent.h"
-#include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
-#include "Engine/OverlapResult.h"
+#include "Plugins/CosmeticDispatcher.h"
+#include "Plugins/GameplayQuery.h"
+#include "Game/DebugOverlaySubsystem.h"
 
 AUltimateArrow::AUltimateArrow()
 {
@@ -89,35 +90,12 @@ void AUltimateArrow::OnHitCharacter(const FHitResult& HitResult)
 	StopArrow();
 	MulticastPlayImpactEffects(CollisionChannel, HitResult.Location);
 
-	FCollisionQueryParams params;
-	params.TraceTag = FName("Name_None");
-	params.bTraceComplex = false;
-	params.AddIgnoredActor(this);
-
-	TArray<FOverlapResult> OutHits;
-	bool bResult = GetWorld()->OverlapMultiByChannel(
-		OutHits,
-		GetActorLocation(),
-		FQuat::Identity,
-		ArrowProperties.Detection,
-		FCollisionShape::MakeSphere(ArrowProperties.ExplosionRadius),
-		params
-	);
-
-	for (const auto& OutHit : OutHits)
-	{
-		ACharacterBase* OverlapCharacter = Cast<ACharacterBase>(OutHit.GetActor());
-		if (::IsValid(OverlapCharacter) == false)
-		{
-			continue;
-		}
+	TArray<ACharacterBase*> OverlapCharacters;
+	GameplayQuery::Overlap(GetWorld(), FGameplayQuery::Sphere(GetActorLocation(), ArrowProperties.ExplosionRadius, ArrowProperties.Detection).EnemiesOf(TeamSide).Ignore(this), OverlapCharacters);
 
-		if (OverlapCharacter->TeamSide == TeamSide)
-		{
-			continue;
-		}
-
-		UKismetSystemLibrary::PrintString(GetWorld(), FString::Printf(TEXT("Overlapped Actor: %s"), *OverlapCharacter->GetName()), true, true, FLinearColor::Red, 2.0f, NAME_None);
+	for (ACharacterBase* OverlapCharacter : OverlapCharacters)
+	{
+		ARENA_DEBUG_TEXT(this, EDebugOverlayCategory::Combat, 2.f, TEXT("Overlapped Actor: %s"), *OverlapCharacter->GetName());
 		ApplyDamage(OverlapCharacter);
 	}
 }
@@ -148,7 +126,7 @@ void AUltimateArrow::MulticastPlayImpactEffects_Implementation(ECollisionChannel
 	{
 		FRotator SpawnRotation = GetActorRotation();
 		SpawnRotation.Pitch += -180.f;
-		UGameplayStatics::SpawnEmitterAtLocation(GetWorld(), SelectedParticleSystem, FTransform(SpawnRotation, HitLocation, FVector(1)), true, EPSCPoolMethod::AutoRelease, true);
+		UCosmeticDispatcher::SpawnEmitterAtLocation(this, SelectedParticleSystem, FTransform(SpawnRotation, HitLocation, FVector(1)));
 	}
 }
 
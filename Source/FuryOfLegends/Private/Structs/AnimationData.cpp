@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Structs/AnimationData.h"
+#include "Characters/CharacterBase.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+
+void FCharacterAnimSnapshot::Capture(const ACharacterBase& Character)
+{
+	const UCharacterMovementComponent* MovementComponent = Character.GetCharacterMovement();
+	bIsValid = ::IsValid(MovementComponent);
+	if (bIsValid == false)
+	{
+		return;
+	}
+
+	WorldLocation = Character.GetActorLocation();
+	WorldRotation = Character.GetActorRotation();
+	BaseAimRotation = Character.GetBaseAimRotation();
+
+	Velocity = MovementComponent->Velocity;
+	LastUpdateVelocity = MovementComponent->GetLastUpdateVelocity();
+	Acceleration = MovementComponent->GetCurrentAcceleration();
+	bIsFalling = MovementComponent->IsFalling();
+
+	CharacterState = Character.CharacterState;
+}
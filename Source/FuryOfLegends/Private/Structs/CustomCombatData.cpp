@@ -2,4 +2,299 @@
 
 
 #include "Structs/CustomCombatData.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
+#include "HAL/IConsoleManager.h"
 
+
+namespace CombatNetSerialization
+{
+	constexpr float DamageScale = 10.f;		// 0.1
+	constexpr float DurationScale = 100.f;	// 0.01초
+	constexpr float PercentScale = 1000.f;	// 0.001
+
+	constexpr int32 ActionSlotBits = 7;
+	constexpr int32 DamageTypeBits = 4;
+	constexpr int32 AttackTriggerBits = 3;
+	constexpr int32 CrowdControlTypeBits = 8;
+	constexpr int32 CrowdControlCountBits = 4;
+	constexpr uint32 MaxCrowdControls = (1u << CrowdControlCountBits) - 1;
+
+	// 부호 있는 양자화 값을 zigzag 로 바꿔 가변 길이 정수로 직렬화합니다.
+	void SerializeQuantized(FArchive& Ar, float& Value, float Scale)
+	{
+		uint32 Packed = 0;
+		if (Ar.IsSaving())
+		{
+			const int32 Quantized = FMath::RoundToInt(Value * Scale);
+			Packed = (static_cast<uint32>(Quantized) << 1) ^ static_cast<uint32>(Quantized >> 31);
+		}
+
+		Ar.SerializeIntPacked(Packed);
+
+		if (Ar.IsLoading())
+		{
+			const int32 Quantized = static_cast<int32>(Packed >> 1) ^ -static_cast<int32>(Packed & 1);
+			Value = Quantized / Scale;
+		}
+	}
+
+	// 0 이면 1비트만 보냅니다.
+	void SerializeOptionalQuantized(FArchive& Ar, float& Value, float Scale)
+	{
+		uint8 bHasValue = Ar.IsSaving() && FMath::RoundToInt(Value * Scale) != 0;
+		Ar.SerializeBits(&bHasValue, 1);
+
+		if (bHasValue)
+		{
+			SerializeQuantized(Ar, Value, Scale);
+		}
+		else if (Ar.IsLoading())
+		{
+			Value = 0.f;
+		}
+	}
+
+	template<typename TEnum>
+	void SerializeFlags(FArchive& Ar, TEnum& Flags, int32 NumBits)
+	{
+		const uint32 Mask = (1u << NumBits) - 1;
+
+		uint32 Bits = 0;
+		if (Ar.IsSaving())
+		{
+			Bits = static_cast<uint32>(Flags);
+			ensureMsgf((Bits & ~Mask) == 0, TEXT("Flag value 0x%x does not fit in %d bits"), Bits, NumBits);
+		}
+
+		Ar.SerializeBits(&Bits, NumBits);
+
+		if (Ar.IsLoading())
+		{
+			Flags = static_cast<TEnum>(Bits & Mask);
+		}
+	}
+}
+
+
+/** --------------------------------------------------------------------------------
+ * FCrowdControlInformation
+ */
+
+bool FCrowdControlInformation::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	NetSerializeDelta(Ar, nullptr);
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+void FCrowdControlInformation::NetSerializeDelta(FArchive& Ar, const FCrowdControlInformation* PreviousEntry)
+{
+	using namespace CombatNetSerialization;
+
+	// 대부분 CC 는 한 종류이므로 비트 위치(3비트)만 보냅니다.
+	const uint32 TypeBits = static_cast<uint32>(Type);
+	uint8 bSingleType = Ar.IsSaving() && FMath::IsPowerOfTwo(TypeBits) && TypeBits < (1u << CrowdControlTypeBits);
+	Ar.SerializeBits(&bSingleType, 1);
+
+	if (bSingleType)
+	{
+		uint32 TypeIndex = Ar.IsSaving() ? FMath::FloorLog2(TypeBits) : 0;
+		Ar.SerializeBits(&TypeIndex, 3);
+
+		if (Ar.IsLoading())
+		{
+			Type = static_cast<ECrowdControl>(1u << (TypeIndex & 0x7));
+		}
+	}
+	else
+	{
+		SerializeFlags(Ar, Type, CrowdControlTypeBits);
+	}
+
+	// 이전 항목과 같은 값은 1비트로 생략합니다.
+	uint8 bSameDuration = Ar.IsSaving() && PreviousEntry && FMath::RoundToInt(Duration * DurationScale) == FMath::RoundToInt(PreviousEntry->Duration * DurationScale);
+	Ar.SerializeBits(&bSameDuration, 1);
+	if (bSameDuration)
+	{
+		if (Ar.IsLoading())
+		{
+			Duration = PreviousEntry ? PreviousEntry->Duration : 0.f;
+		}
+	}
+	else
+	{
+		SerializeQuantized(Ar, Duration, DurationScale);
+	}
+
+	uint8 bSamePercent = Ar.IsSaving() && PreviousEntry && FMath::RoundToInt(Percent * PercentScale) == FMath::RoundToInt(PreviousEntry->Percent * PercentScale);
+	Ar.SerializeBits(&bSamePercent, 1);
+	if (bSamePercent)
+	{
+		if (Ar.IsLoading())
+		{
+			Percent = PreviousEntry ? PreviousEntry->Percent : 0.f;
+		}
+	}
+	else
+	{
+		SerializeQuantized(Ar, Percent, PercentScale);
+	}
+}
+
+
+/** --------------------------------------------------------------------------------
+ * FDamageInformation
+ */
+
+bool FDamageInformation::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace CombatNetSerialization;
+
+	SerializeFlags(Ar, ActionSlot, ActionSlotBits);
+	SerializeFlags(Ar, DamageType, DamageTypeBits);
+	SerializeFlags(Ar, AttackTrigger, AttackTriggerBits);
+
+	SerializeOptionalQuantized(Ar, PhysicalDamage, DamageScale);
+	SerializeOptionalQuantized(Ar, MagicDamage, DamageScale);
+	SerializeOptionalQuantized(Ar, TrueDamage, DamageScale);
+
+	uint32 NumCrowdControls = 0;
+	if (Ar.IsSaving())
+	{
+		if (static_cast<uint32>(CrowdControls.Num()) > MaxCrowdControls)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Too many crowd controls (%d). Only the first %u are sent."), ANSI_TO_TCHAR(__FUNCTION__), CrowdControls.Num(), MaxCrowdControls);
+		}
+		NumCrowdControls = FMath::Min<uint32>(CrowdControls.Num(), MaxCrowdControls);
+	}
+
+	Ar.SerializeBits(&NumCrowdControls, CrowdControlCountBits);
+
+	if (Ar.IsLoading())
+	{
+		CrowdControls.SetNum(NumCrowdControls & MaxCrowdControls);
+	}
+
+	for (uint32 Index = 0; Index < NumCrowdControls; ++Index)
+	{
+		CrowdControls[Index].NetSerializeDelta(Ar, Index > 0 ? &CrowdControls[Index - 1] : nullptr);
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+
+/** --------------------------------------------------------------------------------
+ * Arena.Net.DamagePayloadReport
+ * 대표적인 피격 페이로드를 기본 프로퍼티 레이아웃과 압축 직렬화로 각각 써 보고 크기와 양자화 오차를 출력합니다.
+ */
+
+#if !UE_BUILD_SHIPPING
+namespace CombatNetSerialization
+{
+	// FRepLayout 이 RPC 구조체 인자를 프로퍼티 단위로 쓰는 방식을 흉내냅니다. (배열 길이 16비트 + 요소별 프로퍼티)
+	void SerializeDefaultLayout(FArchive& Ar, const UStruct* Struct, void* Data)
+	{
+		for (TFieldIterator<FProperty> It(Struct); It; ++It)
+		{
+			for (int32 ArrayIndex = 0; ArrayIndex < It->ArrayDim; ++ArrayIndex)
+			{
+				void* PropertyData = It->ContainerPtrToValuePtr<void>(Data, ArrayIndex);
+
+				if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(*It))
+				{
+					FScriptArrayHelper Helper(ArrayProperty, PropertyData);
+					uint16 ArrayNum = static_cast<uint16>(Helper.Num());
+					Ar << ArrayNum;
+
+					const FStructProperty* InnerStruct = CastField<FStructProperty>(ArrayProperty->Inner);
+					for (int32 ElementIndex = 0; ElementIndex < Helper.Num(); ++ElementIndex)
+					{
+						if (InnerStruct)
+						{
+							SerializeDefaultLayout(Ar, InnerStruct->Struct, Helper.GetRawPtr(ElementIndex));
+						}
+						else
+						{
+							ArrayProperty->Inner->NetSerializeItem(Ar, nullptr, Helper.GetRawPtr(ElementIndex));
+						}
+					}
+				}
+				else
+				{
+					It->NetSerializeItem(Ar, nullptr, PropertyData);
+				}
+			}
+		}
+	}
+
+	void ReportDamagePayload(const TCHAR* Label, FDamageInformation Sample)
+	{
+		FBitWriter DefaultWriter(0, true);
+		SerializeDefaultLayout(DefaultWriter, FDamageInformation::StaticStruct(), &Sample);
+
+		FBitWriter CompactWriter(0, true);
+		bool bSuccess = false;
+		Sample.NetSerialize(CompactWriter, nullptr, bSuccess);
+
+		// 왕복 후 양자화 오차 확인
+		FBitReader Reader(CompactWriter.GetData(), CompactWriter.GetNumBits());
+		FDamageInformation Decoded;
+		Decoded.NetSerialize(Reader, nullptr, bSuccess);
+
+		float MaxError = FMath::Max3(
+			FMath::Abs(Decoded.PhysicalDamage - Sample.PhysicalDamage),
+			FMath::Abs(Decoded.MagicDamage - Sample.MagicDamage),
+			FMath::Abs(Decoded.TrueDamage - Sample.TrueDamage));
+
+		const bool bSameCount = Decoded.CrowdControls.Num() == Sample.CrowdControls.Num();
+		for (int32 Index = 0; bSameCount && Index < Sample.CrowdControls.Num(); ++Index)
+		{
+			MaxError = FMath::Max(MaxError, FMath::Abs(Decoded.CrowdControls[Index].Duration - Sample.CrowdControls[Index].Duration));
+			MaxError = FMath::Max(MaxError, FMath::Abs(Decoded.CrowdControls[Index].Percent - Sample.CrowdControls[Index].Percent));
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("[DamagePayload] %-24s default %3lld bits (%2lld bytes) -> compact %3lld bits (%2lld bytes), roundtrip %s, max error %.4f"),
+			Label,
+			DefaultWriter.GetNumBits(), DefaultWriter.GetNumBytes(),
+			CompactWriter.GetNumBits(), CompactWriter.GetNumBytes(),
+			(bSuccess && bSameCount && Decoded.DamageType == Sample.DamageType && Decoded.AttackTrigger == Sample.AttackTrigger && Decoded.ActionSlot == Sample.ActionSlot) ? TEXT("ok") : TEXT("FAILED"),
+			MaxError);
+	}
+
+	void RunDamagePayloadReport()
+	{
+		FDamageInformation BasicAttack;
+		BasicAttack.SetActionSlot(EActionSlot::LMB);
+		BasicAttack.AddTrigger(EAttackTrigger::OnHit);
+		BasicAttack.AddTrigger(EAttackTrigger::OnAttack);
+		BasicAttack.AddDamage(EDamageType::Physical, 64.3f);
+		ReportDamagePayload(TEXT("Basic attack"), BasicAttack);
+
+		FDamageInformation CriticalAttack = BasicAttack;
+		CriticalAttack.AddDamage(EDamageType::Critical, 112.5f);
+		ReportDamagePayload(TEXT("Critical attack"), CriticalAttack);
+
+		FDamageInformation SlowAbility;
+		SlowAbility.SetActionSlot(EActionSlot::R);
+		SlowAbility.AddTrigger(EAttackTrigger::AbilityEffects);
+		SlowAbility.AddDamage(EDamageType::Magic, 250.f);
+		SlowAbility.AddCrowdControl(FCrowdControlInformation(ECrowdControl::Slow, 1.5f, 20.f));
+		ReportDamagePayload(TEXT("Ability + slow"), SlowAbility);
+
+		FDamageInformation ShatterAbility = SlowAbility;
+		ShatterAbility.AddDamage(EDamageType::TrueDamage, 35.f);
+		ShatterAbility.AddCrowdControl(FCrowdControlInformation(ECrowdControl::Stun, 1.5f, 20.f));
+		ShatterAbility.AddCrowdControl(FCrowdControlInformation(ECrowdControl::Snare, 1.0f));
+		ReportDamagePayload(TEXT("Ability + 3 CC"), ShatterAbility);
+	}
+}
+
+static FAutoConsoleCommand DamagePayloadReportCommand(
+	TEXT("Arena.Net.DamagePayloadReport"),
+	TEXT("Logs the per-hit size of FDamageInformation with default property serialization and with the compact NetSerialize."),
+	FConsoleCommandDelegate::CreateStatic(&CombatNetSerialization::RunDamagePayloadReport));
+#endif
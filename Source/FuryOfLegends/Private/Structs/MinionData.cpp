@@ -3,3 +3,81 @@
 
 #include "Structs/MinionData.h"
 
+
+FMinionGrowthParameters FMinionGrowthParameters::FromUniqueAttributes(const TMap<FString, float>& UniqueAttributes)
+{
+	FMinionGrowthParameters Parameters;
+
+	auto ReadValue = [&UniqueAttributes](const TCHAR* Key, float& OutValue)
+		{
+			if (const float* Value = UniqueAttributes.Find(Key))
+			{
+				OutValue = *Value;
+			}
+		};
+
+	ReadValue(TEXT("HealthIncreaseAmount"), Parameters.HealthIncreaseAmount);
+	ReadValue(TEXT("AdditionalHealthAmount"), Parameters.AdditionalHealthAmount);
+	ReadValue(TEXT("AttackIncreaseAmount"), Parameters.AttackIncreaseAmount);
+	ReadValue(TEXT("StartIncreaseTime"), Parameters.StartIncreaseTime);
+	ReadValue(TEXT("IncreaseInterval"), Parameters.IncreaseInterval);
+	ReadValue(TEXT("MaxHealthLimit"), Parameters.MaxHealthLimit);
+
+	return Parameters;
+}
+
+int32 FMinionGrowthParameters::GetGrowthLevel(float ElapsedTime) const
+{
+	if (IncreaseInterval <= 0.f)
+	{
+		return 0;
+	}
+
+	const float TimeSinceStart = FMath::Max(0.0f, ElapsedTime - StartIncreaseTime);
+	return FMath::FloorToInt(TimeSinceStart / IncreaseInterval);
+}
+
+
+void FMinionGrowthTable::Initialize(const FStatTableRow& InBaseStats)
+{
+	BaseStats = InBaseStats;
+	Growth = FMinionGrowthParameters::FromUniqueAttributes(InBaseStats.UniqueAttributes);
+	WaveStats.Reset();
+}
+
+void FMinionGrowthTable::Bake(int32 NumWaves, float InFirstWaveTime, float InWaveInterval)
+{
+	FirstWaveTime = InFirstWaveTime;
+	WaveInterval = InWaveInterval;
+
+	WaveStats.SetNum(FMath::Max(NumWaves, 0) + 1);
+	for (int32 Wave = 0; Wave < WaveStats.Num(); ++Wave)
+	{
+		const float WaveTime = Wave > 0 ? FirstWaveTime + (Wave - 1) * WaveInterval : 0.f;
+		WaveStats[Wave] = EvaluateGrowthLevel(Growth.GetGrowthLevel(WaveTime));
+	}
+}
+
+FMinionWaveStats FMinionGrowthTable::EvaluateGrowthLevel(int32 GrowthLevel) const
+{
+	// 구간 i 의 체력 증가량은 HealthIncreaseAmount + i * AdditionalHealthAmount 이므로 합은 등차수열의 합입니다.
+	const float Level = static_cast<float>(FMath::Max(GrowthLevel, 0));
+	const float TotalHealthIncrease = Level * Growth.HealthIncreaseAmount + Growth.AdditionalHealthAmount * Level * (Level - 1.f) * 0.5f;
+
+	FMinionWaveStats Result;
+	Result.MaxHP = FMath::Min(BaseStats.MaxHP + TotalHealthIncrease, Growth.MaxHealthLimit);
+	Result.AttackDamage = BaseStats.AttackDamage + Level * Growth.AttackIncreaseAmount;
+	return Result;
+}
+
+FMinionWaveStats FMinionGrowthTable::GetWaveStats(int32 Wave) const
+{
+	if (WaveStats.IsValidIndex(Wave))
+	{
+		return WaveStats[Wave];
+	}
+
+	// 미리 계산한 범위를 넘어선 웨이브는 같은 식으로 바로 계산합니다.
+	const float WaveTime = Wave > 0 ? FirstWaveTime + (Wave - 1) * WaveInterval : 0.f;
+	return EvaluateGrowthLevel(Growth.GetGrowthLevel(WaveTime));
+}
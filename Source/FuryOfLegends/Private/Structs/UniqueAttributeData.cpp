@@ -6,3 +6,41 @@
 
 
 
+
+
+void FUniqueAttributeSet::Resolve(const TArray<FUniqueAttribute>& Attributes)
+{
+    FMemory::Memzero(Values);
+    PresentMask = 0;
+
+    for (const FUniqueAttribute& Attribute : Attributes)
+    {
+        const EUniqueAttribute Key = FindAttributeByName(Attribute.Key);
+        if (Key == EUniqueAttribute::MAX)
+        {
+            UE_LOG(LogTemp, Verbose, TEXT("[%s] Unknown unique attribute key: %s"), ANSI_TO_TCHAR(__FUNCTION__), *Attribute.Key.ToString());
+            continue;
+        }
+
+        const int32 Index = static_cast<int32>(Key);
+        Values[Index] = Attribute.Value;
+        PresentMask |= (1ull << Index);
+    }
+}
+
+EUniqueAttribute FUniqueAttributeSet::FindAttributeByName(const FName& Key)
+{
+    // 열거형 이름 -> 값 테이블은 처음 한 번만 만듭니다. (능력 초기화 시점에만 호출됩니다)
+    static TMap<FName, EUniqueAttribute> NameToAttribute;
+    if (NameToAttribute.Num() == 0)
+    {
+        const UEnum* Enum = StaticEnum<EUniqueAttribute>();
+        for (int32 Index = 0; Index < NumAttributes; ++Index)
+        {
+            NameToAttribute.Add(FName(*Enum->GetNameStringByValue(Index)), static_cast<EUniqueAttribute>(Index));
+        }
+    }
+
+    const EUniqueAttribute* Found = NameToAttribute.Find(Key);
+    return Found ? *Found : EUniqueAttribute::MAX;
+}
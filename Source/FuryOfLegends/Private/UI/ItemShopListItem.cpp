@@ -0,0 +1,35 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "UI/ItemShopListItem.h"
+#include "UI/UW_ItemShop.h"
+
+
+void UItemShopListItem::Initialize(const FItemTableRow& Item, UUW_ItemShop* InItemShop)
+{
+	ItemCode = Item.ItemCode;
+	Price = Item.Price;
+	Classification = Item.Classification;
+	Icon = Item.Icon;
+	StatModifiers = Item.StatModifiers;
+	ItemShop = InItemShop;
+}
+
+float UItemShopListItem::GetStatValue(ECharacterStat Stat) const
+{
+	float Value = 0.f;
+	for (const FItemStatModifier& Modifier : StatModifiers)
+	{
+		if (Modifier.Key == Stat)
+		{
+			Value += Modifier.Value;
+		}
+	}
+
+	return Value;
+}
+
+bool UItemShopListItem::HasStat(ECharacterStat Stat) const
+{
+	return StatModifiers.ContainsByPredicate([Stat](const FItemStatModifier& Modifier) { return Modifier.Key == Stat; });
+}
@@ -105,6 +105,8 @@ void UUHUD::InitializeHUD(AAOSCharacterBase* OwningPlayer)
 		PlayerState->OnRemainingTimeChanged.AddDynamic(this, &ThisClass::HandleTimerByCategory);
 	}
 
+	InitializeTimerWidgetPool();
+
 	const FCharacterAttributesRow* CharacterAttributesRow = GameInstance->GetChampionListTableRow(PlayerCharacterName);
 	if (!CharacterAttributesRow)
 	{
@@ -454,227 +456,304 @@ void UUHUD::OnCurrencyChanged(const int32 NewCurrency)
 }
 
 
-void UUHUD::OnTimerUpdated(const uint32 UniqueCode, const int32 ConcurrentUses)
+/**
+ *  Ͽ  Ÿ̸  ̸  Ӵϴ.
+ *  ߿  Ǯ   ⸸ ϸ    ʽϴ.
+ */
+void UUHUD::InitializeTimerWidgetPool()
 {
-	if (!TimerWidgets.Contains(UniqueCode))
+	if (TimerWidgetPool.Num() > 0 || ::IsValid(BuffList) == false)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed: No TimerWidget found for UniqueCode %u."), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode);
 		return;
 	}
 
-	UUW_ItemEntry* Widget = TimerWidgets[UniqueCode];
-	if (!::IsValid(Widget))
+	if (!ItemEntryClass)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed: TimerWidget for UniqueCode %u is invalid (nullptr)."), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode);
+		UE_LOG(LogTemp, Warning, TEXT("[%s] ItemEntryClass is not set."), ANSI_TO_TCHAR(__FUNCTION__));
 		return;
 	}
 
-	Widget->UpdateItemCount(ConcurrentUses);
-}
+	TimerWidgetPool.Reserve(MaxTimerWidgets);
+	FreeTimerWidgets.Reserve(MaxTimerWidgets);
+
+	for (int32 Index = 0; Index < MaxTimerWidgets; ++Index)
+	{
+		UUW_ItemEntry* Widget = CreateWidget<UUW_ItemEntry>(this, ItemEntryClass);
+		if (::IsValid(Widget) == false)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Failed to create timer widget %d."), ANSI_TO_TCHAR(__FUNCTION__), Index);
+			break;
+		}
 
+		Widget->UpdateDisplaySubItems(false);
+		Widget->UpdateCanPurchaseItem(false);
+		Widget->UpdatePriceVisibility(ESlateVisibility::Collapsed);
+		Widget->UpdateCountPadding(FMargin(0, 0, 2, 0));
+		Widget->UpdateCountTextSize(0.7f);
+		Widget->SetSize(40.f);
+		Widget->SetVisibility(ESlateVisibility::Collapsed);
 
+		BuffList->AddChildToHorizontalBox(Widget);
 
+		//    ڿ ϴ.
+		FreeTimerWidgets.Insert(TimerWidgetPool.Add(Widget), 0);
+	}
+}
 
-void UUHUD::HandleTimerByCategory(const uint32 UniqueCode, float RemainingTime, float ElapsedTime)
+void UUHUD::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
 {
-	ETimerCategory TimerCategory = UUniqueCodeGenerator::DecodeTimerCategory(UniqueCode);
+	Super::NativeTick(MyGeometry, InDeltaTime);
 
-	switch (TimerCategory)
+	UWorld* World = GetWorld();
+	if (TimerEntries.Num() == 0 || !World)
 	{
-	case ETimerCategory::Action:
-		UpdateActionTimer(UniqueCode, RemainingTime, ElapsedTime);
-		break;
-	case ETimerCategory::Item:
-		UpdateItemTimer(UniqueCode, RemainingTime, ElapsedTime);
-		break;
-	default:
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Unknown DataType for UniqueCode: %u. RemainingTime: %.2f, ElapsedTime: %.2f"), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode, RemainingTime, ElapsedTime);
-		break;
+		return;
+	}
+
+	//   /   ˸Ƿ,     ð  մϴ.
+	const float CurrentTime = World->GetTimeSeconds();
+	for (auto It = TimerEntries.CreateIterator(); It; ++It)
+	{
+		FHUDTimerEntry& Entry = It.Value();
+		if (Entry.bStarted == false)
+		{
+			continue;
+		}
+
+		if (Entry.EndTime - CurrentTime <= TimerExpireThreshold)
+		{
+			ReleaseTimerEntry(Entry);
+			It.RemoveCurrent();
+			continue;
+		}
+
+		ApplyTimerProgress(Entry, CurrentTime);
 	}
 }
 
 
-void UUHUD::UpdateActionTimer(const uint32 UniqueCode, float RemainingTime, float ElapsedTime)
+void UUHUD::OnTimerUpdated(const uint32 UniqueCode, const int32 ConcurrentUses)
 {
-	if (RemainingTime <= 0.15f && TimerWidgets.Contains(UniqueCode))
+	FHUDTimerEntry* Entry = TimerEntries.Find(UniqueCode);
+	if (Entry && Entry->bStarted == false && ConcurrentUses <= 0)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[%s] Removing expired TimerWidget for UniqueCode: %d"), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode);
-		TimerWidgets[UniqueCode]->RemoveFromParent();
-		TimerWidgets.Remove(UniqueCode);
+		// ð ϱ   Ÿ̸Դϴ. ۵  ׸   ʽϴ.
+		TimerEntries.Remove(UniqueCode);
 		return;
 	}
 
-	EActionSlot SlotID = static_cast<EActionSlot>(UUniqueCodeGenerator::DecodeSubField1(UniqueCode));
-	uint8 AttackPhase = UUniqueCodeGenerator::DecodeSubField2(UniqueCode);
+	if (!Entry)
+	{
+		if (ConcurrentUses <= 0)
+		{
+			return;
+		}
+
+		//  ð ø    Դϴ. ð  ǥø մϴ.
+		FHUDTimerEntry NewEntry;
+		if (DecodeTimerEntry(UniqueCode, NewEntry) == false)
+		{
+			return;
+		}
 
-	// SlotName 
-	FName SlotName = (SlotID == EActionSlot::None) ? NAME_None : FName(*FString::Printf(TEXT("%s%u"), *StaticEnum<EActionSlot>()->GetNameStringByValue(static_cast<int64>(SlotID)), AttackPhase));
+		Entry = &TimerEntries.Add(UniqueCode, NewEntry);
+	}
 
-	float CooldownRatio = ElapsedTime / (RemainingTime + ElapsedTime);
-	UUW_ItemEntry* Widget = TimerWidgets.Contains(UniqueCode) ? TimerWidgets[UniqueCode] : nullptr;
+	Entry->Count = ConcurrentUses;
 
-	//     ó  
-	if (::IsValid(Widget))
+	if (TimerWidgetPool.IsValidIndex(Entry->WidgetIndex))
 	{
-		Widget->UpdateCooldownPercent(CooldownRatio);
-		return;
+		TimerWidgetPool[Entry->WidgetIndex]->UpdateItemCount(ConcurrentUses);
 	}
+}
 
-	if (::IsValid(OwningCharacter) == false)
+
+/**
+ *  Ÿ̸Ӹ  /  /       ð  /  ð ϴ.
+ * ó  ڵ常 ؼ ǥ ,  ˸ ǥ ð ٲߴϴ.  ð 0 ̸  ˸Դϴ.
+ */
+void UUHUD::HandleTimerByCategory(const uint32 UniqueCode, float RemainingTime, float ElapsedTime)
+{
+	FHUDTimerEntry* Entry = TimerEntries.Find(UniqueCode);
+
+	if (RemainingTime <= TimerExpireThreshold)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Skipping because OwningCharacter is invalid."), ANSI_TO_TCHAR(__FUNCTION__));
+		if (Entry)
+		{
+			ReleaseTimerEntry(*Entry);
+			TimerEntries.Remove(UniqueCode);
+		}
 		return;
 	}
 
-	UTexture* Texture = OwningCharacter->GetOrLoadTexture(SlotName, *FString::Printf(TEXT("/Game/FuryOfLegends/Characters/%s/Images/T_Ability_%s.T_Ability_%s"), *PlayerCharacterName.ToString(), *SlotName.ToString(), *SlotName.ToString()));
-	if (!Texture)
+	if (!Entry)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Invalid ability texture for UniqueCode: %d"), UniqueCode);
-		return;
+		FHUDTimerEntry NewEntry;
+		if (DecodeTimerEntry(UniqueCode, NewEntry) == false)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Unknown DataType for UniqueCode: %u. RemainingTime: %.2f, ElapsedTime: %.2f"), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode, RemainingTime, ElapsedTime);
+			return;
+		}
+
+		Entry = &TimerEntries.Add(UniqueCode, NewEntry);
 	}
 
-	//   
-	Widget = CreateWidget<UUW_ItemEntry>(this, ItemEntryClass);
-	if (::IsValid(Widget) == false)
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to create BuffWidget for UniqueCode: %d"), UniqueCode);
 		return;
 	}
 
-	Widget->UpdateItemImage(Texture);
-	Widget->UpdateDisplaySubItems(false);
-	Widget->UpdateCanPurchaseItem(false);
-	Widget->UpdatePriceVisibility(ESlateVisibility::Collapsed);
-	Widget->UpdateCountPadding(FMargin(0, 0, 2, 0));
-	Widget->UpdateCountTextSize(0.7f);
-	Widget->SetSize(40.f);
+	const float CurrentTime = World->GetTimeSeconds();
+	Entry->StartTime = CurrentTime - ElapsedTime;
+	Entry->EndTime = CurrentTime + RemainingTime;
 
-	Widget->UpdateCooldownPercent(CooldownRatio);
-	Widget->UpdateCooldownMaskOpacity(0.01f);
+	if (Entry->bStarted == false)
+	{
+		Entry->bStarted = true;
+		AcquireTimerWidget(*Entry);
+	}
 
-	TimerWidgets.Add(UniqueCode, Widget);
-	BuffList->AddChildToHorizontalBox(Widget);
+	ApplyTimerProgress(*Entry, CurrentTime);
 }
 
 
-void UUHUD::UpdateItemTimer(const uint32 UniqueCode, float RemainingTime, float ElapsedTime)
+bool UUHUD::DecodeTimerEntry(const uint32 UniqueCode, FHUDTimerEntry& OutEntry)
 {
-	if (RemainingTime <= 0.15f && TimerWidgets.Contains(UniqueCode))
+	OutEntry.Category = UUniqueCodeGenerator::DecodeTimerCategory(UniqueCode);
+
+	switch (OutEntry.Category)
 	{
-		TimerWidgets[UniqueCode]->RemoveFromParent();
-		TimerWidgets.Remove(UniqueCode);
-		return;
-	}
+	case ETimerCategory::Action:
+	{
+		EActionSlot SlotID = static_cast<EActionSlot>(UUniqueCodeGenerator::DecodeSubField1(UniqueCode));
+		uint8 AttackPhase = UUniqueCodeGenerator::DecodeSubField2(UniqueCode);
+
+		// SlotName 
+		FName SlotName = (SlotID == EActionSlot::None) ? NAME_None : FName(*FString::Printf(TEXT("%s%u"), *StaticEnum<EActionSlot>()->GetNameStringByValue(static_cast<int64>(SlotID)), AttackPhase));
 
-	ETimerType TimerType = static_cast<ETimerType>(UUniqueCodeGenerator::DecodeSubField1(UniqueCode));
+		if (::IsValid(OwningCharacter) == false)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[%s] Skipping because OwningCharacter is invalid."), ANSI_TO_TCHAR(__FUNCTION__));
+			return false;
+		}
+
+		OutEntry.Icon = OwningCharacter->GetOrLoadTexture(SlotName, *FString::Printf(TEXT("/Game/FuryOfLegends/Characters/%s/Images/T_Ability_%s.T_Ability_%s"), *PlayerCharacterName.ToString(), *SlotName.ToString(), *SlotName.ToString()));
+		if (!OutEntry.Icon.IsValid())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Invalid ability texture for UniqueCode: %d"), UniqueCode);
+			return false;
+		}
 
-	float CooldownRatio = ElapsedTime / (RemainingTime + ElapsedTime);
-	UUW_ItemEntry* Widget = TimerWidgets.Contains(UniqueCode) ? TimerWidgets[UniqueCode] : nullptr;
+		OutEntry.bShowInBuffList = true;
+		OutEntry.CooldownMaskOpacity = 0.01f;
+		return true;
+	}
 
-	switch (TimerType)
+	case ETimerCategory::Item:
 	{
-	case ETimerType::Inventory:
-		UpdateInventoryTimer(UniqueCode, RemainingTime, ElapsedTime);
-		break;
-	case ETimerType::BuffList:
-		UpdateItemBuffTimer(UniqueCode, RemainingTime, ElapsedTime);
-		break;
-	case ETimerType::Both:
-		UpdateInventoryTimer(UniqueCode, RemainingTime, ElapsedTime);
-		UpdateItemBuffTimer(UniqueCode, RemainingTime, ElapsedTime);
-		break;
+		const ETimerType TimerType = static_cast<ETimerType>(UUniqueCodeGenerator::DecodeSubField1(UniqueCode));
+		OutEntry.ItemCode = UUniqueCodeGenerator::DecodeSubField2(UniqueCode);
+		OutEntry.bShowInInventory = TimerType == ETimerType::Inventory || TimerType == ETimerType::Both;
+		OutEntry.bShowInBuffList = TimerType == ETimerType::BuffList || TimerType == ETimerType::Both;
+		OutEntry.CooldownMaskOpacity = 0.1f;
+
+		if (OutEntry.bShowInInventory == false && OutEntry.bShowInBuffList == false)
+		{
+			return false;
+		}
+
+		if (OutEntry.bShowInBuffList)
+		{
+			if (!GameState.IsValid())
+			{
+				UE_LOG(LogTemp, Error, TEXT("[%s] Failed: GameState is invalid. Cannot retrieve item information."), ANSI_TO_TCHAR(__FUNCTION__));
+				return false;
+			}
+
+			FItemTableRow* ItemInformation = GameState->GetItemInfoByID(OutEntry.ItemCode);
+			if (!ItemInformation)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[%s] Failed: No item information found for ItemCode: %d. UniqueCode: %d"), ANSI_TO_TCHAR(__FUNCTION__), OutEntry.ItemCode, UniqueCode);
+				return false;
+			}
+
+			OutEntry.Icon = ItemInformation->Icon;
+		}
+		return true;
+	}
+
 	default:
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Unknown DataType for UniqueCode: %u. RemainingTime: %.2f, ElapsedTime: %.2f"), ANSI_TO_TCHAR(__FUNCTION__), UniqueCode, RemainingTime, ElapsedTime);
-		break;
+		return false;
 	}
 }
 
-void UUHUD::UpdateInventoryTimer(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime)
-{
-	const int32 ItemCode = UUniqueCodeGenerator::DecodeSubField2(UniqueCode);
 
-	// UniqueCode Inventory->UniqueCodeToIndx  ʴ 
-	if (!Inventory->ItemCodeToIndexMap.Contains(ItemCode))
+void UUHUD::AcquireTimerWidget(FHUDTimerEntry& Entry)
+{
+	if (Entry.bShowInBuffList == false || Entry.WidgetIndex != INDEX_NONE)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Unknown UniqueCode: %u. RemainingTime: %.2f, ElapsedTime: %.2f"),
-			ANSI_TO_TCHAR(__FUNCTION__), UniqueCode, RemainingTime, ElapsedTime);
 		return;
 	}
 
-	// ItemCode  شϴ ε 
-	int32 Index = Inventory->ItemCodeToIndexMap[ItemCode];
-
-	//  ð 0.15  
-	if (RemainingTime <= 0.15f)
+	if (FreeTimerWidgets.Num() == 0)
 	{
-		Inventory->UpdateCooldownRatio(0, Index);
+		UE_LOG(LogTemp, Warning, TEXT("[%s] All %d timer widgets are in use."), ANSI_TO_TCHAR(__FUNCTION__), TimerWidgetPool.Num());
 		return;
 	}
-	else
-	{
-		// ٿ  
 
-		float CooldownRatio = ElapsedTime / (RemainingTime + ElapsedTime);
-		Inventory->UpdateCooldownRatio(CooldownRatio, Index);
-	}
+	Entry.WidgetIndex = FreeTimerWidgets.Pop(EAllowShrinking::No);
+
+	UUW_ItemEntry* Widget = TimerWidgetPool[Entry.WidgetIndex];
+	Widget->UpdateItemImage(Entry.Icon.Get());
+	Widget->UpdateItemCount(Entry.Count);
+	Widget->UpdateCooldownMaskOpacity(Entry.CooldownMaskOpacity);
+	Widget->SetVisibility(ESlateVisibility::Visible);
 }
 
-void UUHUD::UpdateItemBuffTimer(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime)
+void UUHUD::ReleaseTimerEntry(FHUDTimerEntry& Entry)
 {
-	if (RemainingTime <= 0.15f && TimerWidgets.Contains(UniqueCode))
+	if (Entry.bShowInInventory)
 	{
-		TimerWidgets[UniqueCode]->RemoveFromParent();
-		TimerWidgets.Remove(UniqueCode);
-		return;
+		UpdateInventoryCooldown(Entry.ItemCode, 0.f);
+	}
+
+	if (TimerWidgetPool.IsValidIndex(Entry.WidgetIndex))
+	{
+		TimerWidgetPool[Entry.WidgetIndex]->SetVisibility(ESlateVisibility::Collapsed);
+		FreeTimerWidgets.Add(Entry.WidgetIndex);
 	}
 
-	ETimerType TimerType = static_cast<ETimerType>(UUniqueCodeGenerator::DecodeSubField1(UniqueCode));
-	const int32 ItemCode = UUniqueCodeGenerator::DecodeSubField2(UniqueCode);
+	Entry.WidgetIndex = INDEX_NONE;
+}
 
-	float CooldownRatio = ElapsedTime / (RemainingTime + ElapsedTime);
-	UUW_ItemEntry* Widget = TimerWidgets.Contains(UniqueCode) ? TimerWidgets[UniqueCode] : nullptr;
+void UUHUD::ApplyTimerProgress(const FHUDTimerEntry& Entry, const float CurrentTime)
+{
+	const float Duration = Entry.EndTime - Entry.StartTime;
+	const float CooldownRatio = Duration > 0.f ? FMath::Clamp((CurrentTime - Entry.StartTime) / Duration, 0.f, 1.f) : 1.f;
 
-	//     ó  
-	if (::IsValid(Widget))
+	if (Entry.bShowInInventory)
 	{
-		Widget->UpdateCooldownPercent(CooldownRatio);
-		return;
+		UpdateInventoryCooldown(Entry.ItemCode, CooldownRatio);
 	}
 
-	if (!GameState.IsValid())
+	if (TimerWidgetPool.IsValidIndex(Entry.WidgetIndex))
 	{
-		UE_LOG(LogTemp, Error, TEXT("[%s] Failed: GameState is invalid. Cannot retrieve item information."), ANSI_TO_TCHAR(__FUNCTION__));
-		return;
+		TimerWidgetPool[Entry.WidgetIndex]->UpdateCooldownPercent(CooldownRatio);
 	}
+}
 
-	FItemTableRow* ItemInformation = GameState->GetItemInfoByID(ItemCode);
-	if (!ItemInformation)
+void UUHUD::UpdateInventoryCooldown(const int32 ItemCode, const float CooldownRatio)
+{
+	if (::IsValid(Inventory) == false)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("[%s] Failed: No item information found for ItemCode: %d. UniqueCode: %d"), ANSI_TO_TCHAR(__FUNCTION__), ItemCode, UniqueCode);
 		return;
 	}
 
-	//   
-	Widget = CreateWidget<UUW_ItemEntry>(this, ItemEntryClass);
-	if (::IsValid(Widget) == false)
+	// κ丮   Ÿ̸Ӵ մϴ.
+	const int32* Index = Inventory->ItemCodeToIndexMap.Find(ItemCode);
+	if (Index)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Failed to create BuffWidget for UniqueCode: %d"), UniqueCode);
-		return;
+		Inventory->UpdateCooldownRatio(CooldownRatio, *Index);
 	}
-
-	Widget->UpdateItemImage(ItemInformation->Icon);
-	Widget->UpdateDisplaySubItems(false);
-	Widget->UpdateCanPurchaseItem(false);
-	Widget->UpdatePriceVisibility(ESlateVisibility::Collapsed);
-	Widget->UpdateCountPadding(FMargin(0, 0, 2, 0));
-	Widget->UpdateCountTextSize(0.7f);
-	Widget->SetSize(40.f);
-
-	Widget->UpdateCooldownPercent(CooldownRatio);
-	Widget->UpdateCooldownMaskOpacity(0.1f);
-
-	TimerWidgets.Add(UniqueCode, Widget);
-	BuffList->AddChildToHorizontalBox(Widget);
 }
-
-
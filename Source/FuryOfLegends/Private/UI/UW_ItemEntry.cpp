@@ -1,5 +1,6 @@
 ﻿#include "UI/UW_ItemEntry.h"
 #include "UI/UW_ItemShop.h"
+#include "UI/ItemShopListItem.h"
 #include "Components/Image.h"
 #include "Components/Button.h"
 #include "Components/TextBlock.h"
@@ -35,9 +36,32 @@ void UUW_ItemEntry::NativeConstruct()
 		return;
 	}
 
-	ItemButton->OnClicked.AddDynamic(this, &ThisClass::OnButtonClicked);
-	ItemButton->OnHovered.AddDynamic(this, &ThisClass::OnMouseHovered);
-	ItemButton->OnUnhovered.AddDynamic(this, &ThisClass::OnMouseUnHovered);
+	// 타일 뷰에서 재사용되는 엔트리는 여러 번 Construct 될 수 있습니다.
+	ItemButton->OnClicked.AddUniqueDynamic(this, &ThisClass::OnButtonClicked);
+	ItemButton->OnHovered.AddUniqueDynamic(this, &ThisClass::OnMouseHovered);
+	ItemButton->OnUnhovered.AddUniqueDynamic(this, &ThisClass::OnMouseUnHovered);
+}
+
+void UUW_ItemEntry::NativeOnListItemObjectSet(UObject* ListItemObject)
+{
+	IUserObjectListEntry::NativeOnListItemObjectSet(ListItemObject);
+
+	const UItemShopListItem* ListItem = Cast<UItemShopListItem>(ListItemObject);
+	if (!ListItem)
+	{
+		SetupNode(0, nullptr, 0);
+		return;
+	}
+
+	SetRenderTranslation(FVector2D(0, -2));
+
+	SetupNode(ListItem->ItemCode, ListItem->Icon, ListItem->Price, 0);
+	UpdateDisplaySubItems(true);
+	UpdateCanPurchaseItem(true);
+	BindItemShopWidget(ListItem->ItemShop.Get());
+
+	// 이전에 맡았던 아이템의 선택 표시가 남지 않도록 다시 계산합니다.
+	SetItemSelected(ItemShop.IsValid() && ItemShop->IsItemSelected(ItemCode));
 }
 
 
@@ -55,11 +79,20 @@ void UUW_ItemEntry::SetupNode(const int32 NewItemCode, UTexture* NewImage, const
 		return;
 	}
 
+	// 빈 칸으로 쓰였던 노드를 다시 사용하는 경우 숨겼던 요소를 되돌립니다.
+	if (ItemButton && ItemButton->GetIsEnabled() == false)
+	{
+		ItemImage->SetVisibility(ESlateVisibility::Visible);
+		ItemPrice->SetVisibility(ESlateVisibility::Visible);
+		ItemButton->SetIsEnabled(true);
+	}
+
 	if (!MaterialRef)
 	{
 		InitializeMaterial();
 	}
-	else
+
+	if (MaterialRef)
 	{
 		MaterialRef->SetTextureParameterValue(FName("Texture"), NewImage);
 	}
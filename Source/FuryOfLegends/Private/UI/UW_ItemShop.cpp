@@ -2,17 +2,16 @@
 #include "UI/UW_ItemEntry.h"
 #include "UI/TreeNodeWidget.h"
 #include "UI/UW_ItemDescriptionLine.h"
+#include "UI/ItemShopTileView.h"
 #include "Components/Image.h"
-#include "Components/UniformGridPanel.h"
 #include "Components/StackBox.h"
-#include "Components/VerticalBox.h"
 #include "Components/HorizontalBox.h"
 #include "Components/RichTextBlock.h"
 #include "Components/TreeView.h"
+#include "Components/TileView.h"
 #include "Components/TextBlock.h"
 #include "Components/StackBoxSlot.h"
 #include "Components/HorizontalBoxSlot.h"
-#include "Components/UniformGridSlot.h"
 #include "Components/StatComponent.h"
 #include "Characters/AOSCharacterBase.h"
 #include "Game/ArenaGameState.h"
@@ -21,6 +20,7 @@
 #include "Item/ItemData.h"
 #include "Kismet/GameplayStatics.h"
 #include "Blueprint/WidgetTree.h"
+#include "Algo/StableSort.h"
 
 // Constructor and Initialization
 UUW_ItemShop::UUW_ItemShop(const FObjectInitializer& ObjectInitializer)
@@ -101,148 +101,200 @@ void UUW_ItemShop::InitializeItemList()
     }
 
     // Retrieve loaded items
-    TArray<FItemTableRow> Items = GameState->GetLoadedItems();
+    const TArray<FItemTableRow>& Items = GameState->GetLoadedItems();
     if (Items.Num() == 0)
     {
         UE_LOG(LogTemp, Warning, TEXT("[UUW_ItemShop::InitializeItemList] No items in LoadedItems"));
         return;
     }
 
-    // Add items
-    for (const auto& Item : Items)
+    if (EnsureItemTileView() == false)
     {
-        AddClassifiedItemEntry(Item);
+        return;
     }
+
+    // 데이터만 만들어 두고, 엔트리 위젯은 타일 뷰가 보이는 칸 수만큼만 생성합니다.
+    if (CatalogItems.Num() == 0)
+    {
+        CatalogItems.Reserve(Items.Num());
+        for (const FItemTableRow& Item : Items)
+        {
+            if (Item.IsEmpty())
+            {
+                continue;
+            }
+
+            UItemShopListItem* ListItem = NewObject<UItemShopListItem>(this);
+            ListItem->Initialize(Item, this);
+            CatalogItems.Add(ListItem);
+        }
+    }
+
+    RefreshItemList();
 }
 
 /**
- * AddClassifiedItemEntry 함수는 주어진 아이템 정보를 기반으로 분류된 아이템 항목을 UI에 추가합니다.
- * 아이템 목록에 항목을 추가하고, 적절한 분류 패널에 항목을 배치합니다.
+ * EnsureItemTileView 함수는 목록을 표시할 타일 뷰를 준비합니다.
+ * 위젯 블루프린트에 ItemTileView 가 없으면 ItemListEntryClass 를 엔트리로 쓰는 타일 뷰를 ItemList 안에 만듭니다.
  *
- * @param FItemTableRow - 아이템 정보 구조체
+ * @return 타일 뷰를 사용할 수 있으면 true
  */
-void UUW_ItemShop::AddClassifiedItemEntry(const FItemTableRow& Item)
+bool UUW_ItemShop::EnsureItemTileView()
 {
-    if (!ItemListEntryClass)
+    if (ItemTileView)
     {
-        UE_LOG(LogTemp, Error, TEXT("[UUW_ItemShop::AddClassifiedItemEntry] ItemListEntryClass is not valid."));
-        return;
+        return true;
     }
 
-    const FString ClassificationString = Item.ConverClassificationToString();
-    UUniformGridPanel* ClassificationPanel = GetOrCreateClassificationPanel(ClassificationString);
-
-    if (!ClassificationPanel)
+    if (!WidgetTree || !ItemList)
     {
-        UE_LOG(LogTemp, Error, TEXT("[UUW_ItemShop::AddClassifiedItemEntry] Failed to get or create ClassificationPanel for %s."), *ClassificationString);
-        return;
+        UE_LOG(LogTemp, Error, TEXT("[%s] WidgetTree or ItemList is null! Cannot create ItemTileView."), ANSI_TO_TCHAR(__FUNCTION__));
+        return false;
     }
 
-    UUW_ItemEntry* Entry = CreateWidget<UUW_ItemEntry>(this, ItemListEntryClass);
-    if (!Entry)
+    if (!ItemListEntryClass || ItemListEntryClass->ImplementsInterface(UUserObjectListEntry::StaticClass()) == false)
     {
-        UE_LOG(LogTemp, Error, TEXT("[UUW_ItemShop::AddClassifiedItemEntry] Failed to create ItemListEntry widget."));
-        return;
+        UE_LOG(LogTemp, Error, TEXT("[%s] ItemListEntryClass must be set to a UUW_ItemEntry class to create ItemTileView."), ANSI_TO_TCHAR(__FUNCTION__));
+        return false;
     }
 
-    // Initialize the item entry
-    Entry->SetRenderTranslation(FVector2D(0, -2));
+    UE_LOG(LogTemp, Warning, TEXT("[%s] ItemTileView is not bound in %s. Creating it in code."), ANSI_TO_TCHAR(__FUNCTION__), *GetClass()->GetName());
 
-    Entry->SetupNode(Item.ItemCode, Item.Icon, Item.Price, 0);
-    Entry->UpdateDisplaySubItems(true);
-    Entry->UpdateCanPurchaseItem(true);
-    Entry->BindItemShopWidget(this);
+    UItemShopTileView* TileView = WidgetTree->ConstructWidget<UItemShopTileView>(UItemShopTileView::StaticClass(), TEXT("ItemTileView"));
+    if (!TileView)
+    {
+        UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create ItemTileView."), ANSI_TO_TCHAR(__FUNCTION__));
+        return false;
+    }
 
-    LoadedItems.Add(Entry);
+    TileView->SetEntryWidgetClass(ItemListEntryClass);
+    TileView->SetEntryWidth(ItemTileSize.X);
+    TileView->SetEntryHeight(ItemTileSize.Y);
 
-    // Retrieve row and column for this classification
-    int32& Row = ClassificationRows.FindOrAdd(ClassificationString);
-    int32& Column = ClassificationColumns.FindOrAdd(ClassificationString);
+    UStackBoxSlot* StackBoxSlot = ItemList->AddChildToStackBox(TileView);
+    if (StackBoxSlot)
+    {
+        SetupStackBoxSlot(StackBoxSlot, ESlateSizeRule::Fill, HAlign_Fill, VAlign_Fill);
+    }
 
-    // Add entry to the classification panel
-    ClassificationPanel->AddChildToUniformGrid(Entry, Row, Column);
+    ItemTileView = TileView;
+    return true;
+}
 
-    // Update column and row
-    if (++Column >= MaxColumn)
+void UUW_ItemShop::SetClassificationFilter(EItemClassification InClassification)
+{
+    if (ClassificationFilter != InClassification)
     {
-        Column = 0;
-        Row++;
+        ClassificationFilter = InClassification;
+        RefreshItemList();
     }
 }
 
-/**
- * GetOrCreateClassificationPanel 함수는 주어진 분류 문자열에 해당하는 UUniformGridPanel을 반환합니다.
- * 패널이 이미 존재하는 경우 해당 패널을 반환하고, 존재하지 않는 경우 새로 생성하여 반환합니다.
- *
- * @param ClassificationString - 분류 문자열
- * @return UUniformGridPanel 객체 (분류 패널)
- */
-UUniformGridPanel* UUW_ItemShop::GetOrCreateClassificationPanel(const FString& ClassificationString)
+void UUW_ItemShop::SetClassificationFilterByName(FName ClassificationName)
 {
-    if (!WidgetTree || !ItemList)
+    if (ClassificationName.IsNone())
     {
-        UE_LOG(LogTemp, Error, TEXT("[%s] WidgetTree or ItemList is null! Cannot create classification panel."), ANSI_TO_TCHAR(__FUNCTION__));
-        return nullptr;
+        SetClassificationFilter(EItemClassification::None);
+        return;
     }
 
-    // 기존 패널이 존재하는지 확인
-    UUniformGridPanel** FoundPanel = ClassificationPanels.Find(ClassificationString);
-    if (FoundPanel)
+    const int64 Value = StaticEnum<EItemClassification>()->GetValueByName(ClassificationName);
+    if (Value == INDEX_NONE)
     {
-        return *FoundPanel;
+        UE_LOG(LogTemp, Warning, TEXT("[%s] Unknown item classification: %s"), ANSI_TO_TCHAR(__FUNCTION__), *ClassificationName.ToString());
+        return;
     }
 
-    // VerticalBox 생성
-    UVerticalBox* VerticalBox = WidgetTree->ConstructWidget<UVerticalBox>(
-        UVerticalBox::StaticClass(),
-        FName(FString::Printf(TEXT("ChildrenVerticalBox_%d"), BoxIndex++))
-    );
+    SetClassificationFilter(static_cast<EItemClassification>(Value));
+}
 
-    if (!VerticalBox)
+void UUW_ItemShop::SetStatFilter(ECharacterStat InStat)
+{
+    if (StatFilter != InStat)
     {
-        UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create UVerticalBox for '%s'."), ANSI_TO_TCHAR(__FUNCTION__), *ClassificationString);
-        return nullptr;
+        StatFilter = InStat;
+        RefreshItemList();
     }
+}
 
-    // TextBlock 생성
-    UTextBlock* ClassificationText = WidgetTree->ConstructWidget<UTextBlock>(UTextBlock::StaticClass(), TEXT("ClassificationText"));
-    if (!ClassificationText)
+void UUW_ItemShop::SetSortMode(EItemShopSortMode InSortMode, ECharacterStat InSortStat)
+{
+    if (SortMode != InSortMode || SortStat != InSortStat)
     {
-        UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create ClassificationText for '%s'."), ANSI_TO_TCHAR(__FUNCTION__), *ClassificationString);
-        return nullptr;
+        SortMode = InSortMode;
+        SortStat = InSortStat;
+        RefreshItemList();
     }
+}
 
-    ClassificationText->SetText(FText::FromString(ClassificationString));
-
-    FSlateFontInfo FontInfo = ClassificationText->GetFont();
-    FontInfo.Size = 20.f;
-    FontInfo.TypefaceFontName = FName("Regular");
-    ClassificationText->SetFont(FontInfo);
+/**
+ * 현재 필터와 정렬 기준으로 카탈로그에서 표시할 아이템을 골라 타일 뷰에 넘깁니다.
+ * 타일 뷰는 보이는 칸의 엔트리만 만들고, 스크롤할 때는 그 엔트리에 다른 아이템을 넘겨 재사용합니다.
+ */
+void UUW_ItemShop::RefreshItemList()
+{
+    if (!ItemTileView)
+    {
+        return;
+    }
 
-    VerticalBox->AddChildToVerticalBox(ClassificationText);
+    TArray<UItemShopListItem*> VisibleItems;
+    VisibleItems.Reserve(CatalogItems.Num());
 
-    // UniformGridPanel 생성
-    UUniformGridPanel* ClassificationPanel = WidgetTree->ConstructWidget<UUniformGridPanel>(UUniformGridPanel::StaticClass(), TEXT("ClassificationPanel"));
-    if (!ClassificationPanel)
+    for (UItemShopListItem* ListItem : CatalogItems)
     {
-        UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create UUniformGridPanel for '%s'."), ANSI_TO_TCHAR(__FUNCTION__), *ClassificationString);
-        return nullptr;
+        if (!ListItem)
+        {
+            continue;
+        }
+
+        if (ClassificationFilter != EItemClassification::None && ListItem->Classification != ClassificationFilter)
+        {
+            continue;
+        }
+
+        if (StatFilter != ECharacterStat::None && ListItem->HasStat(StatFilter) == false)
+        {
+            continue;
+        }
+
+        VisibleItems.Add(ListItem);
     }
 
-    ClassificationPanel->SetSlotPadding(FMargin(5.f));
-    VerticalBox->AddChildToVerticalBox(ClassificationPanel);
+    const EItemShopSortMode Mode = SortMode;
+    const ECharacterStat Stat = SortStat;
+    Algo::StableSort(VisibleItems, [Mode, Stat](const UItemShopListItem* A, const UItemShopListItem* B)
+        {
+            switch (Mode)
+            {
+            case EItemShopSortMode::PriceAscending:
+                if (A->Price != B->Price) return A->Price < B->Price;
+                break;
 
-    // ItemList에 추가
-    ItemList->AddChildToStackBox(VerticalBox);
+            case EItemShopSortMode::PriceDescending:
+                if (A->Price != B->Price) return A->Price > B->Price;
+                break;
 
-    // 데이터 등록
-    ClassificationPanels.Add(ClassificationString, ClassificationPanel);
-    ClassificationRows.Add(ClassificationString, 0);
-    ClassificationColumns.Add(ClassificationString, 0);
+            case EItemShopSortMode::Stat:
+            {
+                const float ValueA = A->GetStatValue(Stat);
+                const float ValueB = B->GetStatValue(Stat);
+                if (ValueA != ValueB) return ValueA > ValueB;
+                if (A->Price != B->Price) return A->Price < B->Price;
+                break;
+            }
 
-    return ClassificationPanel;
-}
+            default:
+                if (A->Classification != B->Classification) return A->Classification < B->Classification;
+                if (A->Price != B->Price) return A->Price < B->Price;
+                break;
+            }
+
+            return A->ItemCode < B->ItemCode;
+        });
 
+    ItemTileView->SetListItems(VisibleItems);
+}
 
 
 // ----------------------------------------------------------------------------------------------------------
@@ -270,9 +322,9 @@ void UUW_ItemShop::OnItemPurchased(int32 ItemCode, bool bSucessful)
     USoundBase* PurchaseSuccessSound = Cast<USoundBase>(StaticLoadObject(USoundBase::StaticClass(), NULL, *SoundPath));
 
     // 아이템 구매 후 UI 업데이트
-    if (SelectedItem.IsValid())
+    if (SelectedItemCode > 0)
     {
-        DisplayItemWithSubItems(SelectedItem->ItemCode);
+        DisplayItemWithSubItems(SelectedItemCode);
     }
    
     // 구매 완료 사운드 재생
@@ -412,7 +464,7 @@ void UUW_ItemShop::AddItemDescription(const FItemTableRow& ItemInfo, UStatCompon
     if (!ItemInfo.Description.IsEmpty())
     {
         // Add item description after converting to rich text
-        FString RichDescription = ItemInfo.ConvertToRichText(StatComponent);
+        const FString& RichDescription = DescriptionTextCache.GetRichText(ItemInfo, *StatComponent);
         UUW_ItemDescriptionLine* DescriptionLine = CreateWidget<UUW_ItemDescriptionLine>(this, ItemDescriptionLineClass);
         if (DescriptionLine)
         {
@@ -429,10 +481,63 @@ void UUW_ItemShop::AddItemDescription(const FItemTableRow& ItemInfo, UStatCompon
 // ----------------------------------------------------------------------------------------
 
 // Item Hierarchy Management
-void UUW_ItemShop::DisplayItemWithSubItems(int32 ItemIndex)
+namespace
 {
-    ItemHierarchyBox->ClearChildren();
+    // 레시피가 잘못 순환하더라도 트리가 끝없이 깊어지지 않도록 막습니다.
+    constexpr int32 MaxRecipeDepth = 8;
+
+    struct FRecipeNode
+    {
+        int32 ItemCode = 0;
+        TArray<FRecipeNode> Children;
+    };
+
+    /** 하위 아이템마다 자식 수를 맞춰 빈 칸(ItemCode 0)을 채운 레시피 트리를 만듭니다. */
+    FRecipeNode BuildRecipeNode(AArenaGameState& GameState, const FItemTableRow& NodeInfo, int32 Depth)
+    {
+        FRecipeNode Node;
+        Node.ItemCode = NodeInfo.ItemCode;
+
+        if (Depth >= MaxRecipeDepth)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("[%s] Recipe of ItemCode %d is deeper than %d."), ANSI_TO_TCHAR(__FUNCTION__), NodeInfo.ItemCode, MaxRecipeDepth);
+            return Node;
+        }
+
+        int32 MaxChildCount = 0;
+        for (const int32 ChildItemCode : NodeInfo.RequiredItems)
+        {
+            FItemTableRow* SubItem = GameState.GetItemInfoByID(ChildItemCode);
+            if (SubItem)
+            {
+                FRecipeNode& ChildNode = Node.Children.Add_GetRef(BuildRecipeNode(GameState, *SubItem, Depth + 1));
+                MaxChildCount = FMath::Max(MaxChildCount, ChildNode.Children.Num());
+            }
+            else
+            {
+                UE_LOG(LogTemp, Warning, TEXT("SubItemInfo not found for ItemCode: %d"), ChildItemCode);
+            }
+        }
+
+        // 빈 노드 추가
+        for (FRecipeNode& ChildNode : Node.Children)
+        {
+            ChildNode.Children.SetNum(FMath::Max(ChildNode.Children.Num(), MaxChildCount));
+        }
 
+        // 빈 노드 추가해서 균형 맞추기
+        Node.Children.SetNum(FMath::Max(Node.Children.Num(), MaxChildCount));
+
+        return Node;
+    }
+}
+
+/**
+ * 선택한 아이템의 레시피 트리를 표시합니다.
+ * 트리의 단계별 배치는 아이템마다 한 번만 계산하고, 단계 박스와 노드 위젯은 풀에서 꺼내 다시 설정합니다.
+ */
+void UUW_ItemShop::DisplayItemWithSubItems(int32 ItemIndex)
+{
     if (!GameState.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("[UUW_ItemShop::DisplayItemWithSubItems] Invalid GameState"));
@@ -446,153 +551,154 @@ void UUW_ItemShop::DisplayItemWithSubItems(int32 ItemIndex)
         return;
     }
 
-    UUW_ItemEntry* RootNode = GetOrCreateItemHierarchy(*ItemInfo);
-    if (RootNode)
-    {
-        AddNodesBreadthFirst(RootNode);
-        //AdjustAndDisplayItemPrice(RootNode, ItemInfo);
-    }
+    ApplyRecipeLayout(GetOrBuildRecipeLayout(*ItemInfo));
+    //AdjustAndDisplayItemPrice(RootNode, ItemInfo);
 }
 
-
 /**
- * CreateNodeHierarchy 함수는 주어진 아이템 정보(NodeInfo)에 따라 재귀적으로 노드 계층 구조를 생성합니다.
- * 각 노드는 자식 노드를 포함하며, 모든 노드는 캐시를 통해 관리됩니다.
+ * 아이템의 레시피 트리를 너비 우선으로 펼쳐 단계별 아이템 코드 목록으로 만들어 둡니다.
+ * 레시피는 게임 중에 바뀌지 않으므로 아이템마다 한 번만 계산합니다.
  *
- * @param NodeInfo - 아이템 정보
- * @return UUW_ItemEntry 객체 (계층 구조의 루트 노드)
+ * @param ItemInfo - 아이템 정보
+ * @return 단계(깊이)별 아이템 코드. 0 은 빈 칸입니다.
  */
-UUW_ItemEntry* UUW_ItemShop::CreateNodeHierarchy(const FItemTableRow& NodeInfo)
+const FRecipeTreeLayout& UUW_ItemShop::GetOrBuildRecipeLayout(const FItemTableRow& ItemInfo)
 {
-    // 캐시에서 노드를 찾거나 새로 생성하여 반환
-    UUW_ItemEntry* RootNode = CreateCachedNode(NodeInfo);
-    if (!RootNode)
+    if (const FRecipeTreeLayout* CachedLayout = RecipeLayoutCache.Find(ItemInfo.ItemCode))
     {
-        return nullptr;
+        return *CachedLayout;
     }
 
-    int32 MaxChildCount = 0;
-    TArray<UUW_ItemEntry*> ChildNodes;
+    FRecipeTreeLayout& Layout = RecipeLayoutCache.Add(ItemInfo.ItemCode);
+    const FRecipeNode RootNode = BuildRecipeNode(*GameState, ItemInfo, 0);
 
-    for (const int32 ChildItemCode : NodeInfo.RequiredItems)
-    {
-        FItemTableRow* SubItem = GameState->GetItemInfoByID(ChildItemCode);
-        if (SubItem)
-        {
-            UUW_ItemEntry* ChildNode = CreateNodeHierarchy(*SubItem);
-            ChildNode->ParentNode = RootNode;
-            ChildNodes.Add(ChildNode);
-            MaxChildCount = FMath::Max(MaxChildCount, ChildNode->ChildNodes.Num());
-        }
-        else
-        {
-            UE_LOG(LogTemp, Warning, TEXT("SubItemInfo not found for ItemCode: %d"), ChildItemCode);
-        }
-    }
+    TArray<const FRecipeNode*> NodeQueue;
+    NodeQueue.Add(&RootNode);
 
-    // 빈 노드 추가
-    for (int32 i = 0; i < ChildNodes.Num(); ++i)
+    while (NodeQueue.Num() > 0)
     {
-        while (ChildNodes[i]->ChildNodes.Num() < MaxChildCount)
+        TArray<int32>& Level = Layout.Levels.AddDefaulted_GetRef();
+        Level.Reserve(NodeQueue.Num());
+
+        TArray<const FRecipeNode*> NextQueue;
+        for (const FRecipeNode* CurrentNode : NodeQueue)
         {
-            UUW_ItemEntry* EmptyNode = CreateCachedNode(FItemTableRow());
-            EmptyNode->ParentNode = ChildNodes[i];
-            ChildNodes[i]->ChildNodes.Add(EmptyNode);
+            Level.Add(CurrentNode->ItemCode);
+            for (const FRecipeNode& ChildNode : CurrentNode->Children)
+            {
+                NextQueue.Add(&ChildNode);
+            }
         }
-        RootNode->ChildNodes.Add(ChildNodes[i]);
-    }
 
-    // 빈 노드 추가해서 균형 맞추기
-    while (RootNode->ChildNodes.Num() < MaxChildCount)
-    {
-        UUW_ItemEntry* EmptyNode = CreateCachedNode(FItemTableRow());
-        EmptyNode->ParentNode = RootNode;
-        RootNode->ChildNodes.Add(EmptyNode);
+        NodeQueue = MoveTemp(NextQueue);
     }
 
-    return RootNode;
+    return Layout;
 }
 
 /**
- * AddNodesBreadthFirst 함수는 주어진 루트 노드로부터 너비 우선 탐색 방식으로
- * 모든 자식 노드를 순회하며 계층 구조를 UI에 추가하는 역할을 합니다.
+ * 계산해 둔 배치대로 풀의 단계 박스와 노드를 설정합니다.
+ * 모자란 위젯만 새로 만들고, 이번 트리에 필요 없는 위젯은 지우지 않고 숨겨 둡니다.
  *
- * @param RootNode - 탐색을 시작할 루트 노드
+ * @param Layout - 단계별 아이템 코드
  */
-void UUW_ItemShop::AddNodesBreadthFirst(UUW_ItemEntry* RootNode)
+void UUW_ItemShop::ApplyRecipeLayout(const FRecipeTreeLayout& Layout)
 {
-    if (!RootNode)
+    for (int32 Depth = 0; Depth < Layout.Levels.Num(); ++Depth)
     {
-        return;
-    }
+        UHorizontalBox* LevelBox = GetOrCreateRecipeLevelBox(Depth);
+        if (!LevelBox)
+        {
+            return;
+        }
 
-    TArray<UUW_ItemEntry*> NodeQueue;
-    NodeQueue.Add(RootNode);
+        LevelBox->SetVisibility(ESlateVisibility::SelfHitTestInvisible);
 
-    while (NodeQueue.Num() > 0)
-    {
-        int32 CurrentLevelSize = NodeQueue.Num();
-        UHorizontalBox* CurrentLevelBox = CreateRootHorizontalBox();
-        AddTopLevelBoxToItemHierarchy(CurrentLevelBox);
-
-        for (int32 i = 0; i < CurrentLevelSize; ++i)
+        const TArray<int32>& Level = Layout.Levels[Depth];
+        for (int32 Index = 0; Index < Level.Num(); ++Index)
         {
-            UUW_ItemEntry* CurrentNode = NodeQueue[0];
-            NodeQueue.RemoveAt(0);
+            UUW_ItemEntry* Node = GetOrCreateRecipeNode(LevelBox, Index);
+            if (!Node)
+            {
+                break;
+            }
 
-            if (CurrentNode)
+            const FItemTableRow* NodeInfo = Level[Index] > 0 ? GameState->GetItemInfoByID(Level[Index]) : nullptr;
+            if (NodeInfo)
             {
-                AddNodeToHorizontalBox(CurrentLevelBox, CurrentNode, ESlateSizeRule::Fill, HAlign_Center, VAlign_Center);
+                Node->SetupNode(NodeInfo->ItemCode, NodeInfo->Icon, NodeInfo->Price, 0);
+            }
+            else
+            {
+                Node->SetupNode(0, nullptr, 0, 0);
+            }
 
-                for (auto& ChildNode : CurrentNode->ChildNodes)
-                {
-                    NodeQueue.Add(ChildNode);
-                }
+            Node->SetVisibility(RecipeNodeVisibility.Get(ESlateVisibility::Visible));
+        }
+
+        for (int32 Index = Level.Num(); Index < LevelBox->GetChildrenCount(); ++Index)
+        {
+            if (UWidget* UnusedNode = LevelBox->GetChildAt(Index))
+            {
+                UnusedNode->SetVisibility(ESlateVisibility::Collapsed);
             }
         }
     }
-}
 
+    for (int32 Depth = Layout.Levels.Num(); Depth < RecipeLevelBoxes.Num(); ++Depth)
+    {
+        if (RecipeLevelBoxes[Depth])
+        {
+            RecipeLevelBoxes[Depth]->SetVisibility(ESlateVisibility::Collapsed);
+        }
+    }
+}
 
-/**
- * X 현재 사용하지 않음 X 
- * AddChildNodesRecursively 함수는 주어진 부모 노드를 기준으로 깊이 우선 탐색 방식으로
- * 모든 자식 노드를 순회하며 계층 구조를 UI에 재귀적으로 추가하는 역할을 합니다.
- *
- * @param ParentNode - 탐색을 시작할 부모 노드
- * @param ParentBox - 부모 노드를 포함할 UI 박스
- * @param Depth - 현재 깊이 수준 (루트 노드는 0)
- */
-void UUW_ItemShop::AddChildNodesRecursively(UUW_ItemEntry* ParentNode, UHorizontalBox* ParentBox, int32 Depth)
+UHorizontalBox* UUW_ItemShop::GetOrCreateRecipeLevelBox(int32 Depth)
 {
-    AddNodeToHorizontalBox(ParentBox, ParentNode, ESlateSizeRule::Fill, HAlign_Center, VAlign_Center);
-
-    if (ParentNode->ChildNodes.Num() > 0)
+    while (RecipeLevelBoxes.Num() <= Depth)
     {
-        // 깊이가 0인 경우에만 최상위 박스를 ItemHierarchyBox에 추가
-        if (Depth == 0)
+        UHorizontalBox* NewLevelBox = CreateRootHorizontalBox();
+        if (!NewLevelBox)
         {
-            AddTopLevelBoxToItemHierarchy(ParentBox);
+            UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create recipe level box for depth %d."), ANSI_TO_TCHAR(__FUNCTION__), RecipeLevelBoxes.Num());
+            return nullptr;
         }
 
-        // 자식 노드를 포함할 새 HorizontalBox 생성
-        UHorizontalBox* ChildContainerBox = WidgetTree->ConstructWidget<UHorizontalBox>(
-            UHorizontalBox::StaticClass(),
-            FName(FString::Printf(TEXT("HorizontalBox%d"), BoxIndex++))
-        );
+        RecipeLevelBoxes.Add(NewLevelBox);
+    }
+
+    return RecipeLevelBoxes[Depth];
+}
 
-        // 각 자식 노드를 ChildContainerBox에 추가
-        for (UUW_ItemEntry* ChildNode : ParentNode->ChildNodes)
+UUW_ItemEntry* UUW_ItemShop::GetOrCreateRecipeNode(UHorizontalBox* LevelBox, int32 Index)
+{
+    while (LevelBox->GetChildrenCount() <= Index)
+    {
+        UUW_ItemEntry* NewNode = CreateWidget<UUW_ItemEntry>(this, ItemListEntryClass);
+        if (!NewNode)
         {
-            AddNodeToHorizontalBox(ChildContainerBox, ChildNode, ESlateSizeRule::Fill, HAlign_Center, VAlign_Center);
+            UE_LOG(LogTemp, Error, TEXT("[%s] Failed to create recipe node widget."), ANSI_TO_TCHAR(__FUNCTION__));
+            return nullptr;
+        }
 
-            // 자식 노드를 재귀적으로 추가
-            AddChildNodesRecursively(ChildNode, ChildContainerBox, Depth + 1);
+        // 처음 만든 노드의 표시 상태를 기억해 두었다가, 숨겼던 노드를 다시 보일 때 사용합니다.
+        // 엔트리 클래스가 기본으로 숨겨져 있으면 노드가 보이지 않으므로 Visible 을 사용합니다.
+        if (RecipeNodeVisibility.IsSet() == false)
+        {
+            const ESlateVisibility DefaultVisibility = NewNode->GetVisibility();
+            const bool bHiddenByDefault = DefaultVisibility == ESlateVisibility::Collapsed || DefaultVisibility == ESlateVisibility::Hidden;
+            RecipeNodeVisibility = bHiddenByDefault ? ESlateVisibility::Visible : DefaultVisibility;
         }
 
-        // 모든 자식 노드를 추가한 후 ChildContainerBox를 ItemHierarchyBox에 추가
-        AddTopLevelBoxToItemHierarchy(ChildContainerBox);
+        NewNode->UpdateDisplaySubItems(false);
+        NewNode->UpdateCanPurchaseItem(true);
+        NewNode->BindItemShopWidget(this);
+
+        AddNodeToHorizontalBox(LevelBox, NewNode, ESlateSizeRule::Fill, HAlign_Center, VAlign_Center);
     }
+
+    return Cast<UUW_ItemEntry>(LevelBox->GetChildAt(Index));
 }
 
 
@@ -657,6 +763,11 @@ UHorizontalBox* UUW_ItemShop::CreateRootHorizontalBox()
         FName(FString::Printf(TEXT("RootHorizontalBox%d"), BoxIndex++))
     );
 
+    if (!HorizontalBox)
+    {
+        return nullptr;
+    }
+
     UStackBoxSlot* StackBoxSlot = ItemHierarchyBox->AddChildToStackBox(HorizontalBox);
     if (StackBoxSlot)
     {
@@ -666,95 +777,6 @@ UHorizontalBox* UUW_ItemShop::CreateRootHorizontalBox()
     return HorizontalBox;
 }
 
-/**
- * FindLoadedItemByID 함수는 로드된 아이템 리스트에서 주어진 ItemCode와 일치하는 아이템을 찾습니다.
- * 일치하는 아이템이 있다면 해당 아이템을 반환하고, 없다면 nullptr을 반환합니다.
- *
- * @param ItemCode - 찾고자 하는 아이템의 ID
- * @return 일치하는 UUW_ItemEntry 객체 또는 nullptr
- */
-UUW_ItemEntry* UUW_ItemShop::FindLoadedItemByID(int32 ItemCode) const
-{
-    for (UUW_ItemEntry* ItemEntry : LoadedItems)
-    {
-        if (ItemEntry && ItemEntry->ItemCode == ItemCode)
-        {
-            return ItemEntry;
-        }
-    }
-    return nullptr;
-}
-
-
-/**
- * 주어진 아이템 정보에 대한 아이템 계층 구조를 생성하거나, 이미 존재하는 계층 구조를 반환합니다.
- *
- * @param ItemInfo - 아이템 정보
- * @return UUW_ItemEntry 객체 (계층 구조의 루트 노드)
- */
-UUW_ItemEntry* UUW_ItemShop::GetOrCreateItemHierarchy(const FItemTableRow& ItemInfo)
-{
-    // 최상위 아이템의 경우 ParentNodeID는 0으로 설정
-    int32 ParentNodeID = 0;
-
-    if (TArray<TWeakObjectPtr<UUW_ItemEntry>>* CachedNodes = ItemHierarchyCache.Find(ItemInfo.ItemCode))
-    {
-        for (TWeakObjectPtr<UUW_ItemEntry>& CachedNode : *CachedNodes)
-        {
-            if (CachedNode.IsValid())
-            {
-                UE_LOG(LogTemp, Log, TEXT("[UUW_ItemShop::GetOrCreateItemHierarchy] Using cached item hierarchy for ItemCode: %d"), ItemInfo.ItemCode);
-                return CachedNode.Get();
-            }
-        }
-    }
-
-    UUW_ItemEntry* NewHierarchy = CreateNodeHierarchy(ItemInfo);
-    if (NewHierarchy)
-    {
-        if (!ItemHierarchyCache.Contains(ItemInfo.ItemCode))
-        {
-            ItemHierarchyCache.Add(ItemInfo.ItemCode, TArray<TWeakObjectPtr<UUW_ItemEntry>>());
-        }
-
-        ItemHierarchyCache[ItemInfo.ItemCode].Add(NewHierarchy);
-        UE_LOG(LogTemp, Log, TEXT("[UUW_ItemShop::GetOrCreateItemHierarchy] Created new item hierarchy for ItemCode: %d"), ItemInfo.ItemCode);
-    }
-    return NewHierarchy;
-}
-
-
-/**
- * 주어진 노드 정보에 대한 노드를 생성합니다.
- *
- * @param NodeInfo - 노드 정보
- * @return UUW_ItemEntry 객체 (캐시된 노드)
- */
-UUW_ItemEntry* UUW_ItemShop::CreateCachedNode(const FItemTableRow& NodeInfo)
-{
-    UUW_ItemEntry* NewNode = CreateWidget<UUW_ItemEntry>(this, ItemListEntryClass);
-    if (NewNode)
-    {
-        NewNode->SetupNode(NodeInfo.ItemCode, NodeInfo.Icon, NodeInfo.Price, 0);
-        NewNode->UpdateDisplaySubItems(false);
-        NewNode->UpdateCanPurchaseItem(true);
-        NewNode->BindItemShopWidget(this);
-
-        // 빈 노드는 캐시하지 않습니다.
-        if (NodeInfo.ItemCode != 0)
-        {
-            if (!ItemHierarchyCache.Contains(NodeInfo.ItemCode))
-            {
-                ItemHierarchyCache.Add(NodeInfo.ItemCode, TArray<TWeakObjectPtr<UUW_ItemEntry>>());
-            }
-
-            ItemHierarchyCache[NodeInfo.ItemCode].Add(NewNode);
-        }
-    }
-    return NewNode;
-}
-
-
 void UUW_ItemShop::SetSelectedItem(UUW_ItemEntry* NewSelectedItem)
 {
     if (SelectedItem.IsValid())
@@ -765,8 +787,10 @@ void UUW_ItemShop::SetSelectedItem(UUW_ItemEntry* NewSelectedItem)
 
     // Select the new item and activate its background
     SelectedItem = NewSelectedItem;
+    SelectedItemCode = 0;
     if (SelectedItem.IsValid())
     {
+        SelectedItemCode = SelectedItem->ItemCode;
         SelectedItem->SetItemSelected(true);
     }
 }
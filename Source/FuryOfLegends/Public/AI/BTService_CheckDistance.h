@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_SignificanceBase.h"
 #include "BTService_CheckDistance.generated.h"
 
 /**
  * 
  */
 UCLASS()
-class FURYOFLEGENDS_API UBTService_CheckDistance : public UBTService
+class FURYOFLEGENDS_API UBTService_CheckDistance : public UBTService_SignificanceBase
 {
 	GENERATED_BODY()
 	
@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_SignificanceBase.h"
 #include "BTService_CheckIfTargetIsDead.generated.h"
 
 /**
  * 
  */
 UCLASS()
-class FURYOFLEGENDS_API UBTService_CheckIfTargetIsDead : public UBTService
+class FURYOFLEGENDS_API UBTService_CheckIfTargetIsDead : public UBTService_SignificanceBase
 {
 	GENERATED_BODY()
 	
@@ -3,14 +3,14 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_SignificanceBase.h"
 #include "BTService_IsInAttackRange.generated.h"
 
 /**
  * 
  */
 UCLASS()
-class FURYOFLEGENDS_API UBTService_IsInAttackRange : public UBTService
+class FURYOFLEGENDS_API UBTService_IsInAttackRange : public UBTService_SignificanceBase
 {
 	GENERATED_BODY()
 	
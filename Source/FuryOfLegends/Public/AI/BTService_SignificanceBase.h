@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "BehaviorTree/BTService.h"
+#include "BTService_SignificanceBase.generated.h"
+
+/**
+ * 다음 틱 시간을 AI 컨트롤러의 중요도 배율(ABaseAIController::GetServiceIntervalScale)로 늘리는 서비스 베이스.
+ * 플레이어와 멀리 떨어진 미니언 / NPC 는 서비스가 덜 자주 실행됩니다.
+ */
+UCLASS(Abstract)
+class FURYOFLEGENDS_API UBTService_SignificanceBase : public UBTService
+{
+	GENERATED_BODY()
+
+public:
+	UBTService_SignificanceBase();
+
+protected:
+	virtual void ScheduleNextTick(UBehaviorTreeComponent& OwnerComp, uint8* NodeMemory) override;
+
+protected:
+	// false 이면 중요도와 관계없이 Interval 을 그대로 사용합니다.
+	UPROPERTY(EditAnywhere, Category = "Service")
+	uint8 bScaleIntervalBySignificance : 1;
+};
@@ -3,7 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "BehaviorTree/BTService.h"
+#include "AI/BTService_SignificanceBase.h"
 #include "BTService_UpdateSplineLocation.generated.h"
 
 class ABaseAIController;
@@ -14,7 +14,7 @@ class USplineComponent;
  * 
  */
 UCLASS()
-class FURYOFLEGENDS_API UBTService_UpdateSplineLocation : public UBTService
+class FURYOFLEGENDS_API UBTService_UpdateSplineLocation : public UBTService_SignificanceBase
 {
 	GENERATED_BODY()
 	
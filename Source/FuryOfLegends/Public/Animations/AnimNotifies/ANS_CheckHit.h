@@ -4,17 +4,26 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "Structs/ActionData.h"
 #include "ANS_CheckHit.generated.h"
 
 /**
- * 
+ * 무기 소켓이 지나간 경로를 따라 스윕하는 근접 공격 판정 구간.
+ *
+ * 매 갱신마다 이전 소켓 위치에서 현재 위치까지를 MaxStepDistance 단위로 나누어 스윕하므로
+ * 프레임이 떨어져도 빠른 휘두르기가 대상을 건너뛰지 않습니다.
+ * 한 번의 휘두르기 동안 같은 대상은 한 번만 맞고, 새로 맞은 대상은 갱신마다 한 번의 OnMeleeTraceHit 로 전달됩니다.
+ *
+ * 노티파이 객체는 같은 애니메이션을 재생하는 모든 메시가 공유하므로, 휘두르기 상태는 메시 컴포넌트별로 보관합니다.
  */
-UCLASS()
+UCLASS(meta = (DisplayName = "Melee Trace"))
 class FURYOFLEGENDS_API UANS_CheckHit : public UAnimNotifyState
 {
 	GENERATED_BODY()
 	
 public:
+	UANS_CheckHit();
+
 	virtual void NotifyBegin(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
 	
 	virtual void NotifyTick(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, float DeltaSeconds, const FAnimNotifyEventReference& EventReference) override;
@@ -22,9 +31,47 @@ public:
 	virtual void NotifyEnd(USkeletalMeshComponent* MeshComponent, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
 
 private:
-	class AAOSCharacterBase* OwnerCharacter;
-	class USkeletalMeshComponent* MeshComp;
+	struct FMeleeSwingState
+	{
+		TArray<FVector, TInlineAllocator<4>> PreviousSamples;
+		TArray<TWeakObjectPtr<AActor>, TInlineAllocator<8>> HitActors;
+
+		// 갱신마다 다시 쓰는 스윕 결과 버퍼. 휘두르기 동안 할당한 용량을 재사용합니다.
+		TArray<FHitResult> SweepHits;
+		TArray<FHitResult> NewHits;
+	};
+
+	/** 서버에서 재생 중인 메시인지 확인하고 소유 캐릭터를 반환합니다. */
+	class ACharacterBase* GetAuthorityOwner(USkeletalMeshComponent* MeshComponent) const;
+
+	void SampleSockets(const USkeletalMeshComponent* MeshComponent, TArray<FVector, TInlineAllocator<4>>& OutSamples) const;
+
+protected:
+	// 무기 경로를 나타내는 소켓. 손잡이부터 끝까지 순서대로 넣습니다.
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace")
+	TArray<FName> SocketNames;
+
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace", Meta = (ClampMin = "1.0"))
+	float Radius = 20.f;
 
-	TArray<FHitResult> OutHits;
-	TArray<class ACharacterBase*> FinalHitResults;
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_GameTraceChannel5;
+
+	// 한 번의 스윕이 담당하는 최대 이동 거리. 소켓이 이보다 많이 움직이면 나누어 스윕합니다.
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace", Meta = (ClampMin = "1.0"))
+	float MaxStepDistance = 30.f;
+
+	// 한 번의 갱신에서 나누는 최대 횟수. 갱신당 스윕 수는 MaxSubSteps x 소켓 수를 넘지 않습니다.
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace", Meta = (ClampMin = "1", ClampMax = "16"))
+	int32 MaxSubSteps = 6;
+
+	// 한 번의 휘두르기에서 맞힐 수 있는 최대 대상 수
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace", Meta = (ClampMin = "1"))
+	int32 MaxHitsPerSwing = 8;
+
+	UPROPERTY(EditAnywhere, Category = "MeleeTrace")
+	EActionSlot ActionSlot = EActionSlot::LMB;
+
+private:
+	TMap<TWeakObjectPtr<USkeletalMeshComponent>, FMeleeSwingState> ActiveSwings;
 };
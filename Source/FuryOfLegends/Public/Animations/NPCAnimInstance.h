@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
+#include "Structs/AnimationData.h"
 #include "NPCAnimInstance.generated.h"
 
 DECLARE_DELEGATE(FOnNPCCanNextComboDelegate);
@@ -18,6 +19,8 @@ protected:
 
 	virtual void NativeUpdateAnimation(float DeltaSeconds) override;
 
+	virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
 public:
 	void PlayMontage(UAnimMontage* Montage, float PlayRate = 1.0f);
 
@@ -28,6 +31,10 @@ private:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "NonPlayerCharacter", Meta = (AllowPrivateAccess))
 	TObjectPtr<class ACharacterBase> OwnerCharacter;
 
+	// 게임 스레드에서 복사한 캐릭터 상태. 나머지 값은 모두 워커 스레드에서 이 값으로 계산합니다.
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "NonPlayerCharacter|Anim", Meta = (AllowPrivateAccess))
+	FCharacterAnimSnapshot Snapshot;
+
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "NonPlayerCharacter|Anim", Meta = (AllowPrivateAccess))
 	FVector Velocity;
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Animation/AnimInstance.h"
+#include "Structs/AnimationData.h"
 #include "PlayerAnimInstance.generated.h"
 
 DECLARE_DELEGATE(FOnEnableSwitchActionNotifyBeginDelegate);
@@ -160,6 +161,9 @@ protected:
     UFUNCTION(BlueprintPure, Category = "Character|ThreadSafe", meta = (BlueprintThreadSafe))
     EDirection CalculateLocomotionDirection(const float InAngle) const;
 
+    /** ECharacterState 의 Q / E / R / LMB / RMB 비트는 EBaseCharacterState 와 같은 위치에 있습니다. */
+    static EBaseCharacterState ToBaseCharacterState(ECharacterState InState);
+
 protected:
     // Character References
     UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Character", Meta = (AllowPrivateAccess))
@@ -168,6 +172,10 @@ protected:
     UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Character", Meta = (AllowPrivateAccess))
     TObjectPtr<class UCharacterMovementComponent> MovementComponent;
 
+    // 게임 스레드에서 복사한 캐릭터 상태. 스레드 세이프 갱신과 애님 그래프의 프로퍼티 액세스는 이 값만 읽습니다.
+    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Character|ThreadSafe", Meta = (AllowPrivateAccess))
+    FCharacterAnimSnapshot Snapshot;
+
     // Character Movement State
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Character|Anim", meta = (AllowPrivateAccess))
     FVector MoveInputWithMaxSpeed;
@@ -245,6 +253,11 @@ protected:
     UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Character|ThreadSafe", Meta = (AllowPrivateAccess))
     float SpeedAccelDotProduct;
 
+    // 플레이어 전용 스냅샷 값 (입력 / 조준)
+    float SnapshotForwardInput = 0.f;
+    float SnapshotRightInput = 0.f;
+    FRotator SnapshotAimRotation = FRotator::ZeroRotator;
+
     // Rotation and Timing Variables
     FRotator MovingRotation = FRotator::ZeroRotator;
     FRotator LastMovingRotation = FRotator::ZeroRotator;
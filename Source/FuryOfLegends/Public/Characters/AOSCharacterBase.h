@@ -6,6 +6,7 @@
 #include "AOSCharacterBase.generated.h"
 
 class UActionStatComponent;
+class UPeriodicEffectComponent;
 class UCharacterRotatorComponent;
 class UCharacterDataProviderBase;
 class UChampionDataProvider;
@@ -68,6 +69,8 @@ protected:
 
 public:
 	// Getters and Setters
+	UPeriodicEffectComponent* GetPeriodicEffectComponent() const { return PeriodicEffectComponent; }
+
 	float GetForwardInputValue() const { return ForwardInputValue; }
 	float GetRightInputValue()	 const { return RightInputValue; }
 	float GetAimPitchValue()	 const { return CurrentAimPitch; }
@@ -170,13 +173,13 @@ protected:
 
 protected:
 	UFUNCTION()
-	void ActivateHealthRegenTimer();
+	void ActivateHealthRegeneration();
 	UFUNCTION()
-	void ActivateManaRegenTimer();
+	void ActivateManaRegeneration();
 	UFUNCTION()
-	void DeactivateHealthRegenTimer();
+	void DeactivateHealthRegeneration();
 	UFUNCTION()
-	void DeactivateManaRegenTimer();
+	void DeactivateManaRegeneration();
 
 public:
 	// Character death
@@ -249,6 +252,9 @@ protected:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Character|Components", Meta = (AllowPrivateAccess))
 	TObjectPtr<class UCameraComponent> CameraComponent;
 
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Character|Components", Meta = (AllowPrivateAccess))
+	TObjectPtr<UPeriodicEffectComponent> PeriodicEffectComponent;
+
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Character|InputConfig", Meta = (AllowPrivateAccess))
 	TObjectPtr<class UEnhancedInputComponent> EnhancedInputComponent;
 
@@ -311,8 +317,6 @@ protected:
 
 	FTimerHandle CheckEnemyOnScreenTimer;
 	FTimerHandle TargetMaterialChangeTimer;
-	FTimerHandle HealthRegenTimer;
-	FTimerHandle ManaRegenTimer;
 
 	FRotator LastCharacterRotation;
 	FVector LastCharacterLocation;
@@ -7,6 +7,7 @@
 #include "Structs/CustomCombatData.h"
 #include "Structs/CharacterData.h"
 #include "Structs/ActionData.h"
+#include "Structs/SignificanceData.h"
 #include "CharacterBase.generated.h"
 
 class UCrowdControlEffect;
@@ -72,6 +73,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaTime) override;
 	virtual void SetupPlayerInputComponent(UInputComponent* PlayerInputComponent) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
@@ -92,7 +94,7 @@ public:
 	template<typename T>
 	T* GetOrLoadResource(TMap<FName, T*>& ResourceMap, const FName& Key, const TCHAR* Path);
 
-	float GetUniqueAttribute(EActionSlot SlotID, const FName& Key, float DefaultValue) const;
+	float GetUniqueAttribute(EActionSlot SlotID, EUniqueAttribute Attribute, float DefaultValue) const;
 	float AdjustAnimPlayRate(const float AnimLength);
 
 	UStatComponent* GetStatComponent() const;
@@ -104,6 +106,10 @@ public:
 
 	virtual void RotateWidgetToLocalPlayer();
 
+	// 중요도 단계에 따라 틱 / 애니메이션 / 위젯 / AI 갱신 주기를 조정합니다. (UArenaSignificanceSubsystem 에서 호출)
+	virtual void ApplySignificance(ESignificanceTier NewTier, const FSignificanceTierSettings& Settings);
+	ESignificanceTier GetSignificanceTier() const { return SignificanceTier; }
+
 	// ---------------   Damage-related Functions on Server   --------------- 
 
 	UFUNCTION(Server, Reliable)
@@ -130,22 +136,23 @@ protected:
 
 public:
 	// Particle and mesh spawning
+	// 화면 연출용 요청은 UCosmeticDispatcher 를 거치므로 데디케이티드 서버에서는 아무것도 만들지 않으며, 멀티캐스트는 Unreliable 로 보냅니다.
 	UFUNCTION()
 	UParticleSystemComponent* SpawnEmitterAtLocation(UParticleSystem* Particle, FTransform Transform, bool bAutoDestory = true, EPSCPoolMethod PoolingMethod = EPSCPoolMethod::None, bool bAutoActivate = true);
 
-	UFUNCTION(NetMulticast, Reliable)
+	UFUNCTION(NetMulticast, Unreliable)
 	void MulticastSpawnEmitterAtLocation(UParticleSystem* Particle, FTransform Transform, bool bAutoDestory = true, EPSCPoolMethod PoolingMethod = EPSCPoolMethod::None, bool bAutoActivate = true);
 
-	UFUNCTION(Server, Reliable)
+	UFUNCTION(Server, Unreliable)
 	void ServerSpawnEmitterAttached(UParticleSystem* Particle, USceneComponent* AttachToComponent, FTransform Transform, EAttachLocation::Type LocationType);
 
-	UFUNCTION(NetMulticast, Reliable)
+	UFUNCTION(NetMulticast, Unreliable)
 	void MulticastSpawnEmitterAttached(UParticleSystem* Particle, USceneComponent* AttachToComponent, FTransform Transform, EAttachLocation::Type LocationType);
 
-	UFUNCTION(Server, Reliable)
+	UFUNCTION(Server, Unreliable)
 	void ServerSpawnMeshAttached(UStaticMesh* MeshToSpawn, USceneComponent* AttachToComponent, float Duration);
 
-	UFUNCTION(NetMulticast, Reliable)
+	UFUNCTION(NetMulticast, Unreliable)
 	void MulticastSpawnMeshAttached(UStaticMesh* MeshToSpawn, USceneComponent* AttachToComponent, float Duration);
 
 	UFUNCTION(Server, Reliable)
@@ -293,6 +300,9 @@ public:
 	UFUNCTION()
 	virtual void RMB_CheckHit() {};
 
+	/** 근접 트레이스(UANS_CheckHit)가 한 번의 갱신에서 새로 맞힌 대상을 한꺼번에 전달합니다. 서버에서만 호출됩니다. */
+	virtual void OnMeleeTraceHit(EActionSlot SlotID, const TArray<FHitResult>& HitResults) {};
+
 public:
 	FOnPreApplyDamageDelegate OnPreApplyDamageEvent;
 	FOnReceiveDamageEnteredDelegate OnReceiveDamageEnteredEvent;
@@ -344,6 +354,9 @@ public:
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadWrite, Category = "Character|GamePlay")
 	EObjectType ObjectType;
 
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Character|Significance")
+	ESignificanceTier SignificanceTier;
+
 public: // 서버에서 처리
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Character|GamePlay", meta = (AllowPrivateAccess))
 	UCrowdControlManager* CrowdControlManager;
@@ -23,4 +23,8 @@ protected:
 	virtual void MontageEnded(UAnimMontage* Montage, bool bInterrupted) override;
 	virtual void LMB_Executed() override;
 	virtual void LMB_CheckHit() override;
+	virtual void OnMeleeTraceHit(EActionSlot SlotID, const TArray<FHitResult>& HitResults) override;
+
+private:
+	FDamageInformation MakeAttackDamageInformation() const;
 };
@@ -106,6 +106,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion|GamePlay", Meta = (ClampMin = "0.0", UIMin = "0.0", AllowPrivateAccess = "true"))
 	float ChaseThreshold;
 
+	//  ̺ ȣ ( ̺ ȸ)
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Minion|GamePlay", Meta = (AllowPrivateAccess = "true"))
+	int32 SpawnWave;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion|GamePlay", Meta = (ClampMin = "0.0", UIMin = "0.0", AllowPrivateAccess = "true"))
 	float FadeOutDuration;
 
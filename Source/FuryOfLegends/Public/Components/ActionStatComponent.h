@@ -128,7 +128,7 @@ public:
 
 	FActiveActionState& GetActiveActionState(EActionSlot SlotID);
 	const FActionAttributes& GetActionAttributes(EActionSlot SlotID) const;
-	float GetUniqueValue(EActionSlot SlotID, const FName& InKey, float DefaultValue);
+	float GetUniqueValue(EActionSlot SlotID, EUniqueAttribute Attribute, float DefaultValue) const;
 	bool IsActionReady(EActionSlot SlotID) const;
 	TArray<FActiveActionState*> GetActiveActionStatePtrs();
 
@@ -178,7 +178,24 @@ private:
 	void UpdateUpgradableStatus(EActionSlot SlotID, FActiveActionState& ActiveActionState, int32 InNewCurrentLevel);
 
 	const FAction* GetAction(EActionSlot SlotID, const int32 InLevel) const;
-	float GetUniqueValue(EActionSlot SlotID, const FName& InKey);
+
+	static int32 GetSlotIndex(EActionSlot SlotID);
+	void ResolveUniqueAttributes(EActionSlot SlotID, const TArray<FActionAttributes>& ActionAttributesSlot);
+
+	UFUNCTION()
+	void OnRep_ActionAttributes_Q();
+
+	UFUNCTION()
+	void OnRep_ActionAttributes_E();
+
+	UFUNCTION()
+	void OnRep_ActionAttributes_R();
+
+	UFUNCTION()
+	void OnRep_ActionAttributes_LMB();
+
+	UFUNCTION()
+	void OnRep_ActionAttributes_RMB();
 
 	UPROPERTY(Transient, VisibleAnywhere, Category = "Components")
 	TObjectPtr<class UAOSGameInstance> GameInstance;
@@ -202,19 +219,19 @@ public:
 	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
 	FActiveActionState ActiveActionState_RMB;
 
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
+	UPROPERTY(ReplicatedUsing = OnRep_ActionAttributes_Q, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
 	TArray<FActionAttributes> ActionAttributes_Q;
 
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
+	UPROPERTY(ReplicatedUsing = OnRep_ActionAttributes_E, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
 	TArray<FActionAttributes> ActionAttributes_E;
 
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
+	UPROPERTY(ReplicatedUsing = OnRep_ActionAttributes_R, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
 	TArray<FActionAttributes> ActionAttributes_R;
 
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
+	UPROPERTY(ReplicatedUsing = OnRep_ActionAttributes_LMB, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
 	TArray<FActionAttributes> ActionAttributes_LMB;
 
-	UPROPERTY(Replicated, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
+	UPROPERTY(ReplicatedUsing = OnRep_ActionAttributes_RMB, EditAnywhere, BlueprintReadOnly, Category = "Action", meta = (AllowPrivateAccess = "true"))
 	TArray<FActionAttributes> ActionAttributes_RMB;
 
 private:
@@ -225,6 +242,10 @@ private:
 
 	TArray<float*> ReduceValue;
 
+	// 슬롯별 (Q, E, R, LMB, RMB) 현재 레벨의 인스턴스마다 EUniqueAttribute 로 펼친 고유 속성
+	static constexpr int32 NumActionSlots = 5;
+	TArray<FUniqueAttributeSet> ResolvedUniqueAttributes[NumActionSlots];
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components", Meta = (AllowPrivateAccess))
 	UDataTable* StatTable;
 };
\ No newline at end of file
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "CosmeticAnimationComponent.generated.h"
+
+class USceneComponent;
+class UParticleSystemComponent;
+
+
+/**
+ * 일정한 속도로 회전시키는 장식용 컴포넌트 하나.
+ */
+struct FCosmeticRotator
+{
+	TWeakObjectPtr<USceneComponent> Component;
+	FRotator RotationRate = FRotator::ZeroRotator;
+};
+
+
+/**
+ * 파티클의 벡터 파라미터를 대상 액터의 위치로 맞추는 항목. (빔 끝점 등)
+ * 대상은 매 틱 TargetGetter 로 가져오며, 대상이 없으면 파라미터를 건드리지 않습니다.
+ */
+struct FCosmeticParticleTracker
+{
+	TWeakObjectPtr<UParticleSystemComponent> Particle;
+	FName ParameterName;
+	TFunction<AActor*()> TargetGetter;
+};
+
+
+/**
+ * 화면에만 보이는 액터 애니메이션을 액터 Tick 대신 처리하는 클라이언트 전용 컴포넌트.
+ *
+ * 데디케이티드 서버에서는 틱을 켜지 않으므로 소유 액터의 서버 틱에는 게임플레이 로직만 남습니다.
+ * 등록된 항목이 없거나 소유 액터가 최근에 렌더링되지 않았다면 아무것도 하지 않습니다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class FURYOFLEGENDS_API UCosmeticAnimationComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UCosmeticAnimationComponent();
+
+	virtual void BeginPlay() override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+public:
+	void AddRotator(USceneComponent* Component, const FRotator& RotationRate);
+	void AddParticleTracker(UParticleSystemComponent* Particle, const FName& ParameterName, TFunction<AActor*()>&& TargetGetter);
+
+	// 모든 장식 애니메이션을 멈춥니다. (파괴 연출 이후 등)
+	void StopAll();
+
+private:
+	void UpdateTickEnabled();
+	bool ShouldAnimate() const;
+
+private:
+	// 소유 액터가 이 시간 안에 렌더링되지 않았다면 이번 틱을 건너뜁니다. 0 이하면 항상 갱신합니다.
+	UPROPERTY(EditDefaultsOnly, Category = "Cosmetic", Meta = (AllowPrivateAccess = "true"))
+	float RenderedTolerance = 0.2f;
+
+	TArray<FCosmeticRotator> Rotators;
+	TArray<FCosmeticParticleTracker> ParticleTrackers;
+
+	bool bStopped = false;
+};
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Components/StatComponent.h"
+#include "Structs/MinionData.h"
 #include "MinionStatComponent.generated.h"
 
 /**
@@ -19,9 +20,11 @@ public:
 
     virtual void InitStatComponent(UDataTable* InStatTable) override;
 
+    // AArenaGameMode 가 미리 계산한 성장 테이블에서 스폰 웨이브의 스탯을 조회해 초기화합니다.
+    void InitStatComponent(UDataTable* InStatTable, const FMinionGrowthTable& GrowthTable, int32 SpawnWave);
+
 private:
-    void UpdateStatsBasedOnElapsedTime(const FName& RowName);
-    void UpdateStatsBasedOnElapsedTime(const float InElapsedTime);
+    void ApplyBaseStats(const FStatTableRow& BaseStats, const FMinionWaveStats& WaveStats);
 
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Time", meta = (AllowPrivateAccess))
     float ElapsedTime;
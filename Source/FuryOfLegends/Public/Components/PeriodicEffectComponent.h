@@ -0,0 +1,158 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "PeriodicEffectComponent.generated.h"
+
+class AArenaPlayerState;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPeriodicEffectRemovedDelegate, uint32 /*SourceCode*/);
+
+
+UENUM(BlueprintType)
+enum class EPeriodicEffectType : uint8
+{
+	Heal,		// 틱마다 체력 회복
+	Mana,		// 틱마다 마나 회복
+	Damage,		// 틱마다 마법 피해
+	Buff		// 틱 없이 지속 시간만 관리 (만료 시 OnEffectRemoved 로 알림)
+};
+
+UENUM(BlueprintType)
+enum class EPeriodicEffectStacking : uint8
+{
+	Refresh,	// 같은 출처가 다시 들어오면 지속 시간만 처음부터 다시 시작합니다.
+	Queue,		// 중첩을 쌓아 두고, 현재 효과가 끝나면 다음 중첩을 이어서 진행합니다. (포션)
+	Intensify	// 중첩 수만큼 틱 수치를 곱하고 지속 시간을 다시 시작합니다.
+};
+
+
+/**
+ * 주기 효과 하나를 거는 데 필요한 값.
+ * SourceCode 는 HUD 타이머와 같은 UniqueCode 를 쓰며, 같은 SourceCode 끼리 중첩 / 갱신됩니다.
+ */
+struct FPeriodicEffectSpec
+{
+	uint32 SourceCode = 0;
+	EPeriodicEffectType Type = EPeriodicEffectType::Heal;
+	EPeriodicEffectStacking Stacking = EPeriodicEffectStacking::Refresh;
+
+	// 한 틱에 적용되는 수치. Buff 는 사용하지 않습니다.
+	float AmountPerTick = 0.f;
+	float TickInterval = 0.5f;
+	float Duration = 0.f;
+	int32 MaxStacks = 1;
+
+	// Damage 효과의 가해자
+	TWeakObjectPtr<AActor> Instigator;
+};
+
+
+/**
+ * 서버에서 진행 중인 주기 효과 기록.
+ */
+struct FPeriodicEffect
+{
+	FPeriodicEffectSpec Spec;
+
+	int32 Stacks = 0;
+	int32 RemainingTicks = 0;
+	float StartTime = 0.f;
+	float EndTime = 0.f;
+	float NextTickTime = 0.f;
+};
+
+
+/**
+ * 클라이언트에 복제되는 효과 요약.
+ * 적용 / 갱신 / 만료 시점에만 바뀌며, 남은 시간은 클라이언트가 서버 시간으로 직접 계산합니다.
+ */
+USTRUCT()
+struct FPeriodicEffectTimer
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	uint32 SourceCode = 0;
+
+	UPROPERTY()
+	float StartTime = 0.f;
+
+	UPROPERTY()
+	float EndTime = 0.f;
+
+	UPROPERTY()
+	int32 Stacks = 0;
+};
+
+
+/**
+ * 캐릭터에 걸린 회복 / 마나 / 지속 피해 / 버프를 하나의 배열로 관리하는 컴포넌트.
+ *
+ * 효과마다 타이머나 람다를 만들지 않고, 효과가 하나라도 있을 때만 도는 타이머 하나가
+ * ProcessInterval 간격으로 모든 효과를 한 번에 처리합니다.
+ * 소유 클라이언트는 복제된 종료 시간으로 남은 시간을 계산해 PlayerState 의 HUD 타이머 델리게이트로 전달합니다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class FURYOFLEGENDS_API UPeriodicEffectComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPeriodicEffectComponent();
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	// 서버 전용. 중첩 한도에 막혀 적용하지 못하면 false 를 반환합니다.
+	bool AddEffect(const FPeriodicEffectSpec& Spec);
+	void RemoveEffect(const uint32 SourceCode);
+	void ClearEffects();
+
+	int32 GetStacks(const uint32 SourceCode) const;
+	bool HasEffect(const uint32 SourceCode) const { return GetStacks(SourceCode) > 0; }
+
+	// 효과가 만료되거나 제거될 때 서버에서 호출됩니다.
+	FOnPeriodicEffectRemovedDelegate OnEffectRemoved;
+
+private:
+	void ProcessEffects();
+	void ApplyTick(const FPeriodicEffect& Effect) const;
+	void StartApplication(FPeriodicEffect& Effect, const float Now) const;
+
+	void UpdateProcessTimer();
+	void SyncReplicatedEffects();
+
+	UFUNCTION()
+	void OnRep_ReplicatedEffects();
+
+	void BroadcastRemainingTimes();
+
+	float GetServerTime() const;
+	AArenaPlayerState* GetOwnerPlayerState() const;
+	bool IsOwnerLocallyControlled() const;
+
+private:
+	// 서버에서 모든 효과를 처리하는 간격
+	UPROPERTY(EditDefaultsOnly, Category = "PeriodicEffect", Meta = (AllowPrivateAccess = "true", ClampMin = "0.05"))
+	float ProcessInterval = 0.25f;
+
+	// 소유 클라이언트가 HUD 남은 시간을 갱신하는 간격
+	UPROPERTY(EditDefaultsOnly, Category = "PeriodicEffect", Meta = (AllowPrivateAccess = "true", ClampMin = "0.05"))
+	float DisplayInterval = 0.1f;
+
+	TArray<FPeriodicEffect> ActiveEffects;
+
+	UPROPERTY(ReplicatedUsing = OnRep_ReplicatedEffects, Transient)
+	TArray<FPeriodicEffectTimer> ReplicatedEffects;
+
+	// HUD 에 마지막으로 알린 중첩 수. 복제 전후를 비교해 바뀐 항목만 알립니다.
+	TMap<uint32, int32> NotifiedStacks;
+
+	FTimerHandle ProcessTimerHandle;
+	FTimerHandle DisplayTimerHandle;
+};
@@ -65,6 +65,7 @@ public:
 	virtual void InitializeComponent() override;
 	virtual void InitStatComponent(UDataTable* InStatTable);
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override; 
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	void RecalculateStats();
 public:
@@ -87,9 +88,9 @@ public:
 
 	// Getter functions for Current Stats
 	float GetMaxHP() const { return MaxHP; }
-	float GetCurrentHP() const { return CurrentHP; }
+	float GetCurrentHP() const;
 	float GetMaxMP() const { return MaxMP; }
-	float GetCurrentMP() const { return CurrentMP; }
+	float GetCurrentMP() const;
 	float GetMaxEXP() const { return MaxEXP; }
 	float GetCurrentEXP() const { return CurrentEXP; }
 	int32 GetCurrentLevel() const { return CurrentLevel; }
@@ -161,6 +162,13 @@ public:
 	virtual void SetCriticalChance(int32 InCriticalChance);
 	virtual void SetMovementSpeed(float InMovementSpeed);
 
+	// ü /    ۰ .  Դϴ.
+	void SetHealthRegenerationActive(bool bActive);
+	void SetManaRegenerationActive(bool bActive);
+
+	bool IsHealthRegenerationActive() const { return HealthRegenAnchorTime >= 0.f; }
+	bool IsManaRegenerationActive() const { return ManaRegenAnchorTime >= 0.f; }
+
 #pragma endregion
 
 public:
@@ -197,6 +205,22 @@ protected:
 	UFUNCTION()
 	void OnRep_CharacterStatReplicated();
 
+	UFUNCTION()
+	void OnRep_RegenerationAnchor();
+
+	// ݱ   尪 ݿϰ  ð  űϴ.
+	void MaterializeHealth();
+	void MaterializeMana();
+
+	//  .  ִġ  ð  Ȯϰ OnHealthFull / OnManaFull   Ÿ̸Ӹ ϴ.
+	void UpdateHealthFullTimer();
+	void UpdateManaFullTimer();
+	void OnHealthRegenerationSaturated();
+	void OnManaRegenerationSaturated();
+
+	void UpdateRegenerationTick();
+	float GetServerWorldTime() const;
+
 	UFUNCTION(NetMulticast, Reliable)
 	void OnOutOfCurrentHP_NetMulticast();
 
@@ -323,6 +347,28 @@ protected:
 	UPROPERTY(Replicated, Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Character|Stat", Meta = (AllowPrivateAccess))
 	float HealthRegeneration;
 
+	/**
+	 *  ۵(Ǵ  尪 ݿ)   ð.   ʽϴ.
+	 *  ü CurrentHP + HealthRegeneration * ( -  ð)  ϹǷ,
+	 *  Ͼ ȿ ƹ͵  ʽϴ.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_RegenerationAnchor, Transient, VisibleInstanceOnly, Category = "Character|Stat", Meta = (AllowPrivateAccess))
+	float HealthRegenAnchorTime = -1.f;
+
+	UPROPERTY(ReplicatedUsing = OnRep_RegenerationAnchor, Transient, VisibleInstanceOnly, Category = "Character|Stat", Meta = (AllowPrivateAccess))
+	float ManaRegenAnchorTime = -1.f;
+
+	// Ŭ̾Ʈ   ٸ ϴ 
+	UPROPERTY(EditDefaultsOnly, Category = "Character|Stat", Meta = (AllowPrivateAccess, ClampMin = "0.02"))
+	float RegenerationDisplayInterval = 0.1f;
+
+	//  UI  ˸ .    ſ ϴ.
+	float DisplayedHP = 0.f;
+	float DisplayedMP = 0.f;
+
+	FTimerHandle HealthFullTimerHandle;
+	FTimerHandle ManaFullTimerHandle;
+
 	UPROPERTY(Replicated, Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Character|Stat", Meta = (AllowPrivateAccess))
 	float ManaRegeneration;
 
@@ -0,0 +1,100 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "UObject/ObjectKey.h"
+#include "StructureTargetingComponent.generated.h"
+
+class ACharacterBase;
+struct FDamageInformation;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnAggroTargetRequestedDelegate, ACharacterBase* /*Attacker*/);
+
+
+/**
+ * 구조물 공격 우선순위. 값이 작을수록 먼저 공격합니다.
+ */
+UENUM(BlueprintType)
+enum class EStructureTargetPriority : uint8
+{
+	SuperMinion,
+	MeleeMinion,
+	RangedMinion,
+	Champion,
+	Count		UMETA(Hidden)
+};
+
+
+/**
+ * 사거리 안의 후보 하나. 진입 시점의 거리로 정렬합니다.
+ */
+struct FStructureTargetCandidate
+{
+	TWeakObjectPtr<ACharacterBase> Character;
+	TObjectKey<ACharacterBase> Key;
+	float EntryDistanceSquared = 0.f;
+};
+
+
+/**
+ * 넥서스 / 포탑 같은 구조물의 타겟 후보를 관리하는 컴포넌트.
+ *
+ * 후보는 오버랩 진입 / 이탈 시점에 한 번만 분류되어 우선순위 버킷에 들어가며,
+ * 각 버킷은 진입 시점의 거리 순으로 유지됩니다. 비어 있지 않은 버킷을 비트마스크로 들고 있어
+ * SelectTarget 은 가장 높은 우선순위 버킷의 맨 앞 후보를 바로 꺼냅니다.
+ *
+ * 사거리 안의 아군 챔피언이 적 챔피언에게 공격받으면 OnAggroTargetRequested 로 공격자를 알립니다.
+ */
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class FURYOFLEGENDS_API UStructureTargetingComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UStructureTargetingComponent();
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+public:
+	// 오버랩 진입 시 호출합니다. 타겟 후보가 될 적이면 true 를 반환합니다.
+	bool AddCharacter(ACharacterBase* Character);
+
+	// 오버랩 이탈 시 호출합니다.
+	void RemoveCharacter(ACharacterBase* Character);
+
+	void Reset();
+
+	// 가장 우선순위가 높은 후보. 이미 사라졌거나 죽은 후보는 이때 정리합니다.
+	ACharacterBase* SelectTarget();
+
+	bool IsEnemyInRange(const ACharacterBase* Character) const;
+	bool IsAllyInRange(const ACharacterBase* Character) const;
+	int32 GetNumEnemies() const { return EnemyPriorities.Num(); }
+
+	FOnAggroTargetRequestedDelegate OnAggroTargetRequested;
+
+private:
+	UFUNCTION()
+	void OnAllyDamaged(AActor* DamageReceiver, AActor* DamageCauser, AController* InstigatorActor, FDamageInformation& DamageInformation);
+
+	bool ClassifyEnemy(const ACharacterBase* Character, EStructureTargetPriority& OutPriority) const;
+	bool IsTargetable(const ACharacterBase* Character) const;
+
+	void RemoveFromBucket(ACharacterBase* Character, EStructureTargetPriority Priority);
+	void UnbindAlly(ACharacterBase* Ally);
+
+private:
+	static constexpr int32 NumBuckets = static_cast<int32>(EStructureTargetPriority::Count);
+
+	TArray<FStructureTargetCandidate> Buckets[NumBuckets];
+
+	// 비어 있지 않은 버킷의 비트. 가장 낮은 비트가 가장 높은 우선순위입니다.
+	uint32 NonEmptyBucketMask = 0;
+
+	TMap<TObjectKey<ACharacterBase>, EStructureTargetPriority> EnemyPriorities;
+
+	// 공격받았는지 감시 중인 아군
+	TMap<TObjectKey<ACharacterBase>, TWeakObjectPtr<ACharacterBase>> AlliesInRange;
+};
@@ -31,6 +31,10 @@ public:
 	virtual void PauseAI(const FString& Reason);
 	virtual void ResumeAI(const FString& Reason);
 
+	// 중요도 단계에 따라 비헤이비어 트리 서비스 주기에 곱해지는 값 (UBTService_SignificanceBase)
+	void SetServiceIntervalScale(float InScale);
+	float GetServiceIntervalScale() const { return ServiceIntervalScale; }
+
 public:
 	static const FName RangeKey;
 	static const FName DetectRangeKey;
@@ -48,4 +52,7 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "BaseAIController", meta = (AllowPrivateAccess))
 	TObjectPtr<class UBehaviorTree> BehaviorTree;
+
+	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "BaseAIController", meta = (AllowPrivateAccess))
+	float ServiceIntervalScale;
 };
@@ -18,7 +18,11 @@ class ACharacterBase;
 class AAOSCharacterBase;
 class APlayerStart;
 class ANexus;
-class AItem;
+class UItemRegistry;
+struct FItemDefinition;
+class UMinionWaveSpawner;
+class UMatchStartBarrier;
+struct FMinionSpawnRequest;
 
 USTRUCT(BlueprintType)
 struct FPlayerInformation
@@ -77,7 +81,6 @@ public:
 	virtual void PlayerLoaded(APlayerController* PlayerController);
 	virtual void PlayerPawnReady(AAOSCharacterBase* PlayerCharacter);
 	
-	void ActivateCurrencyIncrement();
 	void ActivateSpawnMinion();
 	void RequestRespawn(const int32 PlayerIndex);
 
@@ -86,23 +89,28 @@ public:
 
 	TArray<FItemTableRow> GetLoadedItems() const;
 	int32 GetInitialCharacterLevel() const { return InitialCharacterLevel; };
+	const FItemDefinition* FindItemDefinition(int32 ItemCode) const;
 	const TMap<int32, int32>* GetSubItemsForItem(int32 ItemCode) const;
+	const FMinionGrowthTable* FindMinionGrowthTable(EMinionType MinionType) const;
 
 private:
 	void LoadGameData();
 	void LoadItemData();
 	void LoadMinionData();
-	void GenerateSubItem(int32 ItemCode);
 
-	void SpawnMinionsForLane(ELaneType Lane);
-	void SpawnMinion(EMinionType MinionType, ELaneType Lane, ETeamSide Team);
+	void QueueMinionWave();
+	void BuildLaneWaveRequests(ELaneType Lane, double WaveStartTime, TArray<FMinionSpawnRequest>& OutRequests) const;
+	void ExecuteMinionSpawn(const FMinionSpawnRequest& Request);
+	void SpawnMinion(EMinionType MinionType, ELaneType Lane, ETeamSide Team, int32 Wave);
 	void SpawnCharacter(AAOSPlayerController* PlayerController, const FName& ChampionRowName, ETeamSide Team, const int32 PlayerIndex);
 	void RespawnCharacter(const int32 PlayerIndex);
 
-	void CheckAllPlayersLoaded();
+	void HandleMatchStartBarrierReleased();
+	void HandleLatePlayerReady(int32 PlayerIndex);
+	void HandlePlayerLoadStageChanged(int32 PlayerIndex, EPlayerLoadStage NewStage);
+	void StartPlayer(const FPlayerInformation& PlayerInfo);
 	void FindPlayerStart();
 	void FindTaggedActors(FName PrimaryTag, TMap<FName, AActor*>& TargetMap);
-	void IncrementPlayerCurrency();
 	float CalculateRespawnTime(AAOSCharacterBase* Character) const;
 
 private:
@@ -167,21 +175,31 @@ public:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
 	TMap<EMinionType, FMinionAttributesRow> MinionsData;
 
+	// 매치 시작 시 미리 계산한 미니언 종류별 웨이브 성장 테이블
+	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
+	TMap<EMinionType, FMinionGrowthTable> MinionGrowthTables;
+
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
 	FGameDataTableRow GameplayConfig;
 
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
 	TMap<FName, AActor*> MinionPaths;
 
-	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
-	TMap<int32, AItem*> LoadedItems;
+	// ItemCode -> 아이템 정의. 아이템 액터를 만들지 않고 동작(CDO)과 테이블 행만 등록합니다.
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UItemRegistry> ItemRegistry;
 
-	/**  ItemCode -> (SubItemCode -> RequiredCount) */
-	TMap<int32, TMap<int32, int32>> RequiredSubItems;
+	// 모든 플레이어의 로딩 완료 이벤트를 모아 매치 시작 시점을 결정
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UMatchStartBarrier> MatchStartBarrier;
+
+	// 모든 라인의 웨이브 스폰을 프레임 예산 안에서 나눠 처리
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Gameplay", Meta = (AllowPrivateAccess = "true"))
+	TObjectPtr<UMinionWaveSpawner> MinionWaveSpawner;
 	
 private:
 	float MaxEndWaitTimer = 20.f;
-	float MaxLoadWaitTime = 30.f;
+	float MaxLoadWaitTime = 30.f; // 플레이어별 로딩 제한 시간
 	uint8 NumberOfPlayer = 0; // 게임 내 플레이어 수
 	uint8 ConnectedPlayer = 0; // 접속한 플레이어 수
 	int32 InitialCharacterLevel = 1;
@@ -189,14 +207,16 @@ private:
 	TMap<FName, AActor*> OrientationPoints;
 	TMap<FName, APlayerStart*> PlayerStarts;
 
+	// 미니언마다 같은 값이므로 한 번만 만들어 복사합니다. <인원 수, 경험치 배율>
+	TMap<int32, float> MinionShareFactor;
+
 	TMap<uint32, FTimerHandle> TimerHandles;				// <PlayerIndex, TimerHandle>
 	TMap<uint32, FTimerHandle> BroadcastTimerHandles;	// <PlayerIndex, TimerHandle>
 
-	FTimerHandle AddCurrencyTimerHandle;
 	FTimerHandle SpawnMinionTimerHandle;
-	FTimerHandle LoadTimerHandle;
 
 	int32 SpawnCount = 0;
+	int32 NumBakedMinionWaves = 60; // 이후 웨이브는 같은 식으로 바로 계산
 	bool bHasNexusDestroyed = false;
 
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "CrowdControl", meta = (AllowPrivateAccess = "true"))
@@ -3,10 +3,15 @@
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerState.h"
 #include "Structs/CharacterData.h"
+#include "Structs/GameData.h"
+#include "Structs/CustomCombatData.h"
+#include "Item/InventoryList.h"
+#include "Item/ItemInstance.h"
 #include "ArenaPlayerState.generated.h"
 
-class AItem;
 class AArenaGameMode;
+class AAOSCharacterBase;
+struct FItemDefinition;
 
 
 USTRUCT()
@@ -50,9 +55,9 @@ public:
 	{
 	}*/
 
-	FRemovedItemData() : ItemCode(-1), RemovedCount(0), ItemInstance(nullptr) {}
-	FRemovedItemData(int32 InItemCode, int32 InRemovedCount, AItem* InItemInstance)
-		: ItemCode(InItemCode), RemovedCount(InRemovedCount), ItemInstance(InItemInstance)
+	FRemovedItemData() : ItemCode(-1), RemovedCount(0), InstanceId(0) {}
+	FRemovedItemData(int32 InItemCode, int32 InRemovedCount, int32 InInstanceId)
+		: ItemCode(InItemCode), RemovedCount(InRemovedCount), InstanceId(InInstanceId)
 	{
 	}
 
@@ -62,8 +67,37 @@ public:
 	UPROPERTY()
 	int32 RemovedCount;
 
+	// 슬롯이 비워졌을 때 같은 인스턴스로 복원하기 위한 ID
 	UPROPERTY()
-	AItem* ItemInstance;
+	int32 InstanceId;
+};
+
+/**
+ * 패시브 골드 수입. 현재 골드 = BaseAmount + floor((서버 시간 - Epoch) * Rate)
+ * 시간에 따른 증가는 각 머신에서 계산하고, 처치 / 구매 등 이벤트가 있을 때만 값이 바뀌어 복제됩니다.
+ */
+USTRUCT()
+struct FPassiveIncome
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 BaseAmount = 0;
+
+	// 초당 골드
+	UPROPERTY()
+	float Rate = 0.f;
+
+	// 수입이 시작된 서버 월드 시간
+	UPROPERTY()
+	double Epoch = 0.0;
+
+	int32 Evaluate(double ServerTime) const
+	{
+		const double Accrued = Rate > 0.f ? FMath::Max(ServerTime - Epoch, 0.0) * Rate : 0.0;
+		return BaseAmount + FMath::FloorToInt32(Accrued);
+	}
 };
 
 USTRUCT()
@@ -99,6 +133,8 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnRemainingTimeChangedDelegate,
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnWidgetStateChangedDelegate, uint32, UniqueCode, const FWidgetState&, WidgetState);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLoadStageChangedDelegate, AArenaPlayerState*, PlayerState, EPlayerLoadStage, NewStage);
+
 
 
 UCLASS()
@@ -134,29 +170,43 @@ public:
 	FName GetChosenChampionName() const { return ChosenChampionName; }
 	void SetChosenChampionName(const FName& NewChampionName) { ChosenChampionName = NewChampionName; }
 
-	int32 GetCurrency() const { return Currency; }
-	void SetCurrency(int32 NewCurrency) { Currency = NewCurrency; }
+	EPlayerLoadStage GetLoadStage() const { return LoadStage; }
+	void SetLoadStage(EPlayerLoadStage NewLoadStage);
+
+	int32 GetCurrency() const;
+	void SetCurrency(int32 NewCurrency);
 	void AddCurrency(const int32 Amount);
 
+	/** 초당 GoldPerSecond 의 패시브 수입을 시작합니다. 이미 쌓인 골드는 유지됩니다. */
+	void StartPassiveIncome(float GoldPerSecond);
+
 
 
 	/** ------------------------------------------------------ Inventory Management ------------------------------------------------------ */
 
 public:
 	void RemoveItemFromInventory(int32 ItemCode);
-	void BindItemToPlayer(AItem* Item);
+	void BindItemToPlayer(int32 SlotIndex);
 	void SwapItemsInInventory(int32 Index1, int32 Index2);
 
 	/** 최대 소지 한도 확인 */
-	bool ExceedsMaxPossession(const AItem* ItemCode) const;
+	bool ExceedsMaxPossession(const FItemDefinition& Definition) const;
 
 	// 현재 아이템 개수 반환
 	int32 GetItemTotalCount(const int32 ItemCode) const;
 
-	AItem* FindOrDuplicateItem(const AItem* OriginalItem);
-	void MoveItemToPendingDeletion(int32 ItemCode);
-	AItem* FindItemInPendingDeletion(int32 ItemCode);
-	void CheckExpiredItems();
+	/** ItemCode 별 효과 상태. 슬롯이 비어도 진행 중인 효과(포션, 재사용 대기)는 유지됩니다. */
+	FItemEffectState& FindOrAddItemEffect(int32 ItemCode) { return ItemEffects.FindOrAdd(ItemCode); }
+	FItemEffectState* FindItemEffect(int32 ItemCode) { return ItemEffects.Find(ItemCode); }
+
+	/** 아이템의 재사용 대기 종료 시간(서버 월드 시간)을 기록하고 인벤토리 복제 정보에 반영합니다. */
+	void SetItemCooldownEnd(int32 ItemCode, float EndTime);
+
+	/** 복제되는 종료 시각의 기준 시간. 게임 스테이트의 서버 월드 시간을 사용합니다. */
+	double GetServerTime() const;
+
+	/** FInventoryList 복제 콜백에서 호출됩니다. ItemCode 가 -1 이면 빈 슬롯입니다. */
+	void HandleInventorySlotReplicated(int32 SlotIndex, int32 ItemCode, int32 Stack);
 
 	UFUNCTION(BlueprintCallable, Category = "Player")
 	void UseItem(int32 Index);
@@ -164,14 +214,34 @@ public:
 	UFUNCTION(Server, Reliable, WithValidation, BlueprintCallable, Category = "Player")
 	void ServerPurchaseItem(const int32 ItemCode);
 
-	UFUNCTION(Client, Reliable)
-	void ClientInventoryChanged(const int32 InventortIndex, const int32 ItemCode, const int32 CurrentStack);
-
 	UFUNCTION(Client, Reliable)
 	void ClientNotifyItemPurchased(const int32 ItemCode, const bool bSucessful);
 
 private:
-	bool ProcessPurchaseTransaction(AItem* ItemToPurchase, FInventoryTransactionLog& TransactionLog);
+	void SyncInventorySlot(int32 SlotIndex);
+
+	const FItemDefinition* FindItemDefinition(int32 ItemCode) const;
+	AAOSCharacterBase* GetOwningCharacter() const;
+	void BindItemEventsToCharacter(AAOSCharacterBase* Character);
+	void RemoveItemStats(FItemInstance& Instance);
+
+	// 소유 캐릭터 이벤트를 인벤토리의 아이템 정의로 전달합니다.
+	UFUNCTION()
+	void OnOwnerHit(FDamageInformation& DamageInformation);
+
+	UFUNCTION()
+	void OnOwnerAttack(FDamageInformation& DamageInformation);
+
+	UFUNCTION()
+	void OnOwnerAbilityEffects(FDamageInformation& DamageInformation);
+
+	UFUNCTION()
+	void OnOwnerReceiveDamageEntered(bool& bResult);
+
+	UFUNCTION()
+	void OnOwnerPreDeath(bool& bDeath);
+
+	bool ProcessPurchaseTransaction(const FItemDefinition& ItemToPurchase, FInventoryTransactionLog& TransactionLog);
 	void RollbackTransaction(const FInventoryTransactionLog& TransactionLog);
 	FInventoryTransactionLog BeginTransaction();
 	void CommitTransaction(FInventoryTransactionLog& TransactionLog);
@@ -213,7 +283,7 @@ public:
 	float GetTimerRemaining(const uint32 UniqueCode) const;
 	float GetTimerElapsedTime(const uint32 UniqueCode) const;
 
-	UFUNCTION(Client, Unreliable)
+	UFUNCTION(Client, Reliable)
 	void ClientNotifyRemainingTime(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime);
 
 	UFUNCTION(Client, Unreliable)
@@ -234,6 +304,16 @@ public:
 	UFUNCTION()
 	void OnRep_CurrencyUpdated();
 
+private:
+	void NotifyCurrencyChanged();
+	void ScheduleCurrencyDisplayUpdate();
+	void HandleCurrencyDisplayUpdate();
+
+public:
+
+	UFUNCTION()
+	void OnRep_LoadStage();
+
 	// Delegate
 	FOnItemPurchasedDelegate OnItemPurchased;
 	FOnInventoryUpdatedDelegate OnInventoryUpdated;
@@ -243,6 +323,10 @@ public:
 
 	FOnWidgetStateChangedDelegate OnWidgetStateChanged;
 
+	// 로딩 화면이 플레이어별 진행 상황을 표시할 때 사용합니다.
+	UPROPERTY(BlueprintAssignable, Category = "Player")
+	FOnLoadStageChangedDelegate OnLoadStageChanged;
+
 public:
 	UPROPERTY(Replicated, VisibleDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
 	ETeamSide TeamSide;
@@ -261,21 +345,33 @@ private:
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Player", meta = (AllowPrivateAccess = "true"))
 	TObjectPtr<AArenaGameMode> GameMode;
 
-	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Player", meta = (AllowPrivateAccess = "true"))
-	TArray<AItem*> Inventory;
+	// 서버 인벤토리. 슬롯마다 값 기록만 가지며 아이템 동작은 게임 모드의 UItemRegistry 에서 찾습니다.
+	UPROPERTY(VisibleInstanceOnly, Category = "Player")
+	TArray<FItemInstance> Inventory;
 
-	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Player", meta = (AllowPrivateAccess = "true"))
-	TArray<AItem*> PendingDeletionItems;
+	// ItemCode -> 진행 중인 아이템 효과 (서버 전용)
+	UPROPERTY(VisibleInstanceOnly, Category = "Player")
+	TMap<int32, FItemEffectState> ItemEffects;
+
+	int32 NextItemInstanceId;
+
+	// 소유 클라이언트에 복제되는 인벤토리 요약. 서버의 Inventory 가 바뀔 때마다 SyncInventorySlot 으로 갱신합니다.
+	UPROPERTY(Replicated)
+	FInventoryList InventoryList;
 	
 	UPROPERTY(Replicated, VisibleDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
 	int32 UpgradePoints;
 
-	UPROPERTY(ReplicatedUsing = OnRep_CurrencyUpdated, VisibleDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
-	int32 Currency;
+	UPROPERTY(ReplicatedUsing = OnRep_CurrencyUpdated, VisibleDefaultsOnly, meta = (AllowPrivateAccess = "true"))
+	FPassiveIncome Income;
+
+	UPROPERTY(ReplicatedUsing = OnRep_LoadStage, VisibleDefaultsOnly, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
+	EPlayerLoadStage LoadStage;
 
 	// Timer Handles
 	TMap<uint32, FTimerHandle> TimerHandles;			// <ItemCode, TimerHandle>
-	TMap<uint32, FTimerHandle> BroadcastTimerHandles;	// <ItemCode, TimerHandle>
+	TSet<uint32> BroadcastTimerCodes;					// 클라이언트에 시작 / 종료를 알린 타이머
 
-	FTimerHandle ActivationCheckTimer;
+	// 로컬 플레이어의 골드 표시를 다음 1골드 시점에 갱신하기 위한 타이머 (복제 없음)
+	FTimerHandle CurrencyDisplayTimer;
 };
\ No newline at end of file
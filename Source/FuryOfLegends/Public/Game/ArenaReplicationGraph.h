@@ -0,0 +1,232 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "Structs/CharacterData.h"
+#include "ArenaReplicationGraph.generated.h"
+
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_ActorListFrequencyBuckets;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+class UArenaReplicationGraphNode_TeamVisionGrid;
+
+
+/**
+ * 액터 클래스별로 어떤 노드에 등록할지 결정하는 정책.
+ */
+UENUM()
+enum class EArenaClassRepNodeMapping : uint8
+{
+	NotRouted,				// 노드에 등록하지 않음 (PlayerController 등은 연결별 노드가 뷰어로 직접 수집)
+	RelevantAllConnections,	// 모든 연결에 항상 관련 (GameState, Nexus)
+	PlayerState,			// 모든 연결에 관련되지만 빈도 버킷으로 나눠서 복제
+	TeamVision,				// 팀 시야 그리드로 관련성 판단 (챔피언, 미니언, 투사체, 스플라인)
+};
+
+
+/**
+ * 서버 측 팀 시야 그리드.
+ * 아레나를 일정한 크기의 셀로 나누고, 매 복제 프레임마다 각 팀의 시야 제공자(챔피언, 미니언, 넥서스)가
+ * 밝히는 셀을 비트 배열로 기록합니다.
+ */
+struct FArenaVisionGrid
+{
+public:
+	void Initialize(const FVector2D& InOrigin, const FVector2D& InExtent, float InCellSize);
+	void ResetVision();
+	void RevealCircle(ETeamSide Team, const FVector& Location, float Radius);
+
+	int32 GetCellIndex(const FVector& Location) const;
+	FVector2D GetCellCenter(int32 CellIndex) const;
+	bool IsCellVisible(ETeamSide Team, int32 CellIndex) const;
+	bool IsLocationVisible(ETeamSide Team, const FVector& Location) const { return IsCellVisible(Team, GetCellIndex(Location)); }
+
+	int32 GetNumCells() const { return NumCellsX * NumCellsY; }
+	float GetCellSize() const { return CellSize; }
+
+private:
+	FVector2D Origin = FVector2D::ZeroVector;
+	float CellSize = 1000.f;
+	int32 NumCellsX = 0;
+	int32 NumCellsY = 0;
+
+	TBitArray<> BlueVisibleCells;
+	TBitArray<> RedVisibleCells;
+};
+
+
+/**
+ * 팀 시야 그리드 노드 (전역).
+ * 시야로 관련성을 판단하는 액터들을 추적하고, PrepareForReplication 에서 한 번만
+ * 셀별 / 팀별 액터 리스트와 팀 시야를 갱신합니다. 연결별 수집은 UArenaReplicationGraphNode_TeamVisionForConnection 이 담당합니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UArenaReplicationGraphNode_TeamVisionGrid : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	UArenaReplicationGraphNode_TeamVisionGrid();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+	virtual void NotifyResetAllNetworkActors() override;
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override {};
+
+	/** 복제 대상은 아니지만 시야를 제공하는 액터 (항상 관련 노드에 등록된 넥서스 등) */
+	void AddVisionSource(AActor* Actor);
+	void RemoveVisionSource(AActor* Actor);
+
+	/** 연결의 팀 기준으로 수집할 액터 리스트를 추가합니다. */
+	void GatherForTeam(ETeamSide ViewerTeam, const FVector& ViewLocation, bool bIncludeFarCells, FGatheredReplicationActorLists& OutGatheredLists);
+
+	static ETeamSide GetActorTeam(const AActor* Actor);
+
+public:
+	FArenaVisionGrid VisionGrid;
+
+	// 시야 반경
+	float ChampionSightRadius = 1500.f;
+	float MinionSightRadius = 1000.f;
+	float StructureSightRadius = 2000.f;
+
+	// 이 거리 밖의 셀은 원거리 버킷으로 분류되어 덜 자주 수집됩니다.
+	float NearCellRadius = 4000.f;
+
+private:
+	struct FVisionCell
+	{
+		FActorRepListRefView BlueActors;
+		FActorRepListRefView RedActors;
+		FActorRepListRefView NeutralActors;
+
+		void Reset()
+		{
+			BlueActors.Reset();
+			RedActors.Reset();
+			NeutralActors.Reset();
+		}
+	};
+
+	float GetSightRadius(const AActor* Actor) const;
+	void AddToTeamList(FVisionCell& Cell, ETeamSide Team, AActor* Actor);
+
+	// 시야 판정 대상 액터
+	TArray<AActor*> TrackedActors;
+	TArray<TWeakObjectPtr<AActor>> VisionSources;
+
+	TArray<FVisionCell> Cells;
+	TArray<int32> OccupiedCells;
+
+	// 아군 액터는 시야와 무관하게 항상 관련
+	FActorRepListRefView BlueTeamActors;
+	FActorRepListRefView RedTeamActors;
+
+	// 팀이 없는 연결(관전자 / 로비)용 전체 리스트
+	FActorRepListRefView AllActors;
+};
+
+
+/**
+ * 팀 시야 노드 (연결별).
+ * 연결의 팀과 시점 위치를 기준으로 전역 그리드에서 보이는 셀만 순회합니다.
+ * 가까운 셀은 매 프레임, 먼 셀은 FarBucketPeriod 프레임마다 한 번씩 수집하며,
+ * 연결마다 오프셋을 달리해 원거리 수집 부하를 프레임에 분산합니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UArenaReplicationGraphNode_TeamVisionForConnection : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override {};
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; };
+	virtual void NotifyResetAllNetworkActors() override {};
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+public:
+	UPROPERTY()
+	TObjectPtr<UArenaReplicationGraphNode_TeamVisionGrid> VisionGridNode;
+
+	uint32 BucketOffset = 0;
+	uint32 FarBucketPeriod = 1;
+};
+
+
+/**
+ * UArenaReplicationGraph 는 아레나의 복제 관련성을 거리 대신 팀 시야로 판단합니다.
+ *
+ * - 미니언, 챔피언, 투사체, 스플라인 액터는 팀 시야 그리드 노드에서 공간 분할되어 관리됩니다.
+ * - GameState, 넥서스는 항상 관련 노드, PlayerState 는 빈도 버킷 노드에 등록됩니다.
+ * - 연결별로 항상 관련 노드(컨트롤러 / 폰)와 팀 시야 노드를 하나씩 생성합니다.
+ *
+ * 연결별 수집 비용은 전체 액터 수가 아니라 보이는 셀의 수에 비례합니다.
+ */
+UCLASS(Transient, Config = Engine)
+class FURYOFLEGENDS_API UArenaReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	UArenaReplicationGraph();
+
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+
+private:
+	EArenaClassRepNodeMapping GetMappingPolicy(UClass* Class) const;
+	EArenaClassRepNodeMapping GetExplicitMappingPolicy(UClass* Class) const;
+	void InitClassReplicationInfo(FClassReplicationInfo& Info, UClass* Class, EArenaClassRepNodeMapping Mapping) const;
+
+public:
+	/** 아레나 그리드 영역 (XY 중심, 반 크기) */
+	UPROPERTY(Config)
+	FVector2D GridOrigin = FVector2D::ZeroVector;
+
+	UPROPERTY(Config)
+	FVector2D GridExtent = FVector2D(16000.f, 16000.f);
+
+	UPROPERTY(Config)
+	float GridCellSize = 1000.f;
+
+	UPROPERTY(Config)
+	float ChampionSightRadius = 1500.f;
+
+	UPROPERTY(Config)
+	float MinionSightRadius = 1000.f;
+
+	UPROPERTY(Config)
+	float StructureSightRadius = 2000.f;
+
+	/** 시점에서 이 거리 안의 셀은 매 프레임 수집합니다. */
+	UPROPERTY(Config)
+	float NearCellRadius = 4000.f;
+
+	/** 원거리 셀 수집 주기 (프레임). ActorChannelFrameTimeout 보다 작아야 채널이 닫히지 않습니다. */
+	UPROPERTY(Config)
+	int32 FarBucketPeriod = 2;
+
+	/** PlayerState 를 나눌 버킷 수 */
+	UPROPERTY(Config)
+	int32 NumPlayerStateBuckets = 2;
+
+private:
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorListFrequencyBuckets> PlayerStateNode;
+
+	UPROPERTY()
+	TObjectPtr<UArenaReplicationGraphNode_TeamVisionGrid> TeamVisionGridNode;
+
+	TClassMap<EArenaClassRepNodeMapping> ClassRepNodePolicies;
+
+	uint32 NextConnectionBucketOffset = 0;
+};
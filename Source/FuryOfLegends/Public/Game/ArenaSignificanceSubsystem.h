@@ -0,0 +1,83 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Structs/SignificanceData.h"
+#include "ArenaSignificanceSubsystem.generated.h"
+
+class ACharacterBase;
+
+
+/**
+ * UArenaSignificanceSubsystem 는 미니언과 NPC 의 중요도를 평가하고 단계별 갱신 주기를 적용합니다.
+ *
+ * - 클라이언트: 로컬 플레이어 시점과의 거리 + 최근 렌더링 여부로 평가합니다.
+ * - 서버: 어느 플레이어든 가장 가까운 플레이어와의 거리로 평가합니다. 서버에서는 AI 서비스 주기만 바꾸고 틱과 애니메이션은 그대로 둡니다.
+ *
+ * 등록된 캐릭터는 UpdateInterval 마다 한 번씩 평가되며, 평가는 여러 프레임에 나눠 수행됩니다.
+ * 단계가 바뀐 경우에만 ACharacterBase::ApplySignificance 를 호출합니다.
+ * Arena.Significance.Debug 1 로 캐릭터별 단계를 화면에 표시합니다.
+ */
+UCLASS(Config = Game)
+class FURYOFLEGENDS_API UArenaSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UArenaSignificanceSubsystem();
+
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	void RegisterCharacter(ACharacterBase* Character);
+	void UnregisterCharacter(ACharacterBase* Character);
+
+	const FSignificanceTierSettings& GetTierSettings(ESignificanceTier Tier) const;
+
+	/** 중요도 관리 대상인지 (미니언, 몬스터) */
+	static bool IsManagedCharacter(const ACharacterBase* Character);
+
+private:
+	void GatherViewLocations();
+	ESignificanceTier EvaluateTier(const ACharacterBase* Character, ESignificanceTier CurrentTier) const;
+
+#if !UE_BUILD_SHIPPING
+	void DrawDebugSignificance() const;
+#endif
+
+public:
+	/** 단계별 설정 (High, Medium, Low, Dormant 순서) */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	TArray<FSignificanceTierSettings> Tiers;
+
+	/** 모든 캐릭터를 한 번씩 평가하는 데 걸리는 시간 (초) */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	float UpdateInterval;
+
+	/** 강등 시 거리 임계값에 더해지는 비율. 경계에서 단계가 흔들리는 것을 막습니다. */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	float HysteresisRatio;
+
+	/** 클라이언트에서 이 시간 동안 렌더링되지 않았다면 한 단계 강등합니다. */
+	UPROPERTY(Config, EditAnywhere, Category = "Significance")
+	float NotRenderedTolerance;
+
+private:
+	struct FManagedCharacter
+	{
+		TWeakObjectPtr<ACharacterBase> Character;
+		ESignificanceTier Tier = ESignificanceTier::High;
+	};
+
+	TArray<FManagedCharacter> ManagedCharacters;
+	TArray<FVector> ViewLocations;
+
+	int32 NextEvaluateIndex;
+	float EvaluateAccumulator;
+};
@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/LineBatchComponent.h"
+#include "DebugOverlaySubsystem.generated.h"
+
+// Shipping 과 서버 빌드에서는 0 이 되어 아래 ARENA_DEBUG_* 매크로가 인자 평가까지 모두 사라집니다.
+#define ARENA_DEBUG_OVERLAY (!UE_BUILD_SHIPPING && !UE_SERVER)
+
+
+enum class EDebugOverlayCategory : uint8
+{
+	CharacterState,		// Arena.Debug.CharacterState
+	Combat,				// Arena.Debug.Combat
+	Terrain,			// Arena.Debug.Terrain
+	MAX
+};
+
+
+/**
+ * 게임플레이 코드의 디버그 출력을 모아 한 프레임에 한 번 그립니다.
+ *
+ * 분류마다 콘솔 변수(Arena.Debug.<분류>)로 켜고 끄며, 꺼진 분류는 문자열 포맷팅도 하지 않습니다.
+ * 화면 글자는 분류별로 한 메시지로 합치고, 선은 LineBatcher 에 한 번에 넘깁니다.
+ * 직접 호출하지 말고 ARENA_DEBUG_TEXT / ARENA_DEBUG_SPHERE 매크로를 사용합니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UDebugOverlaySubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UDebugOverlaySubsystem* Get(const UObject* WorldContextObject);
+	static bool IsCategoryEnabled(EDebugOverlayCategory Category);
+
+	/** 비트 플래그 열거형 값을 "A, B" 형태로 만듭니다. 디버그 출력 전용입니다. */
+	static FString DescribeFlags(const UEnum* Enum, int64 Flags);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+public:
+	/** Duration 이 0 이면 이번 프레임에만 표시합니다. */
+	void AddText(EDebugOverlayCategory Category, FString&& Text, float Duration = 0.f);
+
+	/** LifeTime 이 음수이면 지워지지 않습니다. */
+	void AddSphere(const FVector& Center, float Radius, const FColor& Color, float LifeTime = 0.f);
+
+private:
+	struct FTextLine
+	{
+		EDebugOverlayCategory Category;
+		FString Text;
+		double ExpireTime;
+	};
+
+	TArray<FTextLine> TextLines;
+	TArray<FBatchedLine> PendingLines;
+	TArray<FBatchedLine> PendingPersistentLines;
+};
+
+
+#if ARENA_DEBUG_OVERLAY
+
+#define ARENA_DEBUG_TEXT(WorldContextObject, Category, Duration, Format, ...) \
+	do \
+	{ \
+		if (UDebugOverlaySubsystem::IsCategoryEnabled(Category)) \
+		{ \
+			if (UDebugOverlaySubsystem* DebugOverlay = UDebugOverlaySubsystem::Get(WorldContextObject)) \
+			{ \
+				DebugOverlay->AddText(Category, FString::Printf(Format, ##__VA_ARGS__), Duration); \
+			} \
+		} \
+	} while (0)
+
+#define ARENA_DEBUG_SPHERE(WorldContextObject, Category, Center, Radius, Color, LifeTime) \
+	do \
+	{ \
+		if (UDebugOverlaySubsystem::IsCategoryEnabled(Category)) \
+		{ \
+			if (UDebugOverlaySubsystem* DebugOverlay = UDebugOverlaySubsystem::Get(WorldContextObject)) \
+			{ \
+				DebugOverlay->AddSphere(Center, Radius, Color, LifeTime); \
+			} \
+		} \
+	} while (0)
+
+#else
+
+#define ARENA_DEBUG_TEXT(...) do {} while (0)
+#define ARENA_DEBUG_SPHERE(...) do {} while (0)
+
+#endif
@@ -0,0 +1,67 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Structs/GameData.h"
+#include "MatchStartBarrier.generated.h"
+
+
+DECLARE_MULTICAST_DELEGATE(FOnMatchStartBarrierReleased);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnLatePlayerReady, int32 /*PlayerIndex*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnPlayerLoadStageChanged, int32 /*PlayerIndex*/, EPlayerLoadStage /*NewStage*/);
+
+
+/**
+ * UMatchStartBarrier 는 플레이어별 로딩 이벤트를 세고, 모든 플레이어가 준비되면 한 번만 OnReleased 를 호출합니다.
+ *
+ * - 플레이어는 등록 시점부터 PlayerTimeout 안에 Ready 가 되어야 하며, 넘으면 TimedOut 으로 처리되어 기다리지 않습니다.
+ * - ExpectedPlayers 가 0 이면 등록된 플레이어 수를 기준으로 합니다. (PIE 등 인원 수를 모르는 경우)
+ * - 해제 이후 준비된 플레이어(늦게 접속했거나 시간 초과 후 들어온 플레이어)는 OnLatePlayerReady 로 알립니다.
+ * - 단계가 바뀔 때마다 OnPlayerLoadStageChanged 를 호출하므로 로딩 화면은 폴링 없이 진행 상황을 표시할 수 있습니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UMatchStartBarrier : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UMatchStartBarrier();
+
+	void Initialize(int32 InExpectedPlayers, float InPlayerTimeout);
+	void Reset();
+
+	void RegisterPlayer(int32 PlayerIndex);
+	void RemovePlayer(int32 PlayerIndex);
+
+	/** 플레이어의 로딩 단계를 갱신합니다. 단계는 앞으로만 진행합니다. */
+	void AdvanceStage(int32 PlayerIndex, EPlayerLoadStage NewStage);
+
+	EPlayerLoadStage GetPlayerStage(int32 PlayerIndex) const;
+	bool IsReleased() const { return bReleased; }
+	int32 GetNumReadyPlayers() const { return NumReady; }
+
+public:
+	FOnMatchStartBarrierReleased OnReleased;
+	FOnLatePlayerReady OnLatePlayerReady;
+	FOnPlayerLoadStageChanged OnPlayerLoadStageChanged;
+
+private:
+	void SetStage(int32 PlayerIndex, EPlayerLoadStage NewStage);
+	void HandlePlayerTimeout(int32 PlayerIndex);
+	void TryRelease();
+	void ClearPlayerTimer(int32 PlayerIndex);
+
+private:
+	// 0 이면 등록된 플레이어 수를 사용
+	int32 ExpectedPlayers;
+	float PlayerTimeout;
+
+	TMap<int32, EPlayerLoadStage> PlayerStages;
+	TMap<int32, FTimerHandle> TimeoutHandles;
+
+	int32 NumReady;
+	int32 NumTimedOut;
+	bool bReleased;
+};
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Tickable.h"
+#include "Structs/MinionData.h"
+#include "Structs/CharacterData.h"
+#include "MinionWaveSpawner.generated.h"
+
+
+/**
+ * 대기열에 들어간 미니언 한 마리의 스폰 요청.
+ */
+struct FMinionSpawnRequest
+{
+	EMinionType MinionType = EMinionType::None;
+	ELaneType Lane = ELaneType::None;
+	ETeamSide Team = ETeamSide::None;
+	int32 Wave = 0;
+
+	// 이 시간(월드 시간) 이후에 스폰합니다. 웨이브 안의 간격을 유지하는 데 사용합니다.
+	double ReadyTime = 0.0;
+};
+
+DECLARE_DELEGATE_OneParam(FOnExecuteMinionSpawn, const FMinionSpawnRequest&);
+
+
+/**
+ * UMinionWaveSpawner 는 모든 라인의 미니언 스폰 요청을 하나의 대기열로 모아 프레임 예산 안에서 나눠 처리합니다.
+ *
+ * - 요청은 ReadyTime 순서로 처리되며, 예산을 넘으면 남은 요청은 다음 프레임으로 넘어갑니다.
+ * - 프레임마다 최소 한 건은 처리하므로 예산이 아주 작아도 대기열이 멈추지 않습니다.
+ * - 웨이브가 끝나면 스폰 수, 사용한 프레임 수, 총 비용, 가장 무거운 프레임, 최대 지연을 로그로 남깁니다.
+ *
+ * 서버의 AArenaGameMode 가 소유하며, 실제 스폰은 OnExecuteSpawn 으로 위임합니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UMinionWaveSpawner : public UObject, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	UMinionWaveSpawner();
+
+	void Initialize(float InFrameBudgetMs);
+
+	/** 한 웨이브의 요청을 대기열에 추가합니다. Requests 는 ReadyTime 순서여야 합니다. */
+	void EnqueueWave(int32 Wave, TArray<FMinionSpawnRequest>&& Requests);
+
+	void Clear();
+
+	int32 GetNumPendingRequests() const { return PendingRequests.Num() - NextRequestIndex; }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual ETickableTickType GetTickableTickType() const override { return ETickableTickType::Conditional; }
+	virtual TStatId GetStatId() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+
+public:
+	FOnExecuteMinionSpawn OnExecuteSpawn;
+
+private:
+	struct FWaveSpawnStats
+	{
+		int32 NumRequested = 0;
+		int32 NumSpawned = 0;
+		int32 NumFrames = 0;
+		uint64 LastFrameNumber = 0;
+		double TotalMs = 0.0;
+		double WorstFrameMs = 0.0;
+		double CurrentFrameMs = 0.0;
+		double MaxDelay = 0.0;
+	};
+
+	void RecordSpawn(int32 Wave, double CostMs, double Delay);
+	void ReportWave(int32 Wave, const FWaveSpawnStats& Stats) const;
+
+private:
+	// 한 프레임에 스폰에 쓸 수 있는 시간 (ms)
+	float FrameBudgetMs;
+
+	TArray<FMinionSpawnRequest> PendingRequests;
+	int32 NextRequestIndex;
+
+	TMap<int32, FWaveSpawnStats> WaveStats;
+};
@@ -17,18 +17,11 @@ class FURYOFLEGENDS_API AGuardianAngel : public AItem
 public:
 	AGuardianAngel();
 
-	virtual void Initialize() override;
-	virtual void Use(AArenaPlayerState* PlayerState) override;
-	virtual void BindToPlayer(AAOSCharacterBase* Character) override;
+	virtual void OnPreDeath(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, bool& bDeath) const override;
 
 protected:
-	void SpawnReviveEffect();
-
-	UFUNCTION()
-	void OnParticleSystemFinished(UParticleSystemComponent* PSystem);
-
-	UFUNCTION()
-	void ReviveCharacter(bool& bDeath);
+	void SpawnReviveEffect(AAOSCharacterBase* Character, const FTransform& SpawnTransform) const;
+	void FinishRevive(AAOSCharacterBase* Character, const FTransform& SpawnTransform) const;
 
 	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "Components", Meta = (AllowPrivateAccess))
 	UParticleSystemComponent* ParticleSystem;
@@ -39,9 +32,15 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = "Components", Meta = (AllowPrivateAccess))
 	UParticleSystem* ReviveEndedParticle;
 
+	// 테이블에 CooldownTime 속성이 없을 때 사용하는 재사용 대기시간
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GuardianAngel", meta = (AllowPrivateAccess))
 	float CooldownTime;
 
+	// 부활 이펙트 시작부터 리스폰까지의 시간. 테이블의 ReviveDuration 속성이 우선합니다.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GuardianAngel", meta = (AllowPrivateAccess))
+	float ReviveDuration;
+
+	// 이펙트 스케일 등 기본값. 위치와 회전은 부활 시점에 채웁니다.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GuardianAngel", meta = (AllowPrivateAccess))
 	FTransform Transform;
 };
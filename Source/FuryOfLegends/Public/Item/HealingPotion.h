@@ -13,30 +13,7 @@ UCLASS()
 class FURYOFLEGENDS_API AHealingPotion : public AItem
 {
 	GENERATED_BODY()
-	
-public:
-	AHealingPotion();
 
 protected:
-	virtual void Initialize() override; 
-	virtual void Use(class AArenaPlayerState* PlayerState) override;
-
-private:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealingPotion", meta = (AllowPrivateAccess))
-	float HealingAmount; //  ȸ
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealingPotion", meta = (AllowPrivateAccess))
-	float HealingDuration; // ȸ  ð
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealingPotion", meta = (AllowPrivateAccess))
-	float AccumulatedHealing; //  ȸ
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealingPotion", meta = (AllowPrivateAccess))
-	float TotalElapsedTime; // Ÿ̸   ð 
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealingPotion", meta = (AllowPrivateAccess))
-	float ElapsedTime; // Ÿ̸  ð 0.5   ݺ
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HealingPotion", meta = (AllowPrivateAccess))
-	float RemainingTime; // Ÿ̸  ð
+	virtual void Use(const FItemDefinition& Definition, FItemInstance& Instance, class AArenaPlayerState* PlayerState) const override;
 };
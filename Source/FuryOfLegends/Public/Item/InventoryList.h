@@ -0,0 +1,92 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "InventoryList.generated.h"
+
+class AArenaPlayerState;
+struct FInventoryList;
+struct FItemInstance;
+
+
+/**
+ * 인벤토리 한 슬롯의 복제용 요약 정보.
+ * 능력 적용 등 실제 동작은 서버의 FItemInstance 와 아이템 정의가 담당하고, 클라이언트는 이 값만 받아 UI 를 갱신합니다.
+ */
+USTRUCT()
+struct FInventoryEntry : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	int32 SlotIndex = INDEX_NONE;
+
+	UPROPERTY()
+	int32 ItemCode = -1;
+
+	UPROPERTY()
+	int32 Stack = 0;
+
+	// 재사용 대기시간이 끝나는 서버 월드 시간. 0 이면 대기 중이 아닙니다.
+	UPROPERTY()
+	float CooldownEndTime = 0.f;
+
+	// 슬롯에 새 아이템 인스턴스가 들어올 때마다 바뀌는 ID. 같은 ItemCode 의 교체를 구분합니다.
+	UPROPERTY()
+	int32 InstanceId = 0;
+
+	void PreReplicatedRemove(const FInventoryList& InArraySerializer);
+	void PostReplicatedAdd(const FInventoryList& InArraySerializer);
+	void PostReplicatedChange(const FInventoryList& InArraySerializer);
+};
+
+
+/**
+ * FInventoryList 는 플레이어 인벤토리를 FastArray 로 복제합니다.
+ * 한 번의 구매로 여러 슬롯이 바뀌어도 하나의 델타로 전송되며, 클라이언트에서는 슬롯별 추가 / 변경 / 제거 콜백이 호출됩니다.
+ */
+USTRUCT()
+struct FInventoryList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+public:
+	/** 서버: 슬롯 내용을 Instance 의 현재 상태로 맞춥니다. Instance 가 비어 있으면 항목을 제거합니다. */
+	void SetSlot(int32 SlotIndex, const FItemInstance& Instance, float CooldownEndTime);
+
+	/** 서버: 슬롯의 재사용 대기 종료 시간을 설정합니다. */
+	void SetCooldownEnd(int32 SlotIndex, float EndTime);
+
+	const FInventoryEntry* FindSlot(int32 SlotIndex) const;
+	const TArray<FInventoryEntry>& GetEntries() const { return Entries; }
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInventoryEntry, FInventoryList>(Entries, DeltaParms, *this);
+	}
+
+private:
+	FInventoryEntry* FindSlotMutable(int32 SlotIndex);
+
+private:
+	friend struct FInventoryEntry;
+	friend class AArenaPlayerState;
+
+	UPROPERTY()
+	TArray<FInventoryEntry> Entries;
+
+	UPROPERTY(NotReplicated)
+	TObjectPtr<AArenaPlayerState> OwnerPlayerState = nullptr;
+};
+
+template<>
+struct TStructOpsTypeTraits<FInventoryList> : public TStructOpsTypeTraitsBase2<FInventoryList>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true,
+	};
+};
@@ -11,9 +11,17 @@
 class AAOSCharacterBase;
 class UStatComponent;
 class AArenaPlayerState;
+struct FItemDefinition;
+struct FItemInstance;
+struct FDamageInformation;
 
 /**
- * 
+ *   .
+ *
+ *  Ŭ  Ŭ 忡  ʽϴ. UItemRegistry  ItemClass  CDO  ItemCode   ϰ,
+ *  ڰ  CDO  մϴ.   ں ¸  ʰ, ʿ ´
+ * FItemInstance() / FItemEffectState(ItemCode  ȿ)  ޹޽ϴ.
+ *  ̺ Ʈ   Ŭ ϹǷ AActor  մϴ.
  */
 UCLASS()
 class FURYOFLEGENDS_API AItem : public AActor
@@ -22,105 +30,40 @@ class FURYOFLEGENDS_API AItem : public AActor
 
 public:
     AItem();
-   
-public:
-    virtual void Initialize();
-    virtual void Use(AArenaPlayerState* PlayerState);
-    virtual void BindToPlayer(AAOSCharacterBase* Character);
-    virtual void ApplyAbilitiesToCharacter();
-    virtual void RemoveAbilitiesFromCharacter();
-
-protected:
-    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-
-    UFUNCTION()
-    virtual void OnHit(FDamageInformation& DamageInformation);
-
-    UFUNCTION()
-    virtual void OnAttack(FDamageInformation& DamageInformation);
-
-    UFUNCTION()
-    virtual void OnAbilityEffects(FDamageInformation& DamageInformation);
-
-    UFUNCTION()
-    virtual void OnReceiveDamageEntered(bool& bResult);
 
 public:
-    //  
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Info", meta = (AllowPrivateAccess = "true"))
-    EItemActivationState ActivationState;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Info", meta = (AllowPrivateAccess = "true"))
-    int32 ItemCode;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Info", meta = (AllowPrivateAccess = "true"))
-    FString Name;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Info", meta = (AllowPrivateAccess = "true"))
-    int32 Price;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Info", meta = (AllowPrivateAccess = "true"))
-    FString Description;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Info", meta = (AllowPrivateAccess = "true"))
-    UTexture* Icon;
+    virtual void Use(const FItemDefinition& Definition, FItemInstance& Instance, AArenaPlayerState* PlayerState) const;
 
-    //   
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Usage", meta = (AllowPrivateAccess = "true"))
-    int32 MaxConcurrentUses; //   Ȱȭ  ִ ִ ø
+    /** Instance  øŭ  մϴ.     ǵϴ. */
+    virtual void ApplyStats(const FItemDefinition& Definition, FItemInstance& Instance, AAOSCharacterBase* Character) const;
+    virtual void RemoveStats(FItemInstance& Instance, AAOSCharacterBase* Character) const;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Usage", meta = (AllowPrivateAccess = "true"))
-    int32 MaxStackPerSlot; //  Կ ø  ִ 
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Usage", meta = (AllowPrivateAccess = "true"))
-    int32 MaxInventoryQuantity; // κ丮   ִ 
-
-    UPROPERTY(Transient, BlueprintReadOnly, Category = "Item|Usage", meta = (AllowPrivateAccess = "true"))
-    int32 ConcurrentUses;
-
-    UPROPERTY(Transient, BlueprintReadOnly, Category = "Item|Usage", meta = (AllowPrivateAccess = "true"))
-    int32 CurrentStackPerSlot;
-
-    UPROPERTY(Transient, BlueprintReadOnly, Category = "Item|Usage", meta = (AllowPrivateAccess = "true"))
-    float CooldownRatio;
-
-    //  
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Stats", meta = (AllowPrivateAccess = "true"))
-    EItemClassification Classification;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Stats", meta = (AllowPrivateAccess = "true"))
-    TArray<FItemStatModifier> StatModifiers;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Stats", meta = (AllowPrivateAccess = "true"))
-    TArray<int> RequiredItems;
-
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Item|Stats", meta = (AllowPrivateAccess = "true"))
-    TMap<FName, int32> UniqueAttributes;
+    //  ĳ ̺Ʈ. AArenaPlayerState  κ丮 ۸ մϴ.
+    virtual void OnHit(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, FDamageInformation& DamageInformation) const;
+    virtual void OnAttack(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, FDamageInformation& DamageInformation) const;
+    virtual void OnAbilityEffects(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, FDamageInformation& DamageInformation) const;
+    virtual void OnReceiveDamageEntered(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, bool& bResult) const;
+    virtual void OnPreDeath(const FItemDefinition& Definition, const FItemInstance& Instance, AArenaPlayerState* PlayerState, bool& bDeath) const;
 
 protected:
-    UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Item")
-    TWeakObjectPtr<AAOSCharacterBase> OwnerCharacter;
-
-protected:
-    using ModifierFunction = void (AItem::*)(AAOSCharacterBase*, int32);
-
-    void ModifyMaxHealthPoints(AAOSCharacterBase* Character, int32 Value);
-    void ModifyMaxManaPoints(AAOSCharacterBase* Character, int32 Value);
-    void ModifyHealthRegeneration(AAOSCharacterBase* Character, int32 Value);
-    void ModifyManaRegeneration(AAOSCharacterBase* Character, int32 Value);
-    void ModifyAttackDamage(AAOSCharacterBase* Character, int32 Value);
-    void ModifyAbilityPower(AAOSCharacterBase* Character, int32 Value);
-    void ModifyDefensePower(AAOSCharacterBase* Character, int32 Value);
-    void ModifyMagicResistance(AAOSCharacterBase* Character, int32 Value);
-    void ModifyAttackSpeed(AAOSCharacterBase* Character, int32 Value);
-    void ModifyAbilityHaste(AAOSCharacterBase* Character, int32 Value);
-    void ModifyCriticalChance(AAOSCharacterBase* Character, int32 Value);
-    void ModifyMovementSpeed(AAOSCharacterBase* Character, int32 Value);
+    using ModifierFunction = void (AItem::*)(AAOSCharacterBase*, int32) const;
+
+    void ModifyMaxHealthPoints(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyMaxManaPoints(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyHealthRegeneration(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyManaRegeneration(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyAttackDamage(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyAbilityPower(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyDefensePower(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyMagicResistance(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyAttackSpeed(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyAbilityHaste(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyCriticalChance(AAOSCharacterBase* Character, int32 Value) const;
+    void ModifyMovementSpeed(AAOSCharacterBase* Character, int32 Value) const;
 
 private:
     TMap<ECharacterStat, ModifierFunction> FunctionMap;
-    TMap<ECharacterStat, int32> ModifiedStats;
 
     template <typename T>
-    void ModifyStat(AAOSCharacterBase* Character, T(UStatComponent::* Getter)() const, void (UStatComponent::* Setter)(T), int32 Value);
-};
\ No newline at end of file
+    void ModifyStat(AAOSCharacterBase* Character, T(UStatComponent::* Getter)() const, void (UStatComponent::* Setter)(T), int32 Value) const;
+};
@@ -93,21 +93,9 @@ public:
 	bool IsEmpty() const { return ItemCode == 0; }
 	FString ConverClassificationToString() const;
 	FString ConvertCharacterStatToString(ECharacterStat StatToConvert) const;
+	/**  Ź  Ľմϴ. ݺؼ ǥ  FItemDescriptionCache  ϼ. */
 	FString ConvertToRichText(UStatComponent* StatComponent) const;
 
-private:
-	FString ApplyColorTags(const FString& Text) const;
-	FString ReplaceLineBreakTags(const FString& Text) const;
-
-	FString ReplaceItemStatTags(const FString& Text) const;
-	FString ReplaceItemAttributeTags(const FString& Text) const;
-	FString ReplaceCharacterStatTags(const FString& Text, UStatComponent* StatComponent) const;
-
-	FString ReplaceCalcTags(const FString& Text, UStatComponent* StatComponent) const;
-
-	TMap<ECharacterStat, TFunction<float(const UStatComponent&)>> StatGetters;
-	TMap<ECharacterStat, TFunction<int32(const UStatComponent&)>> StatGettersInt;
-
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Item")
 	int32 ItemCode;
@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Structs/CharacterStatData.h"
+
+class UStatComponent;
+struct FItemTableRow;
+
+
+enum class EItemDescriptionRunType : uint8
+{
+	Literal,		// 그대로 출력하는 문자열
+	CharacterStat,	// <CharacterStat=...> : 렌더링할 때 캐릭터 스탯 값으로 채웁니다.
+	Calc			// <calc=...> : Expression 을 채운 뒤 수식을 평가합니다.
+};
+
+struct FItemDescriptionRun
+{
+	EItemDescriptionRunType Type = EItemDescriptionRunType::Literal;
+
+	FString Literal;
+	ECharacterStat Stat = ECharacterStat::None;
+
+	// Calc 전용. Literal / CharacterStat 조각만 들어갑니다.
+	TArray<FItemDescriptionRun> Expression;
+};
+
+
+/**
+ * 아이템 설명을 한 번만 파싱해 둔 템플릿.
+ *
+ * <ItemStat=...>, <ItemAttribute=...>, <br> 처럼 아이템 데이터만으로 정해지는 태그는 파싱할 때 문자열로 확정하고,
+ * 캐릭터 스탯에 따라 달라지는 <CharacterStat=...> 와 그것을 포함하는 <calc=...> 만 자리표시자로 남깁니다.
+ */
+class FURYOFLEGENDS_API FItemDescriptionTemplate
+{
+public:
+	static FItemDescriptionTemplate Parse(const FItemTableRow& Item);
+
+	FString Render(const UStatComponent& StatComponent) const;
+
+	/** 렌더링 결과에 영향을 주는 캐릭터 스탯 (중복 없음) */
+	const TArray<ECharacterStat>& GetDependencies() const { return Dependencies; }
+
+	static float ReadStat(const UStatComponent& StatComponent, ECharacterStat Stat);
+	static bool IsIntegerStat(ECharacterStat Stat);
+
+private:
+	void AddLiteral(TArray<FItemDescriptionRun>& OutRuns, const FString& Text);
+	void AddStat(TArray<FItemDescriptionRun>& OutRuns, ECharacterStat Stat);
+
+	static void RenderRuns(const TArray<FItemDescriptionRun>& InRuns, const UStatComponent& StatComponent, FString& Out);
+
+private:
+	TArray<FItemDescriptionRun> Runs;
+	TArray<ECharacterStat> Dependencies;
+};
+
+
+/**
+ * 아이템별로 파싱한 템플릿과 마지막 렌더링 결과를 보관합니다.
+ * 결과는 템플릿이 참조하는 스탯 값이 마지막 렌더링 때와 달라진 경우에만 다시 만듭니다.
+ */
+class FURYOFLEGENDS_API FItemDescriptionCache
+{
+public:
+	const FString& GetRichText(const FItemTableRow& Item, const UStatComponent& StatComponent);
+	void Reset() { Entries.Reset(); }
+
+private:
+	struct FEntry
+	{
+		FItemDescriptionTemplate Template;
+		TArray<float> DependencyValues;
+		FString Text;
+		bool bRendered = false;
+	};
+
+	TMap<int32, FEntry> Entries;
+};
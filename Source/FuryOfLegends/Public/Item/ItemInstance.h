@@ -0,0 +1,65 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Structs/CharacterStatData.h"
+#include "Item/ItemData.h"
+#include "ItemInstance.generated.h"
+
+
+/**
+ * 인벤토리 한 슬롯을 차지하는 소유자별 아이템 기록.
+ * 아이템 동작은 UItemRegistry 가 ItemCode 로 찾아주는 정의가 담당하므로, 여기에는 슬롯 상태만 둡니다.
+ * 구매 / 판매 / 스택 변경은 이 값만 바꾸며 UObject 를 만들지 않습니다.
+ */
+USTRUCT()
+struct FItemInstance
+{
+	GENERATED_BODY()
+
+public:
+	bool IsEmpty() const { return ItemCode < 0 || Stack <= 0; }
+
+	void Reset()
+	{
+		ItemCode = -1;
+		Stack = 0;
+		InstanceId = 0;
+		AppliedStats.Reset();
+	}
+
+public:
+	UPROPERTY(VisibleInstanceOnly)
+	int32 ItemCode = -1;
+
+	UPROPERTY(VisibleInstanceOnly)
+	int32 Stack = 0;
+
+	// 슬롯에 새 아이템이 들어올 때마다 바뀌는 ID. 같은 ItemCode 의 교체를 구분합니다.
+	UPROPERTY(VisibleInstanceOnly)
+	int32 InstanceId = 0;
+
+	// 캐릭터에 실제로 적용된 스탯. 제거할 때 이 값을 그대로 되돌립니다.
+	TArray<TPair<ECharacterStat, int32>, TInlineAllocator<4>> AppliedStats;
+};
+
+
+/**
+ * 소유자별 아이템 효과 상태.
+ * 재사용 대기처럼 슬롯이 비어도 이어지는 효과를 ItemCode 단위로 기록합니다.
+ * 포션 회복 같은 주기 효과는 캐릭터의 UPeriodicEffectComponent 가 관리합니다.
+ */
+USTRUCT()
+struct FItemEffectState
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(VisibleInstanceOnly)
+	EItemActivationState ActivationState = EItemActivationState::Inactive;
+
+	// 재사용 대기가 끝나는 서버 월드 시간. 0 이면 대기 중이 아닙니다.
+	UPROPERTY(VisibleInstanceOnly)
+	float CooldownEndTime = 0.f;
+};
@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Item/ItemData.h"
+#include "ItemRegistry.generated.h"
+
+class UDataTable;
+class AItem;
+
+
+/**
+ * ItemCode 하나에 대한 정의. 데이터 테이블 행과 동작(ItemClass 의 CDO)을 묶습니다.
+ */
+USTRUCT()
+struct FItemDefinition
+{
+	GENERATED_BODY()
+
+public:
+	/** UniqueAttributes 값을 반환합니다. 없으면 DefaultValue */
+	float GetAttribute(const FName& Key, float DefaultValue) const
+	{
+		const int32* Found = Row.UniqueAttributes.Find(Key);
+		return Found ? static_cast<float>(*Found) : DefaultValue;
+	}
+
+public:
+	UPROPERTY()
+	FItemTableRow Row;
+
+	// 상태를 갖지 않는 아이템 동작. 모든 소유자가 공유합니다.
+	UPROPERTY()
+	TObjectPtr<const AItem> Behavior = nullptr;
+};
+
+
+/**
+ * UItemRegistry 는 매치 시작 시 아이템 테이블을 읽어 ItemCode -> 아이템 정의를 만듭니다.
+ *
+ * 아이템 액터를 생성하거나 복제하지 않고, 행마다 ItemClass 의 CDO 를 동작으로 등록합니다.
+ * 소유자별 상태는 AArenaPlayerState 의 FItemInstance / FItemEffectState 가 가집니다.
+ * 서버 전용이며 게임 모드가 소유합니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UItemRegistry : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Build(UDataTable* ItemTable);
+	void Reset();
+
+	const FItemDefinition* Find(int32 ItemCode) const { return Definitions.Find(ItemCode); }
+
+	/** ItemCode 를 만드는 데 필요한 하위 아이템 (SubItemCode -> RequiredCount) */
+	const TMap<int32, int32>* GetSubItems(int32 ItemCode) const { return RequiredSubItems.Find(ItemCode); }
+
+	const TMap<int32, FItemDefinition>& GetDefinitions() const { return Definitions; }
+	int32 Num() const { return Definitions.Num(); }
+
+private:
+	void GenerateSubItems(int32 ItemCode);
+
+private:
+	UPROPERTY()
+	TMap<int32, FItemDefinition> Definitions;
+
+	/**  ItemCode -> (SubItemCode -> RequiredCount) */
+	TMap<int32, TMap<int32, int32>> RequiredSubItems;
+};
@@ -0,0 +1,49 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "CosmeticDispatcher.generated.h"
+
+class UParticleSystem;
+class UStaticMesh;
+class UStaticMeshComponent;
+class USceneComponent;
+
+
+/**
+ * 파티클 / 붙는 메시처럼 화면에만 보이는 요청을 한곳에서 처리합니다.
+ *
+ * 데디케이티드 서버에서는 아무것도 만들지 않고 nullptr 를 반환합니다. 호출하는 쪽은 반환값이 없을 수 있다고 가정해야 합니다.
+ * 서버에서 막은 요청 수와 실제로 만들어진 장식 컴포넌트 수를 세어 두며, Arena.Cosmetic.Report 로 확인할 수 있습니다.
+ * (데디케이티드 서버의 생성 수는 항상 0 이어야 합니다.)
+ */
+UCLASS()
+class FURYOFLEGENDS_API UCosmeticDispatcher : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** 이 월드에서 장식 요소를 만들 필요가 있는지 */
+	static bool CanSpawnCosmetics(const UObject* WorldContextObject);
+
+	static UParticleSystemComponent* SpawnEmitterAtLocation(const UObject* WorldContextObject, UParticleSystem* Particle, const FTransform& Transform, bool bAutoDestroy = true, EPSCPoolMethod PoolingMethod = EPSCPoolMethod::AutoRelease, bool bAutoActivate = true);
+	static UParticleSystemComponent* SpawnEmitterAttached(UParticleSystem* Particle, USceneComponent* AttachToComponent, const FTransform& Transform, EAttachLocation::Type LocationType);
+
+	/** Owner 에 메시 컴포넌트를 붙이고 Duration 뒤에 제거합니다. */
+	static UStaticMeshComponent* SpawnMeshAttached(AActor* Owner, UStaticMesh* Mesh, USceneComponent* AttachToComponent, float Duration);
+
+	static int32 GetSuppressedCount() { return SuppressedCount; }
+	static int32 GetDedicatedServerSpawnCount() { return DedicatedServerSpawnCount; }
+
+private:
+	static void NotifySpawned(const UObject* WorldContextObject);
+
+	// 데디케이티드 서버에서 막은 요청 수
+	static int32 SuppressedCount;
+
+	// 데디케이티드 서버에서 실제로 만들어진 장식 컴포넌트 수
+	static int32 DedicatedServerSpawnCount;
+};
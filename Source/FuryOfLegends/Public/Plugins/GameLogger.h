@@ -3,12 +3,67 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include <atomic>
 
 
 class ACharacter;
 
+// Shipping 忡 Warning ̸ αװ ȣα ϵ ʽϴ.
+#if UE_BUILD_SHIPPING
+#define ARENA_LOG_COMPILETIME_VERBOSITY Warning
+#else
+#define ARENA_LOG_COMPILETIME_VERBOSITY All
+#endif
+
+FURYOFLEGENDS_API DECLARE_LOG_CATEGORY_EXTERN(LogArena, Log, ARENA_LOG_COMPILETIME_VERBOSITY);
+FURYOFLEGENDS_API DECLARE_LOG_CATEGORY_EXTERN(LogArenaCombat, Log, ARENA_LOG_COMPILETIME_VERBOSITY);
+
+
+/**
+ * ȣ ġ ϳ α 󵵸 մϴ.  忡 ҷ մϴ.
+ * GAME_LOG_THROTTLED  ȣ ġ ϳ static  ϴ.
+ */
+class FURYOFLEGENDS_API FGameLogThrottle
+{
+public:
+	/** ̹ ȣ ؾ ϸ true  Բ ׵  Ƚ ݴϴ. */
+	bool ShouldLog(float IntervalSeconds, int32& OutSuppressedCount);
+
+private:
+	std::atomic<uint64> NextAllowedCycles{ 0 };
+	std::atomic<int32> SuppressedCount{ 0 };
+};
+
+
+/**
+ * Լ ̸ տ ٿ UE_LOG  մϴ.
+ * īװ  Ÿ / Ÿ 󼼵 ɸ  򰡿   ʽϴ.
+ */
+#define GAME_LOG(Category, Verbosity, Format, ...) \
+	UE_LOG(Category, Verbosity, TEXT("[%s] ") Format, ANSI_TO_TCHAR(__FUNCTION__), ##__VA_ARGS__)
+
+/**
+ * GAME_LOG   ȣ ġ IntervalSeconds    ϰ,  Ƚ Բ ϴ.
+ * Ÿ̸ӳ Tick ó  Ҹ   α׿ մϴ.
+ */
+#define GAME_LOG_THROTTLED(Category, Verbosity, IntervalSeconds, Format, ...) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(Category, Verbosity)) \
+		{ \
+			static FGameLogThrottle GameLogThrottle; \
+			int32 GameLogSuppressedCount = 0; \
+			if (GameLogThrottle.ShouldLog(IntervalSeconds, GameLogSuppressedCount)) \
+			{ \
+				UE_LOG(Category, Verbosity, TEXT("[%s] (+%d suppressed) ") Format, ANSI_TO_TCHAR(__FUNCTION__), GameLogSuppressedCount, ##__VA_ARGS__); \
+			} \
+		} \
+	} while (0)
+
+
 /**
- * 
+ *     ΰ. LogArena     ʽϴ.
+ *  ڵ GAME_LOG / GAME_LOG_THROTTLED  մϴ.
  */
 class FURYOFLEGENDS_API GameLogger
 {
@@ -0,0 +1,113 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CollisionShape.h"
+#include "Engine/EngineTypes.h"
+#include "Structs/CharacterData.h"
+
+class UWorld;
+class AActor;
+class ACharacterBase;
+struct FOverlapResult;
+
+
+enum class EQueryTeamFilter : uint8
+{
+	Any,		// 팀을 보지 않습니다.
+	Enemies,	// TeamSide 와 다른 팀만
+	Allies		// TeamSide 와 같은 팀만
+};
+
+
+/**
+ * 캐릭터를 찾는 범위 질의 하나.
+ *
+ * Sphere / Box / Capsule 은 물리 오버랩 그대로이고, Cone 은 반지름 Length 의 구로 찾은 뒤 꼭짓점에서 본 캐릭터 위치의 각도로 거릅니다.
+ * 결과는 ACharacterBase 만 들어가며 한 캐릭터는 한 번만 들어갑니다.
+ */
+struct FURYOFLEGENDS_API FGameplayQuery
+{
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+	FCollisionShape Shape;
+	ECollisionChannel Channel = ECC_GameTraceChannel5;
+
+	// Cone 전용. ConeCosHalfAngle 이 -1 이면 각도 검사를 하지 않습니다.
+	FVector ConeDirection = FVector::ForwardVector;
+	float ConeCosHalfAngle = -1.f;
+
+	ETeamSide TeamSide = ETeamSide::None;
+	EQueryTeamFilter TeamFilter = EQueryTeamFilter::Any;
+
+	// None 이 아니면 해당 종류의 캐릭터만 남깁니다.
+	EObjectType ObjectType = EObjectType::None;
+
+	TArray<const AActor*, TInlineAllocator<2>> IgnoredActors;
+
+	static FGameplayQuery Sphere(const FVector& InLocation, float Radius, ECollisionChannel InChannel);
+	static FGameplayQuery Box(const FVector& InLocation, const FVector& HalfExtent, const FQuat& InRotation, ECollisionChannel InChannel);
+	static FGameplayQuery Capsule(const FVector& InLocation, float Radius, float HalfHeight, const FQuat& InRotation, ECollisionChannel InChannel);
+	static FGameplayQuery Cone(const FVector& Apex, const FVector& Direction, float Length, float HalfAngleDegrees, ECollisionChannel InChannel);
+
+	FGameplayQuery& EnemiesOf(ETeamSide InTeamSide) { TeamSide = InTeamSide; TeamFilter = EQueryTeamFilter::Enemies; return *this; }
+	FGameplayQuery& AlliesOf(ETeamSide InTeamSide) { TeamSide = InTeamSide; TeamFilter = EQueryTeamFilter::Allies; return *this; }
+	FGameplayQuery& OnlyType(EObjectType InObjectType) { ObjectType = InObjectType; return *this; }
+	FGameplayQuery& Ignore(const AActor* Actor) { IgnoredActors.AddUnique(Actor); return *this; }
+
+	/** 질의 범위를 감싸는 구 */
+	FSphere GetBoundingSphere() const;
+
+	/** 물리 오버랩 이후의 팀 / 종류 / 각도 조건 */
+	bool PassesFilter(const ACharacterBase* Character) const;
+};
+
+
+/**
+ * 범위 질의 함수 모음.
+ * 오버랩 결과 버퍼를 게임 스레드에서 재사용하므로 게임 스레드에서만 호출해야 합니다.
+ */
+namespace GameplayQuery
+{
+	/** Query 에 걸린 캐릭터를 OutCharacters 뒤에 추가하고 추가한 수를 반환합니다. */
+	FURYOFLEGENDS_API int32 Overlap(const UWorld* World, const FGameplayQuery& Query, TArray<ACharacterBase*>& OutCharacters);
+}
+
+
+/**
+ * 여러 질의를 모아 한 번에 처리합니다.
+ *
+ * 같은 채널의 질의들이 충분히 가까이 모여 있으면 전체를 감싸는 구로 한 번만 오버랩하고,
+ * 찾은 컴포넌트마다 각 질의의 모양과 직접 겹치는지 확인합니다. 흩어져 있으면 질의마다 따로 오버랩합니다.
+ * 물리 씬이 이미 공간 분할을 하므로 별도의 격자는 두지 않습니다.
+ *
+ * 버퍼는 Reset 뒤에도 유지되므로 같은 배치를 반복해서 쓰면 할당이 생기지 않습니다.
+ */
+class FURYOFLEGENDS_API FGameplayQueryBatch
+{
+public:
+	int32 Add(const FGameplayQuery& Query);
+	void Execute(const UWorld* World);
+	void Reset();
+
+	int32 Num() const { return Queries.Num(); }
+	TConstArrayView<ACharacterBase*> GetResults(int32 QueryIndex) const;
+
+	/** 마지막 Execute 에서 실행한 물리 오버랩 수 */
+	int32 GetSceneQueryCount() const { return SceneQueryCount; }
+
+	// 합친 구의 부피가 개별 구 부피 합의 몇 배까지면 한 번에 오버랩할지
+	float MergeVolumeRatio = 4.f;
+
+private:
+	void ExecuteMerged(const UWorld* World, ECollisionChannel Channel, const FSphere& Bounds, TConstArrayView<int32> QueryIndices);
+
+	TArray<FGameplayQuery> Queries;
+
+	// Queries 보다 길 수 있습니다. 안쪽 배열의 용량을 다음 배치에서 재사용합니다.
+	TArray<TArray<ACharacterBase*>> Results;
+	TArray<FOverlapResult> OverlapBuffer;
+	TArray<int32> GroupIndices;
+	int32 SceneQueryCount = 0;
+};
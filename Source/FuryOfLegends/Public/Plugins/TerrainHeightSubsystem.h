@@ -0,0 +1,88 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TerrainHeightSubsystem.generated.h"
+
+
+/**
+ * 아레나의 정적 지형 높이를 격자로 구워 두고 물리 트레이스 없이 높이와 경사를 돌려줍니다.
+ *
+ * 월드가 시작될 때 WorldStatic 오브젝트만 대상으로 격자점마다 수직 트레이스를 한 번씩 쏴서 가장 위의 표면 높이를 저장합니다.
+ * 다음 경우에는 격자 값을 쓰지 않고 ECC_WorldStatic 채널로 직접 트레이스합니다.
+ *  - 격자 밖이거나 아래에 표면이 없는 격자점이 섞인 경우
+ *  - 주변 격자점의 높이 차가 커서 (절벽, 벽 가장자리) 보간 값을 믿을 수 없는 경우
+ *  - 움직이는 충돌체가 덮는 칸이나 InvalidateRegion 으로 무효화한 칸
+ */
+UCLASS()
+class FURYOFLEGENDS_API UTerrainHeightSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static UTerrainHeightSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * Location 의 XY 에서 지면 높이를 구합니다.
+	 * 트레이스로 대신할 때는 Location.Z 위아래로 FallbackTraceHalfHeight 만큼 검사합니다.
+	 *
+	 * @param OutNormal		nullptr 가 아니면 지면의 법선을 함께 돌려줍니다.
+	 * @return				지면을 찾지 못하면 false
+	 */
+	bool SampleHeight(const FVector& Location, float& OutHeight, FVector* OutNormal = nullptr, const AActor* IgnoredActor = nullptr) const;
+
+	/** 지면 위의 점을 돌려줍니다. 찾지 못하면 false */
+	bool ProjectToGround(const FVector& Location, FVector& OutGroundLocation, const AActor* IgnoredActor = nullptr) const;
+
+	/** 지면 경사 (도) */
+	bool SampleSlopeDegrees(const FVector& Location, float& OutSlopeDegrees, const AActor* IgnoredActor = nullptr) const;
+
+	/** Box 와 겹치는 칸은 이후 항상 트레이스를 사용합니다. 레벨에 움직이는 지형이 생길 때 호출합니다. */
+	void InvalidateRegion(const FBox& Box);
+
+	bool IsBaked() const { return Heights.Num() > 0; }
+
+	int32 GetGridSampleCount() const { return GridSampleCount; }
+	int32 GetFallbackTraceCount() const { return FallbackTraceCount; }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	void Bake(UWorld& InWorld);
+	FBox GatherStaticBounds(UWorld& InWorld, TArray<FBox>& OutDynamicBounds) const;
+
+	bool SampleGrid(const FVector2D& Position, float& OutHeight, FVector* OutNormal) const;
+	bool TraceHeight(const FVector& Location, float& OutHeight, FVector* OutNormal, const AActor* IgnoredActor) const;
+
+	int32 GetIndex(int32 X, int32 Y) const { return Y * NumX + X; }
+	bool IsUsable(int32 X, int32 Y) const;
+
+private:
+	// 격자 간격. 아레나가 커서 MaxCellsPerAxis 를 넘으면 자동으로 늘립니다.
+	float CellSize = 100.f;
+	int32 MaxCellsPerAxis = 512;
+
+	// 이웃 격자점의 높이 차가 이보다 크면 보간하지 않고 트레이스합니다.
+	float MaxInterpolationDelta = 40.f;
+
+	float FallbackTraceHalfHeight = 10000.f;
+
+	FVector2D Origin = FVector2D::ZeroVector;
+	int32 NumX = 0;
+	int32 NumY = 0;
+
+	TArray<float> Heights;
+
+	// 표면이 있고 움직이는 충돌체에 덮이지 않은 격자점
+	TBitArray<> UsableSamples;
+	int32 UsableSampleCount = 0;
+
+	mutable int32 GridSampleCount = 0;
+	mutable int32 FallbackTraceCount = 0;
+};
@@ -16,6 +16,8 @@ class UActionStatComponent;
 class UPointLightComponent;
 class UParticleSystemComponent;
 class UBoxComponent;
+class UStructureTargetingComponent;
+class UCosmeticAnimationComponent;
 class UCapsuleComponent;
 class UParticleSystem;
 class UStaticMeshComponent;
@@ -60,7 +62,6 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaTime) override;
 	virtual void PostInitializeComponents() override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
@@ -85,7 +86,6 @@ public:
 	void ActivateCamera();
 	void BindNexusInfoToHUD(ACharacterBase* Player);
 	void RmoveBindNexusInfoToHUD(ACharacterBase* Player);
-	void ApplyDynamicRotation(float DeltaTime);
 
 	UFUNCTION()
 	virtual void OnCharacterDeath();
@@ -102,8 +102,7 @@ public:
 	UFUNCTION()
 	void OnCharacterExitRange(UPrimitiveComponent* OverlappedComp, AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex);
 
-	UFUNCTION()
-	virtual void OnAllyAttacked(AActor* DamageReceiver, AActor* DamageCauser, AController* InstigatorActor, FDamageInformation& DamageInformation);
+	virtual void OnAggroTargetRequested(ACharacterBase* Attacker);
 
 	UFUNCTION()
 	virtual void OnTargetEliminated(AActor* Eliminator);
@@ -143,6 +142,12 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Nexus|Components", Meta = (AllowPrivateAccess))
 	TObjectPtr<UBoxComponent> DetectionBox;
 
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Nexus|Components", Meta = (AllowPrivateAccess))
+	TObjectPtr<UStructureTargetingComponent> TargetingComponent;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Nexus|Components", Meta = (AllowPrivateAccess))
+	TObjectPtr<UCosmeticAnimationComponent> CosmeticComponent;
+
 public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Nexus|Components", Meta = (AllowPrivateAccess))
 	TObjectPtr<UParticleSystemComponent> ProtalParticleSystem;
@@ -204,12 +209,6 @@ private:
 	UPROPERTY(Replicated, Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Nexus|GamePlay", Meta = (AllowPrivateAccess))
 	ACharacterBase* TargetCharacter;
 
-	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Nexus|GamePlay", Meta = (AllowPrivateAccess))
-	TArray<ACharacterBase*> EnemiesInRange;
-
-	UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Nexus|GamePlay", Meta = (AllowPrivateAccess))
-	TArray<ACharacterBase*> AlliesInRange;
-
 	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Nexus|GamePlay", Meta = (AllowPrivateAccess))
 	float TargetingDelay;
 
@@ -0,0 +1,56 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Structs/CharacterData.h"
+#include "AnimationData.generated.h"
+
+class ACharacterBase;
+
+
+/**
+ * 애니메이션 갱신에 필요한 캐릭터 상태를 게임 스레드에서 한 번에 복사해 둔 값.
+ *
+ * 애님 인스턴스는 NativeUpdateAnimation 에서 이 구조체만 채우고,
+ * 나머지 계산은 모두 NativeThreadSafeUpdateAnimation 에서 이 값만 읽어 워커 스레드에서 수행합니다.
+ */
+USTRUCT(BlueprintType)
+struct FCharacterAnimSnapshot
+{
+	GENERATED_BODY()
+
+public:
+	/** 게임 스레드 전용. 캐릭터와 무브먼트 컴포넌트의 값을 복사합니다. */
+	void Capture(const ACharacterBase& Character);
+
+public:
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	bool bIsValid = false;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	FVector WorldLocation = FVector::ZeroVector;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	FRotator WorldRotation = FRotator::ZeroRotator;
+
+	// APawn::GetBaseAimRotation
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	FRotator BaseAimRotation = FRotator::ZeroRotator;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	FVector Velocity = FVector::ZeroVector;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	FVector LastUpdateVelocity = FVector::ZeroVector;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	FVector Acceleration = FVector::ZeroVector;
+
+	UPROPERTY(VisibleInstanceOnly, BlueprintReadOnly, Category = "Snapshot")
+	bool bIsFalling = false;
+
+	UPROPERTY(VisibleInstanceOnly, Category = "Snapshot")
+	ECharacterState CharacterState = ECharacterState::None;
+};
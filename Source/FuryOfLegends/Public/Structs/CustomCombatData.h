@@ -91,6 +91,12 @@ public:
 		, Percent(InPercent)
 	{}
 
+	/**
+	 * 양자화된 압축 직렬화. Duration 은 0.01초, Percent 는 0.001 단위로 보냅니다.
+	 * PreviousEntry 가 주어지면 같은 값은 1비트로 생략합니다. (FDamageInformation 의 CC 목록 델타 인코딩)
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+	void NetSerializeDelta(FArchive& Ar, const FCrowdControlInformation* PreviousEntry);
 
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -211,6 +217,12 @@ public:
 		CrowdControls.Empty();
 	}
 
+	/**
+	 * 압축 직렬화. 피해량은 0.1 단위로 양자화해 가변 길이 정수로 보내고, 0 인 피해량은 1비트로 생략합니다.
+	 * ActionSlot / DamageType / AttackTrigger 는 사용하는 비트 수만큼만 보내며, CC 목록은 이전 항목 기준으로 델타 인코딩합니다.
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
 public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, meta = (AllowPrivateAccess))
 	EActionSlot ActionSlot;
@@ -234,6 +246,24 @@ public:
 	TArray<FCrowdControlInformation> CrowdControls;
 };
 
+template<>
+struct TStructOpsTypeTraits<FCrowdControlInformation> : public TStructOpsTypeTraitsBase2<FCrowdControlInformation>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+template<>
+struct TStructOpsTypeTraits<FDamageInformation> : public TStructOpsTypeTraitsBase2<FDamageInformation>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
 
 
 /**
@@ -7,6 +7,21 @@
 #include "GameData.generated.h"
 
 
+/**
+ * 매치 시작 전 플레이어의 로딩 단계. 로딩 화면에 진행 상황을 표시하는 데 사용합니다.
+ */
+UENUM(BlueprintType)
+enum class EPlayerLoadStage : uint8
+{
+	None			UMETA(DisplayName = "None"),
+	Connected		UMETA(DisplayName = "Connected"),		// PostLogin 완료
+	WorldLoaded		UMETA(DisplayName = "World Loaded"),	// 클라이언트 레벨 로딩 완료 (ServerNotifyLoaded)
+	PawnSpawned		UMETA(DisplayName = "Pawn Spawned"),	// 챔피언 스폰 및 빙의 완료
+	Ready			UMETA(DisplayName = "Ready"),			// 클라이언트 HUD 초기화 완료
+	TimedOut		UMETA(DisplayName = "Timed Out")		// 제한 시간 안에 준비되지 못함
+};
+
+
 USTRUCT(BlueprintType)
 struct FGameDataTableRow : public FTableRowBase
 {
@@ -27,6 +42,7 @@ public:
 		, SpawnInterval(0.5f)
 		, MinionSpawnTime(5.0f)
 		, MinionSpawnInterval(90.f)
+		, MinionSpawnFrameBudgetMs(2.f)
 		, ChaseThreshold(1000.f)
 	{
 
@@ -72,6 +88,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion")
 	float MinionSpawnInterval;
 
+	// 한 프레임에 미니언 스폰에 쓸 수 있는 시간 (ms). 넘으면 남은 스폰은 다음 프레임으로 미룹니다.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion")
+	float MinionSpawnFrameBudgetMs;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Minion")
 	float ChaseThreshold;
 };
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Structs/CharacterStatData.h"
 #include "MinionData.generated.h"
 
 
@@ -66,6 +67,109 @@ public:
 };
 
 
+
+/**
+ * 미니언 성장 파라미터.
+ * 스탯 테이블의 UniqueAttributes 에서 매치 시작 시 한 번만 읽어오며, 없는 키는 기본값을 사용합니다.
+ */
+USTRUCT(BlueprintType)
+struct FMinionGrowthParameters
+{
+	GENERATED_BODY()
+
+public:
+	FMinionGrowthParameters()
+		: HealthIncreaseAmount(22.f)
+		, AdditionalHealthAmount(0.3f)
+		, AttackIncreaseAmount(5.f)
+		, StartIncreaseTime(165.f)
+		, IncreaseInterval(90.f)
+		, MaxHealthLimit(1300.f)
+	{
+	}
+
+	static FMinionGrowthParameters FromUniqueAttributes(const TMap<FString, float>& UniqueAttributes);
+
+	// 경과 시간까지 지난 성장 구간 수
+	int32 GetGrowthLevel(float ElapsedTime) const;
+
+public:
+	// 구간마다 증가하는 체력
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float HealthIncreaseAmount;
+
+	// 구간이 지날 때마다 체력 증가량에 더해지는 값
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AdditionalHealthAmount;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AttackIncreaseAmount;
+
+	// 첫 성장 시점 (2:45)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float StartIncreaseTime;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float IncreaseInterval;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MaxHealthLimit;
+};
+
+
+USTRUCT(BlueprintType)
+struct FMinionWaveStats
+{
+	GENERATED_BODY()
+
+public:
+	FMinionWaveStats()
+		: MaxHP(0.f)
+		, AttackDamage(0.f)
+	{
+	}
+
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float MaxHP;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	float AttackDamage;
+};
+
+
+/**
+ * 미니언 종류별 성장 테이블.
+ * AArenaGameMode 가 매치 시작 시 웨이브 번호별 스탯을 미리 계산해 두고,
+ * 미니언은 스폰된 웨이브 번호로 한 번 조회해서 초기화합니다.
+ */
+USTRUCT(BlueprintType)
+struct FMinionGrowthTable
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(const FStatTableRow& InBaseStats);
+	void Bake(int32 NumWaves, float FirstWaveTime, float WaveInterval);
+
+	FMinionWaveStats EvaluateGrowthLevel(int32 GrowthLevel) const;
+	FMinionWaveStats GetWaveStats(int32 Wave) const;
+
+public:
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FStatTableRow BaseStats;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	FMinionGrowthParameters Growth;
+
+	// 인덱스 = 웨이브 번호 (0 은 첫 웨이브 이전)
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
+	TArray<FMinionWaveStats> WaveStats;
+
+	float FirstWaveTime = 0.f;
+	float WaveInterval = 0.f;
+};
+
 /**
  * 
  */
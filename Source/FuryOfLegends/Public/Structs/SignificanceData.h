@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "SignificanceData.generated.h"
+
+
+/**
+ * 미니언 / NPC 의 중요도 단계. 값이 클수록 덜 중요합니다.
+ */
+UENUM(BlueprintType)
+enum class ESignificanceTier : uint8
+{
+	High,		// 시점 근처 (전투 중) - 모든 갱신을 매 프레임 수행
+	Medium,		// 화면 안이지만 멀리 있음
+	Low,		// 화면 가장자리 / 밖
+	Dormant,	// 아무 플레이어와도 관련 없음
+	MAX			UMETA(Hidden)
+};
+
+
+/**
+ * 중요도 단계별로 적용할 갱신 주기 설정.
+ */
+USTRUCT(BlueprintType)
+struct FSignificanceTierSettings
+{
+	GENERATED_BODY()
+
+public:
+	FSignificanceTierSettings()
+		: MaxDistance(0.f)
+		, ActorTickInterval(0.f)
+		, AnimationTickInterval(0.f)
+		, bEnableUpdateRateOptimizations(false)
+		, bShowWidget(true)
+		, WidgetTickInterval(0.f)
+		, AIServiceIntervalScale(1.f)
+	{
+	}
+
+	FSignificanceTierSettings(float InMaxDistance, float InActorTickInterval, float InAnimationTickInterval, bool bInEnableURO, bool bInShowWidget, float InWidgetTickInterval, float InAIServiceIntervalScale)
+		: MaxDistance(InMaxDistance)
+		, ActorTickInterval(InActorTickInterval)
+		, AnimationTickInterval(InAnimationTickInterval)
+		, bEnableUpdateRateOptimizations(bInEnableURO)
+		, bShowWidget(bInShowWidget)
+		, WidgetTickInterval(InWidgetTickInterval)
+		, AIServiceIntervalScale(InAIServiceIntervalScale)
+	{
+	}
+
+public:
+	// 가장 가까운 시점과의 거리가 이 값 이하이면 이 단계에 속합니다. (마지막 단계는 무시)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float MaxDistance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float ActorTickInterval;
+
+	// 스켈레탈 메시 컴포넌트 틱 주기 (애니메이션 갱신 주기)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AnimationTickInterval;
+
+	// 엔진 URO (화면 크기 기반 애니메이션 프레임 스킵)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bEnableUpdateRateOptimizations;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	bool bShowWidget;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float WidgetTickInterval;
+
+	// 비헤이비어 트리 서비스 주기에 곱해지는 값
+	UPROPERTY(EditAnywhere, BlueprintReadWrite)
+	float AIServiceIntervalScale;
+};
@@ -29,6 +29,106 @@ public:
     float Value;
 };
 
+
+/**
+ * 능력 고유 속성 키.
+ * 데이터 테이블의 FUniqueAttribute::Key 와 같은 이름을 사용하며, InitActionStatComponent / 레벨 초기화 시점에
+ * 이 열거형 인덱스로 변환해 두기 때문에 능력 코드에서는 문자열 검색 없이 값을 조회합니다.
+ */
+UENUM(BlueprintType)
+enum class EUniqueAttribute : uint8
+{
+    // 투사체
+    InitialSpeed,
+    MaxSpeed,
+    HomingAcceleration,
+    CollisionRadius,
+    PierceCount,
+    DamageReduction,
+    ChargeTimeThreshold,
+
+    // 범위 / 폭발
+    ExplosionRadius,
+    MaxHitCount,
+    ChainRadius,
+    SideArrowsDamage,
+    SideArrowsAngle,
+
+    // 버프 / 상태이상
+    Duration,
+    BonusAttackSpeed,
+    BonusFlatMovementSpeed,
+    BonusPercentMovementSpeed,
+    SlowDuration,
+    MovementSpeedSlow,
+    StunDuration,
+    FirstDelay,
+
+    // 피해 계수
+    HeroShatterAbilityDamage,
+    NonHeroShatterAbilityDamage,
+    InitialPowerScaling,
+    PowerScalingOnHero,
+    PowerScalingOnNonHero,
+
+    // 이동 / 지형
+    MaxHeightDifference,
+    HeightThreshold,
+    HeightScale,
+    SegmentLength,
+    CreationRate,
+    BoostStrength,
+    TumblingSpeed,
+
+    // 파티클
+    Rate,
+    NumParticles,
+    RingDuration,
+    ParticleScale,
+
+    MAX UMETA(Hidden)
+};
+
+
+/**
+ * 한 능력 인스턴스의 고유 속성을 EUniqueAttribute 인덱스로 펼쳐 둔 고정 크기 테이블.
+ */
+struct FURYOFLEGENDS_API FUniqueAttributeSet
+{
+public:
+    static constexpr int32 NumAttributes = static_cast<int32>(EUniqueAttribute::MAX);
+    static_assert(NumAttributes <= 64, "FUniqueAttributeSet uses a 64-bit presence mask.");
+
+    FUniqueAttributeSet()
+        : PresentMask(0)
+    {
+        FMemory::Memzero(Values);
+    }
+
+    /** 데이터 테이블의 키 목록을 변환합니다. 열거형에 없는 키는 무시합니다. */
+    void Resolve(const TArray<FUniqueAttribute>& Attributes);
+
+    /** 키가 없거나 값이 0 이면 DefaultValue 를 반환합니다. (기존 FName 조회와 같은 규칙) */
+    FORCEINLINE float Get(EUniqueAttribute Attribute, float DefaultValue) const
+    {
+        const int32 Index = static_cast<int32>(Attribute);
+        const bool bPresent = (PresentMask & (1ull << Index)) != 0;
+        return (bPresent && !FMath::IsNearlyZero(Values[Index])) ? Values[Index] : DefaultValue;
+    }
+
+    FORCEINLINE bool Contains(EUniqueAttribute Attribute) const
+    {
+        return (PresentMask & (1ull << static_cast<int32>(Attribute))) != 0;
+    }
+
+    static EUniqueAttribute FindAttributeByName(const FName& Key);
+
+private:
+    float Values[NumAttributes];
+    uint64 PresentMask;
+};
+
+
 /**
  * 
  */
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Item/ItemData.h"
+#include "ItemShopListItem.generated.h"
+
+class UUW_ItemShop;
+
+
+UENUM(BlueprintType)
+enum class EItemShopSortMode : uint8
+{
+	Classification		UMETA(DisplayName = "Classification"),		// 분류 → 가격 순
+	PriceAscending		UMETA(DisplayName = "Price Ascending"),
+	PriceDescending		UMETA(DisplayName = "Price Descending"),
+	Stat				UMETA(DisplayName = "Stat")					// 정렬 스탯 수치가 큰 순
+};
+
+
+/**
+ * 상점 타일 뷰에 넘기는 아이템 데이터.
+ *
+ * 카탈로그의 아이템마다 하나씩 만들어 두고, 필터 / 정렬은 이 객체 배열 위에서만 수행합니다.
+ * 위젯(UUW_ItemEntry)은 화면에 보이는 칸 수만큼만 만들어져 이 데이터를 바꿔 가며 재사용됩니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UItemShopListItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(const FItemTableRow& Item, UUW_ItemShop* InItemShop);
+
+	/** 아이템이 올려 주는 스탯 수치. 해당 스탯이 없으면 0 */
+	float GetStatValue(ECharacterStat Stat) const;
+	bool HasStat(ECharacterStat Stat) const;
+
+public:
+	int32 ItemCode = 0;
+	int32 Price = 0;
+	EItemClassification Classification = EItemClassification::None;
+
+	UPROPERTY()
+	TObjectPtr<UTexture> Icon;
+
+	TArray<FItemStatModifier> StatModifiers;
+	TWeakObjectPtr<UUW_ItemShop> ItemShop;
+};
@@ -0,0 +1,23 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/TileView.h"
+#include "ItemShopTileView.generated.h"
+
+/**
+ * 상점 목록용 타일 뷰.
+ *
+ * 위젯 블루프린트에 ItemTileView 가 없을 때 상점이 코드로 만들어 쓰므로,
+ * 디자이너에서만 정할 수 있는 엔트리 클래스를 코드에서 지정할 수 있게 합니다.
+ */
+UCLASS()
+class FURYOFLEGENDS_API UItemShopTileView : public UTileView
+{
+	GENERATED_BODY()
+
+public:
+	/** Slate 위젯을 만들기 전에 호출해야 적용됩니다. */
+	void SetEntryWidgetClass(TSubclassOf<UUserWidget> InEntryWidgetClass) { EntryWidgetClass = InEntryWidgetClass; }
+};
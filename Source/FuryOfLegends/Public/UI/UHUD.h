@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Plugins/UniqueCodeGenerator.h"
 #include "UHUD.generated.h"
 
 // Delegate declaration
@@ -28,6 +29,28 @@ class UUW_Inventory;
 class UTextBlock;
 class UCanvasPanel;
 class USizeBox;
+class UUW_ItemEntry;
+
+
+/** HUD 가 표시 중인 타이머 하나. 코드는 처음 받을 때 한 번만 해석하고, 시각은 클라이언트 월드 시간 기준입니다. */
+struct FHUDTimerEntry
+{
+	ETimerCategory Category = ETimerCategory::None;
+	int32 ItemCode = 0;
+	bool bShowInInventory = false;
+	bool bShowInBuffList = false;
+
+	TWeakObjectPtr<UTexture> Icon;
+	float CooldownMaskOpacity = 0.1f;
+
+	float StartTime = 0.f;
+	float EndTime = 0.f;
+	bool bStarted = false;
+	int32 Count = 0;
+
+	// TimerWidgetPool 의 인덱스. 버프 목록에 표시하지 않으면 INDEX_NONE
+	int32 WidgetIndex = INDEX_NONE;
+};
 
 
 /**
@@ -40,6 +63,7 @@ class FURYOFLEGENDS_API UUHUD : public UUserWidget
 
 public:
 	virtual void NativeOnInitialized() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 
 public:
 	// Functions for updating HUD elements
@@ -95,18 +119,6 @@ public:
 	UFUNCTION()
 	void HandleTimerByCategory(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime);
 
-	UFUNCTION()	
-	void UpdateActionTimer(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime);
-
-	UFUNCTION()
-	void UpdateItemTimer(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime);
-
-	UFUNCTION()
-	void UpdateInventoryTimer(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime);
-
-	UFUNCTION()
-	void UpdateItemBuffTimer(const uint32 UniqueCode, const float RemainingTime, const float ElapsedTime);
-
 public:
 	void InitializeHUD(AAOSCharacterBase* OwningPlayer);
 
@@ -120,6 +132,14 @@ private:
 	void InitializeActions();
 	void BindStatComponent(UStatComponent* InStatComponent);
 
+	// 타이머 표시
+	void InitializeTimerWidgetPool();
+	bool DecodeTimerEntry(const uint32 UniqueCode, FHUDTimerEntry& OutEntry);
+	void AcquireTimerWidget(FHUDTimerEntry& Entry);
+	void ReleaseTimerEntry(FHUDTimerEntry& Entry);
+	void ApplyTimerProgress(const FHUDTimerEntry& Entry, const float CurrentTime);
+	void UpdateInventoryCooldown(const int32 ItemCode, const float CooldownRatio);
+
 public:
 	// Delegate for initialization completion
 	FOnComponentsBindingCompletedDelegate OnComponentsBindingCompleted;
@@ -198,8 +218,20 @@ private:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UHUD", Meta = (AllowPrivateAccess))
 	TObjectPtr<UClass> ItemEntryClass;
 
+	// 버프 목록에 동시에 표시할 수 있는 타이머 수. 위젯은 HUD 초기화 때 이 수만큼 미리 만듭니다.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UHUD", Meta = (AllowPrivateAccess, ClampMin = "1"))
+	int32 MaxTimerWidgets = 16;
+
+	// 남은 시간이 이 값 이하이면 만료된 것으로 보고 표시를 내립니다.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "UHUD", Meta = (AllowPrivateAccess))
+	float TimerExpireThreshold = 0.15f;
+
 	//TMap<FName, UTexture*> GamePlayTextures;
-	TMap<uint32, class UUW_ItemEntry*> TimerWidgets;
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UUW_ItemEntry>> TimerWidgetPool;
+
+	TArray<int32> FreeTimerWidgets;
+	TMap<uint32, FHUDTimerEntry> TimerEntries;
 
 	TArray<UMaterialInstanceDynamic*> MaterialRef;
 
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Blueprint/UserWidget.h"
+#include "Blueprint/IUserObjectListEntry.h"
 #include "Item/ItemData.h"
 #include "UW_ItemEntry.generated.h"
 
@@ -11,7 +12,7 @@
  * 
  */
 UCLASS()
-class FURYOFLEGENDS_API UUW_ItemEntry : public UUserWidget
+class FURYOFLEGENDS_API UUW_ItemEntry : public UUserWidget, public IUserObjectListEntry
 {
 	GENERATED_BODY()
 
@@ -51,6 +52,9 @@ public:
     void OnMouseUnHovered();
 
 protected:
+    // 상점 타일 뷰가 이 엔트리에 다른 아이템을 맡길 때 호출됩니다.
+    virtual void NativeOnListItemObjectSet(UObject* ListItemObject) override;
+
     bool IsEmptyNode() const;
     void SetEmptyNode();
     void InitializeMaterial();
@@ -3,21 +3,30 @@
 #include "CoreMinimal.h"
 #include "UI/UserWidgetBase.h"
 #include "Item/ItemData.h"
+#include "Item/ItemDescriptionTemplate.h"
+#include "UI/ItemShopListItem.h"
 #include "UW_ItemShop.generated.h"
 
 class AArenaGameState;
 class AArenaPlayerState;
 class UStatComponent;
 class UUW_ItemEntry;
-class UUniformGridPanel;
 class UStackBox;
 class UImage;
 class UTextBlock;
 class URichTextBlock;
 class UStackBoxSlot;
-class UVerticalBox;
 class UHorizontalBox;
 class UHorizontalBoxSlot;
+class UTileView;
+class UItemShopTileView;
+
+
+/** 레시피 트리를 너비 우선으로 펼친 결과. Levels[깊이] 는 그 단계의 아이템 코드이며 0 은 빈 칸입니다. */
+struct FRecipeTreeLayout
+{
+	TArray<TArray<int32>> Levels;
+};
 
 /**
  *
@@ -43,34 +52,49 @@ public:
 	void DisplayItemWithSubItems(int32 ItemCode);
 	void DisplayItemDescription(int32 ItemCode);
 	void SetSelectedItem(UUW_ItemEntry* NewSelectedItem);
+	bool IsItemSelected(int32 ItemCode) const { return ItemCode > 0 && SelectedItemCode == ItemCode; }
 	void PlaySound(USoundBase* Sound);
 	//void AdjustAndDisplayItemPrice(UUW_ItemEntry* Entry, FItemTableRow* ItemInfo);
 	//void ApplyDiscount(FItemTableRow* ItemInfo, int32& FinalPrice, TArray<int32>& PlayerInventoryItemCodes);
 
 	TWeakObjectPtr<AArenaGameState> GetGameState() { return GameState; }
 
+	// 목록 필터 / 정렬. 모두 메모리의 카탈로그 위에서 처리하며 위젯을 새로 만들지 않습니다.
+	void SetClassificationFilter(EItemClassification InClassification);
+
+	/** EItemClassification 은 uint32 열거형이라 블루프린트에서는 이름으로 받습니다. None 이면 필터를 해제합니다. */
+	UFUNCTION(BlueprintCallable, Category = "ItemShop")
+	void SetClassificationFilterByName(FName ClassificationName);
+
+	UFUNCTION(BlueprintCallable, Category = "ItemShop")
+	void SetStatFilter(ECharacterStat InStat);
+
+	UFUNCTION(BlueprintCallable, Category = "ItemShop")
+	void SetSortMode(EItemShopSortMode InSortMode, ECharacterStat InSortStat = ECharacterStat::None);
+
+	UFUNCTION(BlueprintCallable, Category = "ItemShop")
+	void RefreshItemList();
+
 	UFUNCTION()
 	void OnItemPurchased(int32 ItemCode, bool bSucessful);
 
 	// Private functions
 	UHorizontalBox* CreateRootHorizontalBox();
-	UUniformGridPanel* GetOrCreateClassificationPanel(const FString& ClassificationString);
+	bool EnsureItemTileView();
 
 	void SetupStackBoxSlot(UStackBoxSlot* NewSlot, ESlateSizeRule::Type SizeRule, EHorizontalAlignment HorizontalAlignment, EVerticalAlignment VerticalAlignment);
 	void SetupHorizontalBoxSlot(UHorizontalBoxSlot* NewSlot, ESlateSizeRule::Type SizeRule, EHorizontalAlignment HorizontalAlignment, EVerticalAlignment VerticalAlignment);
 
-	void AddClassifiedItemEntry(const FItemTableRow& Item);
-	void AddNodesBreadthFirst(UUW_ItemEntry* RootNode);
-	void AddChildNodesRecursively(UUW_ItemEntry* ParentNode, UHorizontalBox* ParentBox, int32 Depth);
 	void AddItemDescription(const FItemTableRow& ItemInfo, UStatComponent* StatComponent);
 	void AddTopLevelBoxToItemHierarchy(UHorizontalBox* TopLevelBox);
 	void AddNodeToStackBox(UStackBox* ParentBox, UWidget* Node, ESlateSizeRule::Type SizeRule, EHorizontalAlignment HorizontalAlignment, EVerticalAlignment VerticalAlignment);
 	void AddNodeToHorizontalBox(UHorizontalBox* ParentBox, UWidget* Node, ESlateSizeRule::Type SizeRule, EHorizontalAlignment HorizontalAlignment, EVerticalAlignment VerticalAlignment);
 
-	UUW_ItemEntry* CreateNodeHierarchy(const FItemTableRow& NodeInfo);
-	UUW_ItemEntry* FindLoadedItemByID(int32 ItemCode) const;
-	UUW_ItemEntry* CreateCachedNode(const FItemTableRow& NodeInfo);
-	UUW_ItemEntry* GetOrCreateItemHierarchy(const FItemTableRow& ItemInfo);
+	const FRecipeTreeLayout& GetOrBuildRecipeLayout(const FItemTableRow& ItemInfo);
+	void ApplyRecipeLayout(const FRecipeTreeLayout& Layout);
+	UHorizontalBox* GetOrCreateRecipeLevelBox(int32 Depth);
+	UUW_ItemEntry* GetOrCreateRecipeNode(UHorizontalBox* LevelBox, int32 Index);
+
 	FItemTableRow* GetItemInfoByID(int32 ItemCode);
 
 protected:
@@ -87,6 +111,14 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ItemShop", Meta = (BindWidget))
 	TObjectPtr<UStackBox> ItemList;
 
+	// 가상화된 목록 타일 뷰. 위젯 블루프린트에 없으면 ItemList 안에 코드로 만듭니다.
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ItemShop", Meta = (BindWidgetOptional))
+	TObjectPtr<UTileView> ItemTileView;
+
+	// 코드로 만든 타일 뷰의 엔트리 크기
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "ItemShop")
+	FVector2D ItemTileSize = FVector2D(64.f, 64.f);
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "ItemShop", Meta = (BindWidget))
 	TObjectPtr<UStackBox> ItemHierarchyBox;
 
@@ -109,25 +141,37 @@ protected:
 	UDataTable* RichTextStyleSet;
 
 private:
-	// Private member variables
-	UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "ItemShop", meta = (AllowPrivateAccess))
-	TArray<TObjectPtr<UUW_ItemEntry>> LoadedItems;
-
 	TWeakObjectPtr<AArenaGameState> GameState;
 	TWeakObjectPtr<AArenaPlayerState> PlayerState;
 	TWeakObjectPtr<UUW_ItemEntry> SelectedItem;
 
-	TMap<FString, UUniformGridPanel*> ClassificationPanels;
-	TMap<FString, int32> ClassificationRows;
-	TMap<FString, int32> ClassificationColumns;
+	// 타일 뷰 엔트리는 재사용되므로 선택 상태는 아이템 코드로 기억합니다.
+	int32 SelectedItemCode = 0;
 
-	TMap<int32, TArray<TWeakObjectPtr<UUW_ItemEntry>>> ItemHierarchyCache;
+	// 카탈로그 전체의 목록 데이터. 상점을 처음 열 때 한 번 만듭니다.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UItemShopListItem>> CatalogItems;
+
+	EItemClassification ClassificationFilter = EItemClassification::None;
+	ECharacterStat StatFilter = ECharacterStat::None;
+	EItemShopSortMode SortMode = EItemShopSortMode::Classification;
+	ECharacterStat SortStat = ECharacterStat::None;
+
+	// 레시피 트리 단계별 가로 박스 풀. 노드 위젯은 각 박스의 자식으로 남겨 두고 재사용합니다.
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UHorizontalBox>> RecipeLevelBoxes;
+
+	TMap<int32, FRecipeTreeLayout> RecipeLayoutCache;
+	// 첫 노드를 만들 때 정해지는 표시 상태. 값이 없으면 아직 노드를 만들지 않은 것입니다.
+	TOptional<ESlateVisibility> RecipeNodeVisibility;
 	TMap<int32, TArray<class UUW_ItemDescriptionLine*>> ItemDescriptionCache;
 
+	// 아이템 설명 템플릿과 마지막 렌더링 결과. 설명이 참조하는 스탯이 바뀔 때만 다시 만듭니다.
+	FItemDescriptionCache DescriptionTextCache;
+
 	UUW_ItemEntry* DefaultEmptyNode = nullptr;
 	UMaterialInstanceDynamic* ItemImageRef = nullptr;
 
-	const int32 MaxColumn = 10;
 	int32 BoxIndex = 0;
 	int32 NodeIDCounter;
 };